@@ -57,6 +57,11 @@ static const char *cpbs_prefix[] = { "+CPBS:", NULL };
 
 struct pb_data {
 	int index_min, index_max;
+	int read_next;		/* first index of the next +CPBR range */
+	int read_end;		/* last index of the +CPBR in progress */
+	int read_last;		/* last index reported by the modem */
+	int read_window;	/* largest range the modem accepted */
+	int read_count;
 	char *old_charset;
 	int supported;
 	GAtChat *chat;
@@ -160,6 +165,13 @@ static void at_cpbr_notify(GAtResult *result, gpointer user_data)
 		if (!g_at_result_iter_next_number(&iter, &index))
 			continue;
 
+		/* Already reported by a range that failed half way */
+		if (index <= pbd->read_last)
+			continue;
+
+		pbd->read_last = index;
+		pbd->read_count += 1;
+
 		if (!g_at_result_iter_next_string(&iter, &number))
 			continue;
 
@@ -210,6 +222,13 @@ static void export_failed(struct cb_data *cbd)
 	}
 }
 
+static void at_read_entries(struct cb_data *cbd);
+
+static void at_read_next_entries(void *data)
+{
+	at_read_entries(data);
+}
+
 static void at_read_entries_cb(gboolean ok, GAtResult *result,
 						gpointer user_data)
 {
@@ -217,11 +236,57 @@ static void at_read_entries_cb(gboolean ok, GAtResult *result,
 	struct ofono_phonebook *pb = cbd->user;
 	struct pb_data *pbd = ofono_phonebook_get_data(pb);
 	ofono_phonebook_cb_t cb = cbd->cb;
+	int range = pbd->read_end - pbd->read_next + 1;
 	const char *charset;
 	struct ofono_error error;
 	char buf[32];
 
 	decode_at_error(&error, g_at_result_final_response(result));
+
+	/* 27.007 reports a range without any entries as not found */
+	if (error.type == OFONO_ERROR_TYPE_CME && error.error == 22) {
+		DBG("no entries in %d-%d", pbd->read_next, pbd->read_end);
+
+		ok = TRUE;
+		error.type = OFONO_ERROR_TYPE_NO_ERROR;
+		error.error = 0;
+	}
+
+	/*
+	 * Some modems refuse, or give up half way through, ranges that are
+	 * too large for them.  Retry the rest with half the range until
+	 * single entries are being read, and stick to what works.
+	 */
+	if (!ok && range > 1 && pbd->read_last < pbd->read_end) {
+		if (pbd->read_last >= pbd->read_next)
+			pbd->read_next = pbd->read_last + 1;
+
+		pbd->read_window = range / 2;
+
+		DBG("+CPBR range of %d failed, trying %d", range,
+							pbd->read_window);
+
+		at_read_entries(cbd);
+		return;
+	}
+
+	if (ok && pbd->read_end < pbd->index_max) {
+		pbd->read_next = pbd->read_end + 1;
+
+		DBG("%d entries read, at index %d of %d", pbd->read_count,
+					pbd->read_end, pbd->index_max);
+
+		ofono_phonebook_when_ready(pb, at_read_next_entries, cbd,
+						g_free);
+		return;
+	}
+
+	DBG("%d entries read", pbd->read_count);
+
+	/* Not a range problem after all, start from scratch next time */
+	if (!ok)
+		pbd->read_window = 0;
+
 	cb(&error, cbd->data);
 	g_free(cbd);
 
@@ -242,8 +307,14 @@ static void at_read_entries(struct cb_data *cbd)
 	struct pb_data *pbd = ofono_phonebook_get_data(pb);
 	char buf[32];
 
+	pbd->read_end = pbd->index_max;
+
+	if (pbd->read_window > 0 &&
+			pbd->read_end - pbd->read_next >= pbd->read_window)
+		pbd->read_end = pbd->read_next + pbd->read_window - 1;
+
 	snprintf(buf, sizeof(buf), "AT+CPBR=%d,%d",
-			pbd->index_min, pbd->index_max);
+			pbd->read_next, pbd->read_end);
 	if (g_at_chat_send_listing(pbd->chat, buf, cpbr_prefix,
 					at_cpbr_notify, at_read_entries_cb,
 					cbd, NULL) > 0)
@@ -334,6 +405,10 @@ static void at_list_indices_cb(gboolean ok, GAtResult *result,
 	if (!g_at_result_iter_close_list(&iter))
 		goto error;
 
+	pbd->read_next = pbd->index_min;
+	pbd->read_last = pbd->index_min - 1;
+	pbd->read_count = 0;
+
 	if (g_at_chat_send(pbd->chat, "AT+CSCS?", cscs_prefix,
 				at_read_charset_cb, cbd, NULL) > 0)
 		return;
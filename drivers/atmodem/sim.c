@@ -47,6 +47,8 @@
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
 
+#define AT_SIM_MAX_BATCH_RECORDS 32
+
 struct sim_data {
 	GAtChat *chat;
 	unsigned int vendor;
@@ -217,51 +219,64 @@ static void at_sim_read_info(struct ofono_sim *sim, int fileid,
 				EF_STATUS_INVALIDATED, data);
 }
 
-static void at_crsm_read_cb(gboolean ok, GAtResult *result,
-				gpointer user_data)
+static gboolean at_crsm_parse_read(gboolean ok, GAtResult *result,
+					struct ofono_error *error,
+					const guint8 **response, gint *len)
 {
-	struct cb_data *cbd = user_data;
 	GAtResultIter iter;
-	ofono_sim_read_cb_t cb = cbd->cb;
-	struct ofono_error error;
-	const guint8 *response;
-	gint sw1, sw2, len;
+	gint sw1, sw2;
 
-	decode_at_error(&error, g_at_result_final_response(result));
+	decode_at_error(error, g_at_result_final_response(result));
 
-	if (!ok) {
-		cb(&error, NULL, 0, cbd->data);
-		return;
-	}
+	if (!ok)
+		return FALSE;
 
 	g_at_result_iter_init(&iter, result);
 
-	if (!g_at_result_iter_next(&iter, "+CRSM:")) {
-		CALLBACK_WITH_FAILURE(cb, NULL, 0, cbd->data);
-		return;
-	}
+	if (!g_at_result_iter_next(&iter, "+CRSM:"))
+		goto failure;
 
 	g_at_result_iter_next_number(&iter, &sw1);
 	g_at_result_iter_next_number(&iter, &sw2);
 
 	if ((sw1 != 0x90 && sw1 != 0x91 && sw1 != 0x92 && sw1 != 0x9f) ||
 			(sw1 == 0x90 && sw2 != 0x00)) {
-		memset(&error, 0, sizeof(error));
+		memset(error, 0, sizeof(*error));
 
-		error.type = OFONO_ERROR_TYPE_SIM;
-		error.error = (sw1 << 8) | sw2;
+		error->type = OFONO_ERROR_TYPE_SIM;
+		error->error = (sw1 << 8) | sw2;
 
-		cb(&error, NULL, 0, cbd->data);
-		return;
+		return FALSE;
 	}
 
-	if (!g_at_result_iter_next_hexstring(&iter, &response, &len)) {
-		CALLBACK_WITH_FAILURE(cb, NULL, 0, cbd->data);
+	if (!g_at_result_iter_next_hexstring(&iter, response, len))
+		goto failure;
+
+	DBG("crsm_read_cb: %02x, %02x, %d", sw1, sw2, *len);
+
+	return TRUE;
+
+failure:
+	error->type = OFONO_ERROR_TYPE_FAILURE;
+	error->error = 0;
+
+	return FALSE;
+}
+
+static void at_crsm_read_cb(gboolean ok, GAtResult *result,
+				gpointer user_data)
+{
+	struct cb_data *cbd = user_data;
+	ofono_sim_read_cb_t cb = cbd->cb;
+	struct ofono_error error;
+	const guint8 *response;
+	gint len;
+
+	if (!at_crsm_parse_read(ok, result, &error, &response, &len)) {
+		cb(&error, NULL, 0, cbd->data);
 		return;
 	}
 
-	DBG("crsm_read_cb: %02x, %02x, %d", sw1, sw2, len);
-
 	cb(&error, response, len, cbd->data);
 }
 
@@ -315,6 +330,119 @@ static void at_sim_read_record(struct ofono_sim *sim, int fileid,
 	CALLBACK_WITH_FAILURE(cb, NULL, 0, data);
 }
 
+struct crsm_records_req {
+	ofono_sim_read_cb_t cb;
+	void *data;
+	unsigned char *buf;
+	int length;
+	int num_records;
+	int completed;
+	int received;
+	gboolean failed;
+	struct ofono_error error;
+	int refs;
+};
+
+static void crsm_records_req_unref(gpointer user_data)
+{
+	struct crsm_records_req *req = user_data;
+
+	if (--req->refs > 0)
+		return;
+
+	g_free(req->buf);
+	g_free(req);
+}
+
+static void at_crsm_records_cb(gboolean ok, GAtResult *result,
+				gpointer user_data)
+{
+	struct crsm_records_req *req = user_data;
+	struct ofono_error error;
+	const guint8 *response;
+	gint len;
+
+	req->completed += 1;
+
+	/* Only the records before the first failure are returned */
+	if (!req->failed) {
+		if (at_crsm_parse_read(ok, result, &error, &response, &len) &&
+				len == req->length) {
+			memcpy(req->buf + req->received * req->length,
+					response, len);
+			req->received += 1;
+		} else {
+			if (ok && error.type == OFONO_ERROR_TYPE_NO_ERROR)
+				error.type = OFONO_ERROR_TYPE_FAILURE;
+
+			req->failed = TRUE;
+			req->error = error;
+		}
+	}
+
+	if (req->completed < req->num_records)
+		return;
+
+	if (req->received == 0) {
+		req->cb(&req->error, NULL, 0, req->data);
+		return;
+	}
+
+	memset(&error, 0, sizeof(error));
+	error.type = OFONO_ERROR_TYPE_NO_ERROR;
+
+	req->cb(&error, req->buf, req->received * req->length, req->data);
+}
+
+/*
+ * +CRSM can only address one record at a time, so queue the READ RECORD
+ * commands back to back and report them to the core in one go
+ */
+static void at_sim_read_records(struct ofono_sim *sim, int fileid,
+				int record, int num_records, int length,
+				const unsigned char *path,
+				unsigned int path_len,
+				ofono_sim_read_cb_t cb, void *data)
+{
+	struct sim_data *sd = ofono_sim_get_data(sim);
+	struct crsm_records_req *req;
+	char buf[128];
+	unsigned int len;
+	int i;
+
+	num_records = MIN(num_records, AT_SIM_MAX_BATCH_RECORDS);
+
+	req = g_new0(struct crsm_records_req, 1);
+	req->cb = cb;
+	req->data = data;
+	req->length = length;
+	req->buf = g_new(unsigned char, num_records * length);
+
+	for (i = 0; i < num_records; i++) {
+		len = snprintf(buf, sizeof(buf), "AT+CRSM=178,%i,%i,4,%i",
+				fileid, record + i, length);
+
+		append_file_path(buf + len, path, path_len);
+
+		if (g_at_chat_send(sd->chat, buf, crsm_prefix,
+					at_crsm_records_cb, req,
+					crsm_records_req_unref) == 0)
+			break;
+
+		req->refs += 1;
+	}
+
+	req->num_records = i;
+
+	if (i > 0)
+		return;
+
+	g_free(req->buf);
+	g_free(req);
+
+	CALLBACK_WITH_FAILURE(cb, NULL, 0, data);
+}
+
 static void at_crsm_update_cb(gboolean ok, GAtResult *result,
 				gpointer user_data)
 {
@@ -2117,7 +2245,8 @@ static const struct ofono_sim_driver driver = {
 	.session_read_record	= at_session_read_record,
 	.session_read_info	= at_session_read_info,
 	.logical_access		= at_logical_access,
-	.set_active_card_slot	= at_set_active_card_slot
+	.set_active_card_slot	= at_set_active_card_slot,
+	.read_file_linear_records = at_sim_read_records
 };
 
 OFONO_ATOM_DRIVER_BUILTIN(sim, atmodem, &driver)
@@ -50,6 +50,7 @@ static const char *cpms_prefix[] = { "+CPMS:", NULL };
 static const char *cnmi_prefix[] = { "+CNMI:", NULL };
 static const char *cmgs_prefix[] = { "+CMGS:", NULL };
 static const char *cmgl_prefix[] = { "+CMGL:", NULL };
+static const char *cmms_prefix[] = { "+CMMS:", NULL };
 static const char *none_prefix[] = { NULL };
 
 static gboolean set_cmgf(gpointer user_data);
@@ -58,6 +59,7 @@ static void at_cmgl_set_cpms(struct ofono_sms *sms, int store);
 
 #define MAX_CMGF_RETRIES 10
 #define MAX_CPMS_RETRIES 10
+#define AT_SMS_MAX_PENDING_SUBMITS 4
 
 static const char *storages[] = {
 	"SM",
@@ -767,6 +769,21 @@ static void at_cmgl_set_cpms(struct ofono_sms *sms, int store)
 	}
 }
 
+static void at_cmms_support_cb(gboolean ok, GAtResult *result,
+					gpointer user_data)
+{
+	struct ofono_sms *sms = user_data;
+
+	if (!ok)
+		return;
+
+	/*
+	 * The chat queue completes +CMGS in order and +CMMS keeps the relay
+	 * link up between them, so let the core queue submissions back to back
+	 */
+	ofono_sms_set_max_pending_submits(sms, AT_SMS_MAX_PENDING_SUBMITS);
+}
+
 static void at_sms_initialized(struct ofono_sms *sms)
 {
 	struct sms_data *data = ofono_sms_get_data(sms);
@@ -777,6 +794,16 @@ static void at_sms_initialized(struct ofono_sms *sms)
 	else
 		at_cmgl_set_cpms(sms, data->incoming);
 
+	switch (data->vendor) {
+	case OFONO_VENDOR_GEMALTO:
+		/* no mms support */
+		break;
+	default:
+		g_at_chat_send(data->chat, "AT+CMMS=?", cmms_prefix,
+				at_cmms_support_cb, sms, NULL);
+		break;
+	}
+
 	ofono_sms_register(sms);
 }
 
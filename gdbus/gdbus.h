@@ -90,6 +90,7 @@ typedef void (* GDBusSecurityFunction) (DBusConnection *connection,
 
 enum GDBusFlags {
 	G_DBUS_FLAG_ENABLE_EXPERIMENTAL = (1 << 0),
+	G_DBUS_FLAG_ENABLE_STATISTICS   = (1 << 1),
 };
 
 enum GDBusMethodFlags {
@@ -218,6 +219,31 @@ struct GDBusSecurityTable {
 void g_dbus_set_flags(int flags);
 int g_dbus_get_flags(void);
 
+/* Collected when G_DBUS_FLAG_ENABLE_STATISTICS is set, times in usec */
+typedef struct {
+	const char *interface;
+	const char *member;
+	gboolean signal;
+	unsigned int count;
+	unsigned int errors;
+	unsigned int deferred;
+	unsigned int dropped;
+	guint64 total_time;
+	guint64 max_time;
+} GDBusStatistics;
+
+typedef void (* GDBusStatisticsFunction) (const GDBusStatistics *stats,
+							void *user_data);
+typedef void (* GDBusSenderStatisticsFunction) (const char *sender,
+							unsigned int count,
+							void *user_data);
+
+void g_dbus_foreach_statistics(GDBusStatisticsFunction function,
+							void *user_data);
+void g_dbus_foreach_sender_statistics(GDBusSenderStatisticsFunction function,
+							void *user_data);
+void g_dbus_reset_statistics(void);
+
 gboolean g_dbus_register_interface(DBusConnection *connection,
 					const char *path, const char *name,
 					const GDBusMethodTable *methods,
@@ -303,6 +329,9 @@ void g_dbus_emit_property_changed(DBusConnection *connection,
 gboolean g_dbus_get_properties(DBusConnection *connection, const char *path,
 				const char *interface, DBusMessageIter *iter);
 
+DBusMessage *g_dbus_get_managed_objects(DBusConnection *connection,
+							DBusMessage *message);
+
 gboolean g_dbus_attach_object_manager(DBusConnection *connection);
 gboolean g_dbus_detach_object_manager(DBusConnection *connection);
 
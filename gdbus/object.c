@@ -58,6 +58,7 @@ struct generic_data {
 	guint process_id;
 	gboolean pending_prop;
 	char *introspect;
+	char *interfaces_xml;
 	struct generic_data *parent;
 };
 
@@ -69,6 +70,7 @@ struct interface_data {
 	GSList *pending_prop;
 	void *user_data;
 	GDBusDestroyFunction destroy;
+	char *xml;
 };
 
 struct security_data {
@@ -190,10 +192,52 @@ static void generate_interface_xml(GString *gstr, struct interface_data *iface)
 	}
 }
 
+/* Interface tables are static, so their XML only needs to be built once */
+static const char *interface_xml(struct interface_data *iface)
+{
+	GString *gstr;
+
+	if (iface->xml != NULL)
+		return iface->xml;
+
+	gstr = g_string_new(NULL);
+
+	g_string_append_printf(gstr, "<interface name=\"%s\">", iface->name);
+
+	generate_interface_xml(gstr, iface);
+
+	g_string_append_printf(gstr, "</interface>");
+
+	iface->xml = g_string_free(gstr, FALSE);
+
+	return iface->xml;
+}
+
+/*
+ * The interfaces part is kept until the interface set changes, changes
+ * in the list of children only require the outer node to be rebuilt.
+ */
+static const char *interfaces_xml(struct generic_data *data)
+{
+	GSList *list;
+	GString *gstr;
+
+	if (data->interfaces_xml != NULL)
+		return data->interfaces_xml;
+
+	gstr = g_string_new(NULL);
+
+	for (list = data->interfaces; list; list = list->next)
+		g_string_append(gstr, interface_xml(list->data));
+
+	data->interfaces_xml = g_string_free(gstr, FALSE);
+
+	return data->interfaces_xml;
+}
+
 static void generate_introspection_xml(DBusConnection *conn,
 				struct generic_data *data, const char *path)
 {
-	GSList *list;
 	GString *gstr;
 	char **children;
 	int i;
@@ -204,16 +248,7 @@ static void generate_introspection_xml(DBusConnection *conn,
 
 	g_string_append_printf(gstr, "<node>");
 
-	for (list = data->interfaces; list; list = list->next) {
-		struct interface_data *iface = list->data;
-
-		g_string_append_printf(gstr, "<interface name=\"%s\">",
-								iface->name);
-
-		generate_interface_xml(gstr, iface);
-
-		g_string_append_printf(gstr, "</interface>");
-	}
+	g_string_append(gstr, interfaces_xml(data));
 
 	if (!dbus_connection_list_registered(conn, path, &children))
 		goto done;
@@ -250,14 +285,295 @@ static DBusMessage *introspect(DBusConnection *connection,
 	return reply;
 }
 
+struct call_stats {
+	GDBusStatistics stats;
+	char *interface;
+	char *member;
+};
+
+struct pending_call {
+	struct call_stats *stats;
+	gint64 start;
+	gboolean deferred;
+};
+
+static GHashTable *call_stats = NULL;
+static GHashTable *sender_stats = NULL;
+static GHashTable *pending_calls = NULL;
+static dbus_int32_t pending_call_slot = -1;
+
+static void call_stats_free(gpointer data)
+{
+	struct call_stats *entry = data;
+
+	g_free(entry->interface);
+	g_free(entry->member);
+	g_free(entry);
+}
+
+static struct call_stats *stats_lookup(DBusMessage *message, gboolean signal)
+{
+	const char *interface = dbus_message_get_interface(message);
+	const char *member = dbus_message_get_member(message);
+	struct call_stats *entry;
+	char *key;
+
+	if (interface == NULL)
+		interface = "";
+
+	if (member == NULL)
+		member = "";
+
+	if (call_stats == NULL)
+		call_stats = g_hash_table_new_full(g_str_hash, g_str_equal,
+						g_free, call_stats_free);
+
+	key = g_strdup_printf("%c%s.%s", signal ? 's' : 'm',
+						interface, member);
+	entry = g_hash_table_lookup(call_stats, key);
+
+	if (entry != NULL) {
+		g_free(key);
+		return entry;
+	}
+
+	entry = g_new0(struct call_stats, 1);
+	entry->interface = g_strdup(interface);
+	entry->member = g_strdup(member);
+	entry->stats.interface = entry->interface;
+	entry->stats.member = entry->member;
+	entry->stats.signal = signal;
+	g_hash_table_insert(call_stats, key, entry);
+
+	return entry;
+}
+
+static char *pending_call_key(const char *name, dbus_uint32_t serial)
+{
+	return g_strdup_printf("%s:%u", name ? name : "", serial);
+}
+
+static void stats_record(struct call_stats *entry, gint64 start,
+							gboolean error)
+{
+	guint64 elapsed = g_get_monotonic_time() - start;
+
+	entry->stats.count++;
+	entry->stats.total_time += elapsed;
+
+	if (elapsed > entry->stats.max_time)
+		entry->stats.max_time = elapsed;
+
+	if (error)
+		entry->stats.errors++;
+}
+
+/* The method call is being freed, its entry is gone if it got a reply */
+static void pending_call_released(void *data)
+{
+	char *key = data;
+	struct pending_call *call;
+
+	if (pending_calls != NULL) {
+		call = g_hash_table_lookup(pending_calls, key);
+
+		if (call != NULL) {
+			call->stats->stats.dropped++;
+			g_hash_table_remove(pending_calls, key);
+		}
+	}
+
+	g_free(key);
+}
+
+/*
+ * Calls expecting a reply are tracked until the reply is sent, wherever
+ * that happens, or until the call is released without one.  For the
+ * others the returned entry is completed by stats_call_end() right after
+ * the handler returns.
+ */
+static struct pending_call *stats_call_begin(DBusMessage *message,
+					const GDBusMethodTable *method)
+{
+	const char *sender = dbus_message_get_sender(message);
+	dbus_uint32_t serial = dbus_message_get_serial(message);
+	struct pending_call *call;
+	unsigned int count;
+
+	if (sender_stats == NULL)
+		sender_stats = g_hash_table_new_full(g_str_hash, g_str_equal,
+							g_free, NULL);
+
+	count = GPOINTER_TO_UINT(g_hash_table_lookup(sender_stats,
+						sender ? sender : ""));
+	g_hash_table_replace(sender_stats, g_strdup(sender ? sender : ""),
+						GUINT_TO_POINTER(count + 1));
+
+	call = g_new0(struct pending_call, 1);
+	call->stats = stats_lookup(message, FALSE);
+	call->start = g_get_monotonic_time();
+
+	if (method->flags & G_DBUS_METHOD_FLAG_NOREPLY)
+		return call;
+
+	/* Completed by the reply, whenever and however it gets sent */
+	if (pending_calls == NULL)
+		pending_calls = g_hash_table_new_full(g_str_hash, g_str_equal,
+							g_free, g_free);
+
+	g_hash_table_replace(pending_calls, pending_call_key(sender, serial),
+									call);
+
+	if (pending_call_slot == -1)
+		dbus_message_allocate_data_slot(&pending_call_slot);
+
+	if (pending_call_slot != -1)
+		dbus_message_set_data(message, pending_call_slot,
+					pending_call_key(sender, serial),
+					pending_call_released);
+
+	return NULL;
+}
+
+static void stats_call_end(DBusMessage *message, DBusMessage *reply,
+				const GDBusMethodTable *method,
+				struct pending_call *call)
+{
+	struct pending_call *pending;
+	char *key;
+
+	if (call != NULL) {
+		/* No reply expected */
+		stats_record(call->stats, call->start, FALSE);
+		g_free(call);
+		return;
+	}
+
+	/* A synchronous reply is about to be sent by the caller */
+	if (reply != NULL || pending_calls == NULL)
+		return;
+
+	key = pending_call_key(dbus_message_get_sender(message),
+					dbus_message_get_serial(message));
+	pending = g_hash_table_lookup(pending_calls, key);
+
+	if (pending != NULL) {
+		if (method->flags & G_DBUS_METHOD_FLAG_ASYNC)
+			pending->deferred = TRUE;
+		else
+			g_hash_table_remove(pending_calls, key);
+	}
+
+	g_free(key);
+}
+
+static void stats_message_sent(DBusMessage *message)
+{
+	struct pending_call *call;
+	char *key;
+
+	if (!(global_flags & G_DBUS_FLAG_ENABLE_STATISTICS))
+		return;
+
+	switch (dbus_message_get_type(message)) {
+	case DBUS_MESSAGE_TYPE_SIGNAL:
+		stats_lookup(message, TRUE)->stats.count++;
+		return;
+	case DBUS_MESSAGE_TYPE_METHOD_RETURN:
+	case DBUS_MESSAGE_TYPE_ERROR:
+		break;
+	default:
+		return;
+	}
+
+	if (pending_calls == NULL)
+		return;
+
+	key = pending_call_key(dbus_message_get_destination(message),
+				dbus_message_get_reply_serial(message));
+	call = g_hash_table_lookup(pending_calls, key);
+
+	if (call != NULL) {
+		stats_record(call->stats, call->start,
+			dbus_message_get_type(message) ==
+						DBUS_MESSAGE_TYPE_ERROR);
+
+		if (call->deferred)
+			call->stats->stats.deferred++;
+
+		g_hash_table_remove(pending_calls, key);
+	}
+
+	g_free(key);
+}
+
+void g_dbus_foreach_statistics(GDBusStatisticsFunction function,
+							void *user_data)
+{
+	GHashTableIter iter;
+	gpointer value;
+
+	if (call_stats == NULL)
+		return;
+
+	g_hash_table_iter_init(&iter, call_stats);
+
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		struct call_stats *entry = value;
+
+		function(&entry->stats, user_data);
+	}
+}
+
+void g_dbus_foreach_sender_statistics(GDBusSenderStatisticsFunction function,
+							void *user_data)
+{
+	GHashTableIter iter;
+	gpointer key, value;
+
+	if (sender_stats == NULL)
+		return;
+
+	g_hash_table_iter_init(&iter, sender_stats);
+
+	while (g_hash_table_iter_next(&iter, &key, &value))
+		function(key, GPOINTER_TO_UINT(value), user_data);
+}
+
+void g_dbus_reset_statistics(void)
+{
+	if (pending_calls != NULL) {
+		g_hash_table_destroy(pending_calls);
+		pending_calls = NULL;
+	}
+
+	if (call_stats != NULL) {
+		g_hash_table_destroy(call_stats);
+		call_stats = NULL;
+	}
+
+	if (sender_stats != NULL) {
+		g_hash_table_destroy(sender_stats);
+		sender_stats = NULL;
+	}
+}
+
 static DBusHandlerResult process_message(DBusConnection *connection,
 			DBusMessage *message, const GDBusMethodTable *method,
 							void *iface_user_data)
 {
 	DBusMessage *reply;
+	struct pending_call *call = NULL;
+	gboolean stats = global_flags & G_DBUS_FLAG_ENABLE_STATISTICS;
+
+	if (stats)
+		call = stats_call_begin(message, method);
 
 	reply = method->function(connection, message, iface_user_data);
 
+	if (stats)
+		stats_call_end(message, reply, method, call);
+
 	if (method->flags & G_DBUS_METHOD_FLAG_NOREPLY) {
 		if (reply != NULL)
 			dbus_message_unref(reply);
@@ -589,6 +905,8 @@ static void emit_interfaces_added(struct generic_data *data)
 
 	dbus_message_iter_close_container(&iter, &array);
 
+	stats_message_sent(signal);
+
 	/* Use dbus_connection_send to avoid recursive calls to g_dbus_flush */
 	dbus_connection_send(data->conn, signal, NULL);
 	dbus_message_unref(signal);
@@ -654,6 +972,10 @@ static gboolean remove_interface(struct generic_data *data, const char *name)
 
 	data->interfaces = g_slist_remove(data->interfaces, iface);
 
+	g_free(data->interfaces_xml);
+	data->interfaces_xml = NULL;
+	g_free(iface->xml);
+
 	if (iface->destroy) {
 		iface->destroy(iface->user_data);
 		iface->user_data = NULL;
@@ -975,6 +1297,8 @@ static void emit_interfaces_removed(struct generic_data *data)
 
 	dbus_message_iter_close_container(&iter, &array);
 
+	stats_message_sent(signal);
+
 	/* Use dbus_connection_send to avoid recursive calls to g_dbus_flush */
 	dbus_connection_send(data->conn, signal, NULL);
 	dbus_message_unref(signal);
@@ -1030,6 +1354,7 @@ static void generic_unregister(DBusConnection *connection, void *user_data)
 
 	dbus_connection_unref(data->conn);
 	g_free(data->introspect);
+	g_free(data->interfaces_xml);
 	g_free(data->path);
 	g_free(data);
 }
@@ -1085,9 +1410,145 @@ static const GDBusMethodTable introspect_methods[] = {
 	{ }
 };
 
-static void append_interfaces(struct generic_data *data, DBusMessageIter *iter)
+static void iter_append_iter(DBusMessageIter *base, DBusMessageIter *iter)
+{
+	int type;
+
+	type = dbus_message_iter_get_arg_type(iter);
+
+	if (dbus_type_is_basic(type)) {
+		/* Large enough for 64-bit and double values on any ABI */
+		DBusBasicValue value;
+
+		dbus_message_iter_get_basic(iter, &value);
+		dbus_message_iter_append_basic(base, type, &value);
+	} else if (dbus_type_is_container(type)) {
+		DBusMessageIter iter_sub, base_sub;
+		char *sig;
+
+		dbus_message_iter_recurse(iter, &iter_sub);
+
+		switch (type) {
+		case DBUS_TYPE_ARRAY:
+			sig = dbus_message_iter_get_signature(iter);
+			break;
+		case DBUS_TYPE_VARIANT:
+			sig = dbus_message_iter_get_signature(&iter_sub);
+			break;
+		default:
+			sig = NULL;
+			break;
+		}
+
+		/* Skip the 'a' to get the element signature of arrays */
+		dbus_message_iter_open_container(base, type,
+				type == DBUS_TYPE_ARRAY ? sig + 1 : sig,
+				&base_sub);
+
+		if (sig != NULL)
+			dbus_free(sig);
+
+		while (dbus_message_iter_get_arg_type(&iter_sub) !=
+							DBUS_TYPE_INVALID) {
+			iter_append_iter(&base_sub, &iter_sub);
+			dbus_message_iter_next(&iter_sub);
+		}
+
+		dbus_message_iter_close_container(base, &base_sub);
+	}
+}
+
+static const GDBusMethodTable *find_get_properties(
+						struct interface_data *iface)
+{
+	const GDBusMethodTable *method;
+
+	for (method = iface->methods; method && method->name; method++) {
+		if (strcmp(method->name, "GetProperties"))
+			continue;
+
+		/*
+		 * Only plain getters can be invoked on behalf of the caller,
+		 * anything else is left for the client to call directly.
+		 */
+		if (method->flags & (G_DBUS_METHOD_FLAG_ASYNC |
+					G_DBUS_METHOD_FLAG_EXPERIMENTAL))
+			return NULL;
+
+		if (method->privilege || method->function == NULL)
+			return NULL;
+
+		if (method->in_args && method->in_args->name)
+			return NULL;
+
+		return method;
+	}
+
+	return NULL;
+}
+
+/*
+ * Interfaces without a property table may still expose their properties
+ * through a synchronous GetProperties method returning a{sv}.  Call it
+ * in-process so that the object listing includes them.
+ */
+static gboolean append_get_properties(struct generic_data *data,
+						struct interface_data *iface,
+						DBusMessage *message,
+						DBusMessageIter *iter)
+{
+	const GDBusMethodTable *method;
+	DBusMessage *call;
+	DBusMessage *reply;
+	DBusMessageIter reply_iter;
+	gboolean ret = FALSE;
+
+	method = find_get_properties(iface);
+	if (method == NULL)
+		return FALSE;
+
+	call = dbus_message_new_method_call(NULL, data->path, iface->name,
+							method->name);
+	if (call == NULL)
+		return FALSE;
+
+	dbus_message_set_serial(call, dbus_message_get_serial(message));
+	dbus_message_set_sender(call, dbus_message_get_sender(message));
+
+	reply = method->function(data->conn, call, iface->user_data);
+	dbus_message_unref(call);
+
+	if (reply == NULL)
+		return FALSE;
+
+	if (dbus_message_get_type(reply) == DBUS_MESSAGE_TYPE_METHOD_RETURN &&
+			dbus_message_has_signature(reply,
+				DBUS_TYPE_ARRAY_AS_STRING
+				DBUS_DICT_ENTRY_BEGIN_CHAR_AS_STRING
+				DBUS_TYPE_STRING_AS_STRING
+				DBUS_TYPE_VARIANT_AS_STRING
+				DBUS_DICT_ENTRY_END_CHAR_AS_STRING)) {
+		dbus_message_iter_init(reply, &reply_iter);
+		iter_append_iter(iter, &reply_iter);
+		ret = TRUE;
+	}
+
+	dbus_message_unref(reply);
+
+	return ret;
+}
+
+struct objects_data {
+	DBusMessage *message;
+	DBusMessageIter *array;
+};
+
+static void append_interfaces(struct generic_data *data,
+				DBusMessage *message, DBusMessageIter *iter)
 {
 	DBusMessageIter array;
+	DBusMessageIter entry;
+	GSList *l;
 
 	dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY,
 				DBUS_DICT_ENTRY_BEGIN_CHAR_AS_STRING
@@ -1099,7 +1560,21 @@ static void append_interfaces(struct generic_data *data, DBusMessageIter *iter)
 				DBUS_DICT_ENTRY_END_CHAR_AS_STRING
 				DBUS_DICT_ENTRY_END_CHAR_AS_STRING, &array);
 
-	g_slist_foreach(data->interfaces, append_interface, &array);
+	for (l = data->interfaces; l != NULL; l = l->next) {
+		struct interface_data *iface = l->data;
+
+		dbus_message_iter_open_container(&array, DBUS_TYPE_DICT_ENTRY,
+							NULL, &entry);
+		dbus_message_iter_append_basic(&entry, DBUS_TYPE_STRING,
+								&iface->name);
+
+		if (iface->properties != NULL ||
+				!append_get_properties(data, iface, message,
+								&entry))
+			append_properties(iface, &entry);
+
+		dbus_message_iter_close_container(&array, &entry);
+	}
 
 	dbus_message_iter_close_container(iter, &array);
 }
@@ -1107,15 +1582,15 @@ static void append_interfaces(struct generic_data *data, DBusMessageIter *iter)
 static void append_object(gpointer data, gpointer user_data)
 {
 	struct generic_data *child = data;
-	DBusMessageIter *array = user_data;
+	struct objects_data *objects = user_data;
 	DBusMessageIter entry;
 
-	dbus_message_iter_open_container(array, DBUS_TYPE_DICT_ENTRY, NULL,
-								&entry);
+	dbus_message_iter_open_container(objects->array, DBUS_TYPE_DICT_ENTRY,
+							NULL, &entry);
 	dbus_message_iter_append_basic(&entry, DBUS_TYPE_OBJECT_PATH,
 								&child->path);
-	append_interfaces(child, &entry);
-	dbus_message_iter_close_container(array, &entry);
+	append_interfaces(child, objects->message, &entry);
+	dbus_message_iter_close_container(objects->array, &entry);
 
 	g_slist_foreach(child->objects, append_object, user_data);
 }
@@ -1124,6 +1599,7 @@ static DBusMessage *get_objects(DBusConnection *connection,
 				DBusMessage *message, void *user_data)
 {
 	struct generic_data *data = user_data;
+	struct objects_data objects;
 	DBusMessage *reply;
 	DBusMessageIter iter;
 	DBusMessageIter array;
@@ -1149,7 +1625,9 @@ static DBusMessage *get_objects(DBusConnection *connection,
 					DBUS_DICT_ENTRY_END_CHAR_AS_STRING,
 					&array);
 
-	g_slist_foreach(data->objects, append_object, &array);
+	objects.message = message;
+	objects.array = &array;
+	g_slist_foreach(data->objects, append_object, &objects);
 
 	dbus_message_iter_close_container(&iter, &array);
 
@@ -1215,6 +1693,10 @@ done:
 	iface->destroy = destroy;
 
 	data->interfaces = g_slist_append(data->interfaces, iface);
+
+	g_free(data->interfaces_xml);
+	data->interfaces_xml = NULL;
+
 	if (data->parent == NULL)
 		return TRUE;
 
@@ -1500,6 +1982,8 @@ gboolean g_dbus_send_message(DBusConnection *connection, DBusMessage *message)
 	/* Flush pending signal to guarantee message order */
 	g_dbus_flush(connection);
 
+	stats_message_sent(message);
+
 	result = dbus_connection_send(connection, message, NULL);
 
 out:
@@ -1704,6 +2188,8 @@ static void process_properties_from_interface(struct generic_data *data,
 	g_slist_free(iface->pending_prop);
 	iface->pending_prop = NULL;
 
+	stats_message_sent(signal);
+
 	/* Use dbus_connection_send to avoid recursive calls to g_dbus_flush */
 	dbus_connection_send(data->conn, signal, NULL);
 	dbus_message_unref(signal);
@@ -1785,6 +2271,19 @@ gboolean g_dbus_get_properties(DBusConnection *connection, const char *path,
 	return TRUE;
 }
 
+DBusMessage *g_dbus_get_managed_objects(DBusConnection *connection,
+							DBusMessage *message)
+{
+	struct generic_data *data;
+
+	if (!dbus_connection_get_object_path_data(connection,
+					dbus_message_get_path(message),
+					(void *) &data) || data == NULL)
+		return NULL;
+
+	return get_objects(connection, message, data);
+}
+
 gboolean g_dbus_attach_object_manager(DBusConnection *connection)
 {
 	struct generic_data *data;
@@ -32,6 +32,7 @@ struct ofono_phonebook;
 
 typedef void (*ofono_phonebook_cb_t)(const struct ofono_error *error,
 					void *data);
+typedef void (*ofono_phonebook_ready_cb_t)(void *data);
 
 /* Export entries reports results through ofono_phonebook_entry, if an error
  * occurs, ofono_phonebook_entry should not be called
@@ -52,6 +53,18 @@ void ofono_phonebook_entry(struct ofono_phonebook *pb, int index,
 				const char *secondtext, const char *email,
 				const char *sip_uri, const char *tel_uri);
 
+/*
+ * Since 2.5+git1
+ *
+ * Drivers that read a storage with several requests call this before
+ * each further request.  cb is called right away, or once an ImportStream
+ * reader has caught up with the entries reported so far.  If the atom is
+ * removed while paused, destroy is called on data instead.
+ */
+void ofono_phonebook_when_ready(struct ofono_phonebook *pb,
+				ofono_phonebook_ready_cb_t cb, void *data,
+				ofono_destroy_func destroy);
+
 struct ofono_phonebook *ofono_phonebook_create(struct ofono_modem *modem,
 							unsigned int vendor,
 							const char *driver,
@@ -210,6 +210,16 @@ struct ofono_sim_driver {
 			ofono_sim_logical_access_cb_t cb, void *data);
 	void (*set_active_card_slot)(struct ofono_sim *sim, unsigned int index,
 			ofono_sim_set_active_card_slot_cb_t cb, void *data);
+	/* Since 2.5+git1 */
+	/*
+	 * Optional, reads up to num_records consecutive records of a linear
+	 * fixed EF starting at record.  The records are returned back to
+	 * back, the driver may return fewer records than requested.
+	 */
+	void (*read_file_linear_records)(struct ofono_sim *sim, int fileid,
+			int record, int num_records, int length,
+			const unsigned char *path, unsigned int path_len,
+			ofono_sim_read_cb_t cb, void *data);
 };
 
 struct ofono_sim *ofono_sim_create(struct ofono_modem *modem,
@@ -74,6 +74,16 @@ void ofono_sms_remove(struct ofono_sms *sms);
 void ofono_sms_set_data(struct ofono_sms *sms, void *data);
 void *ofono_sms_get_data(struct ofono_sms *sms);
 
+/*
+ * Since 2.5+git1
+ *
+ * Lets the core keep up to max submissions outstanding instead of waiting
+ * for each one to complete.  Only for drivers that complete submissions
+ * in the order they were issued.
+ */
+void ofono_sms_set_max_pending_submits(struct ofono_sms *sms,
+					unsigned int max);
+
 #ifdef __cplusplus
 }
 #endif
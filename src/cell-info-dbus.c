@@ -27,6 +27,7 @@
 
 typedef struct cell_entry {
 	guint cell_id;
+	guint update_seq;
 	char *path;
 	struct ofono_cell cell;
 } CellEntry;
@@ -38,13 +39,18 @@ typedef struct cell_info_dbus {
 	char *path;
 	gulong handler_id;
 	guint next_cell_id;
-	GSList *entries;
+	guint update_seq;
+	GQueue entries;
+	GHashTable *entry_table;
+	GHashTable *cell_ids;
 	struct ofono_dbus_clients *clients;
+	struct ofono_dbus_clients *batch_clients;
 } CellInfoDBus;
 
 #define CELL_INFO_DBUS_INTERFACE            "org.nemomobile.ofono.CellInfo"
 #define CELL_INFO_DBUS_CELLS_ADDED_SIGNAL   "CellsAdded"
 #define CELL_INFO_DBUS_CELLS_REMOVED_SIGNAL "CellsRemoved"
+#define CELL_INFO_DBUS_CELLS_CHANGED_SIGNAL "CellsChanged"
 #define CELL_INFO_DBUS_UNSUBSCRIBED_SIGNAL  "Unsubscribed"
 
 #define CELL_DBUS_INTERFACE_VERSION         (1)
@@ -319,62 +325,83 @@ static const GDBusSignalTable cell_info_dbus_cell_signals[] = {
 	{ }
 };
 
-static CellEntry *cell_info_dbus_find_id(CellInfoDBus *dbus, guint id)
-{
-	GSList *l;
-
-	for (l = dbus->entries; l; l = l->next) {
-		CellEntry *entry = l->data;
-
-		if (entry->cell_id == id) {
-			return entry;
-		}
-	}
-	return NULL;
-}
-
 static guint cell_info_dbus_next_cell_id(CellInfoDBus *dbus)
 {
-	while (cell_info_dbus_find_id(dbus, dbus->next_cell_id)) {
+	while (g_hash_table_contains(dbus->cell_ids,
+				GUINT_TO_POINTER(dbus->next_cell_id))) {
 		dbus->next_cell_id++;
 	}
 	return dbus->next_cell_id++;
 }
 
-static const struct ofono_cell *cell_info_dbus_find_ofono_cell
-	(struct ofono_cell_info *info, const struct ofono_cell *cell)
+/*
+ * Hash and equality functions for the cell location, i.e. the fields
+ * compared by ofono_cell_compare_location(). Both must agree with it,
+ * that's why only the low 32 bits of NR cell identity are hashed.
+ */
+static guint cell_info_dbus_location_hash(gconstpointer key)
 {
-	const ofono_cell_ptr *c;
+	const struct ofono_cell *cell = key;
+	guint h = cell->type;
 
-	for (c = info->cells; *c; c++) {
-		if (!ofono_cell_compare_location(*c, cell)) {
-			return *c;
-		}
+	switch (cell->type) {
+	case OFONO_CELL_TYPE_GSM:
+		h = h * 31 + cell->info.gsm.mcc;
+		h = h * 31 + cell->info.gsm.mnc;
+		h = h * 31 + cell->info.gsm.lac;
+		h = h * 31 + cell->info.gsm.cid;
+		break;
+	case OFONO_CELL_TYPE_WCDMA:
+		h = h * 31 + cell->info.wcdma.mcc;
+		h = h * 31 + cell->info.wcdma.mnc;
+		h = h * 31 + cell->info.wcdma.lac;
+		h = h * 31 + cell->info.wcdma.cid;
+		break;
+	case OFONO_CELL_TYPE_LTE:
+		h = h * 31 + cell->info.lte.mcc;
+		h = h * 31 + cell->info.lte.mnc;
+		h = h * 31 + cell->info.lte.ci;
+		h = h * 31 + cell->info.lte.pci;
+		h = h * 31 + cell->info.lte.tac;
+		break;
+	case OFONO_CELL_TYPE_NR:
+		h = h * 31 + cell->info.nr.mcc;
+		h = h * 31 + cell->info.nr.mnc;
+		h = h * 31 + (guint) cell->info.nr.nci;
+		h = h * 31 + cell->info.nr.pci;
+		h = h * 31 + cell->info.nr.tac;
+		break;
 	}
-	return NULL;
+	return h;
 }
 
-static CellEntry *cell_info_dbus_find_cell(CellInfoDBus *dbus,
-	const struct ofono_cell *cell)
+static gboolean cell_info_dbus_location_equal(gconstpointer a, gconstpointer b)
 {
-	if (cell) {
-		GSList *l;
+	return !ofono_cell_compare_location(a, b);
+}
 
-		for (l = dbus->entries; l; l = l->next) {
-			CellEntry *e = l->data;
+static guint cell_info_dbus_subscriber_count(CellInfoDBus *dbus)
+{
+	return ofono_dbus_clients_count(dbus->clients) +
+		ofono_dbus_clients_count(dbus->batch_clients);
+}
 
-			if (!ofono_cell_compare_location(&e->cell, cell)) {
-				return e;
-			}
-		}
+static void cell_info_dbus_signal_all(CellInfoDBus *dbus, DBusMessage *signal)
+{
+	/* Sent message gets locked and can't be readdressed, use a copy */
+	if (ofono_dbus_clients_count(dbus->batch_clients)) {
+		DBusMessage *copy = dbus_message_copy(signal);
+
+		ofono_dbus_clients_signal(dbus->batch_clients, copy);
+		dbus_message_unref(copy);
 	}
-	return NULL;
+	ofono_dbus_clients_signal(dbus->clients, signal);
 }
 
 static void cell_info_dbus_emit_path_list(CellInfoDBus *dbus, const char *name,
 	GPtrArray *list)
 {
-	if (ofono_dbus_clients_count(dbus->clients)) {
+	if (cell_info_dbus_subscriber_count(dbus)) {
 		guint i;
 		DBusMessageIter it, a;
 		DBusMessage *signal = dbus_message_new_signal(dbus->path,
@@ -389,7 +416,7 @@ static void cell_info_dbus_emit_path_list(CellInfoDBus *dbus, const char *name,
 				DBUS_TYPE_OBJECT_PATH, &path);
 		}
 		dbus_message_iter_close_container(&it, &a);
-		ofono_dbus_clients_signal(dbus->clients, signal);
+		cell_info_dbus_signal_all(dbus, signal);
 		dbus_message_unref(signal);
 	}
 }
@@ -476,22 +503,77 @@ static void cell_info_dbus_property_changed(CellInfoDBus *dbus,
 	}
 }
 
+static void cell_info_dbus_append_changes(DBusMessageIter *it,
+	const CellEntry *entry, int mask)
+{
+	int i, n;
+	DBusMessageIter st, dict;
+	const struct ofono_cell *cell = &entry->cell;
+	const struct cell_property *prop =
+		cell_info_dbus_cell_properties(cell->type, &n);
+
+	dbus_message_iter_open_container(it, DBUS_TYPE_STRUCT, NULL, &st);
+	dbus_message_iter_append_basic(&st, DBUS_TYPE_OBJECT_PATH,
+		&entry->path);
+	dbus_message_iter_open_container(&st, DBUS_TYPE_ARRAY, "{sv}", &dict);
+	if (mask & CELL_PROPERTY_REGISTERED) {
+		const dbus_bool_t registered = (cell->registered != FALSE);
+
+		ofono_dbus_dict_append(&dict, "registered",
+			DBUS_TYPE_BOOLEAN, &registered);
+	}
+	for (i = 0; i < n; i++) {
+		if (mask & prop[i].flag) {
+			ofono_dbus_dict_append(&dict, prop[i].name,
+				prop[i].type,
+				G_STRUCT_MEMBER_P(&cell->info, prop[i].off));
+		}
+	}
+	dbus_message_iter_close_container(&st, &dict);
+	dbus_message_iter_close_container(it, &st);
+}
+
 static void cell_info_dbus_update_entries(CellInfoDBus *dbus, gboolean emit)
 {
-	GSList *l;
+	GList *l;
 	GPtrArray* added = NULL;
 	GPtrArray* removed = NULL;
+	DBusMessage *changed = NULL;
+	DBusMessageIter changed_it, changed_array;
+	guint n_changed = 0;
 	const ofono_cell_ptr *c;
+	const guint seq = ++dbus->update_seq;
+
+	if (emit && ofono_dbus_clients_count(dbus->batch_clients)) {
+		changed = dbus_message_new_signal(dbus->path,
+			CELL_INFO_DBUS_INTERFACE,
+			CELL_INFO_DBUS_CELLS_CHANGED_SIGNAL);
+		dbus_message_iter_init_append(changed, &changed_it);
+		dbus_message_iter_open_container(&changed_it, DBUS_TYPE_ARRAY,
+			"(oa{sv})", &changed_array);
+	}
+
+	/* Mark the entries which are still there */
+	for (c = dbus->info->cells; *c; c++) {
+		CellEntry *entry = g_hash_table_lookup(dbus->entry_table, *c);
+
+		if (entry) {
+			entry->update_seq = seq;
+		}
+	}
 
 	/* Remove non-existent cells */
-	l = dbus->entries;
+	l = dbus->entries.head;
 	while (l) {
-		GSList *next = l->next;
+		GList *next = l->next;
 		CellEntry *entry = l->data;
 
-		if (!cell_info_dbus_find_ofono_cell(dbus->info, &entry->cell)) {
+		if (entry->update_seq != seq) {
 			DBG("%s removed", entry->path);
-			dbus->entries = g_slist_delete_link(dbus->entries, l);
+			g_queue_delete_link(&dbus->entries, l);
+			g_hash_table_remove(dbus->entry_table, &entry->cell);
+			g_hash_table_remove(dbus->cell_ids,
+				GUINT_TO_POINTER(entry->cell_id));
 			cell_info_dbus_emit_signal(dbus, entry->path,
 				CELL_DBUS_INTERFACE,
 				CELL_DBUS_REMOVED_SIGNAL,
@@ -515,7 +597,7 @@ static void cell_info_dbus_update_entries(CellInfoDBus *dbus, gboolean emit)
 	/* Add new cells */
 	for (c = dbus->info->cells; *c; c++) {
 		const struct ofono_cell *cell = *c;
-		CellEntry *entry = cell_info_dbus_find_cell(dbus, cell);
+		CellEntry *entry = g_hash_table_lookup(dbus->entry_table, cell);
 
 		if (entry) {
 			if (emit) {
@@ -525,16 +607,26 @@ static void cell_info_dbus_update_entries(CellInfoDBus *dbus, gboolean emit)
 				entry->cell = *cell;
 				cell_info_dbus_property_changed(dbus, entry,
 					diff);
+				if (diff && changed) {
+					cell_info_dbus_append_changes
+						(&changed_array, entry, diff);
+					n_changed++;
+				}
 			} else {
 				entry->cell = *cell;
 			}
 		} else {
 			entry = g_new0(CellEntry, 1);
 			entry->cell = *cell;
+			entry->update_seq = seq;
 			entry->cell_id = cell_info_dbus_next_cell_id(dbus);
 			entry->path = g_strdup_printf("%s/cell_%u", dbus->path,
 				entry->cell_id);
-			dbus->entries = g_slist_append(dbus->entries, entry);
+			g_queue_push_tail(&dbus->entries, entry);
+			g_hash_table_insert(dbus->entry_table, &entry->cell,
+				entry);
+			g_hash_table_add(dbus->cell_ids,
+				GUINT_TO_POINTER(entry->cell_id));
 			DBG("%s added", entry->path);
 			g_dbus_register_interface(dbus->conn, entry->path,
 				CELL_DBUS_INTERFACE,
@@ -561,6 +653,15 @@ static void cell_info_dbus_update_entries(CellInfoDBus *dbus, gboolean emit)
 			CELL_INFO_DBUS_CELLS_ADDED_SIGNAL, added);
 		g_ptr_array_free(added, TRUE);
 	}
+
+	if (changed) {
+		/* One signal for all the changes made during this update */
+		dbus_message_iter_close_container(&changed_it, &changed_array);
+		if (n_changed) {
+			ofono_dbus_clients_signal(dbus->batch_clients, changed);
+		}
+		dbus_message_unref(changed);
+	}
 }
 
 static void cell_info_dbus_cells_changed_cb(struct ofono_cell_info *info,
@@ -577,21 +678,26 @@ static DBusMessage *cell_info_dbus_error_failed(DBusMessage *msg,
 								explanation);
 }
 
-static DBusMessage *cell_info_dbus_get_cells(DBusConnection *conn,
-	DBusMessage *msg, void *data)
+static DBusMessage *cell_info_dbus_subscribe(CellInfoDBus *dbus,
+	DBusMessage *msg, gboolean batched)
 {
-	CellInfoDBus *dbus = data;
 	const char *sender = dbus_message_get_sender(msg);
+	struct ofono_dbus_clients *clients = batched ?
+		dbus->batch_clients : dbus->clients;
+	struct ofono_dbus_clients *other = batched ?
+		dbus->clients : dbus->batch_clients;
 
-	if (ofono_dbus_clients_add(dbus->clients, sender)) {
+	if (ofono_dbus_clients_add(clients, sender)) {
 		DBusMessage *reply = dbus_message_new_method_return(msg);
 		DBusMessageIter it, a;
-		GSList *l;
+		GList *l;
 
+		/* Each client receives either kind of updates, not both */
+		ofono_dbus_clients_remove(other, sender);
 		cell_info_dbus_set_updates_enabled(dbus, TRUE);
 		dbus_message_iter_init_append(reply, &it);
 		dbus_message_iter_open_container(&it, DBUS_TYPE_ARRAY, "o", &a);
-		for (l = dbus->entries; l; l = l->next) {
+		for (l = dbus->entries.head; l; l = l->next) {
 			const CellEntry *entry = l->data;
 
 			dbus_message_iter_append_basic(&a,
@@ -603,6 +709,18 @@ static DBusMessage *cell_info_dbus_get_cells(DBusConnection *conn,
 	return cell_info_dbus_error_failed(msg, "Operation failed");
 }
 
+static DBusMessage *cell_info_dbus_get_cells(DBusConnection *conn,
+	DBusMessage *msg, void *data)
+{
+	return cell_info_dbus_subscribe((CellInfoDBus *) data, msg, FALSE);
+}
+
+static DBusMessage *cell_info_dbus_get_cells_batched(DBusConnection *conn,
+	DBusMessage *msg, void *data)
+{
+	return cell_info_dbus_subscribe((CellInfoDBus *) data, msg, TRUE);
+}
+
 static DBusMessage *cell_info_dbus_unsubscribe(DBusConnection *conn,
 	DBusMessage *msg, void *data)
 {
@@ -610,12 +728,13 @@ static DBusMessage *cell_info_dbus_unsubscribe(DBusConnection *conn,
 	const char *sender = dbus_message_get_sender(msg);
 
 	DBG("%s", sender);
-	if (ofono_dbus_clients_remove(dbus->clients, sender)) {
+	if (ofono_dbus_clients_remove(dbus->clients, sender) ||
+		ofono_dbus_clients_remove(dbus->batch_clients, sender)) {
 		DBusMessage *signal = dbus_message_new_signal(dbus->path,
 			CELL_INFO_DBUS_INTERFACE,
 			CELL_INFO_DBUS_UNSUBSCRIBED_SIGNAL);
 
-		if (!ofono_dbus_clients_count(dbus->clients)) {
+		if (!cell_info_dbus_subscriber_count(dbus)) {
 			cell_info_dbus_set_updates_enabled(dbus, FALSE);
 		}
 		dbus_message_set_destination(signal, sender);
@@ -629,6 +748,9 @@ static const GDBusMethodTable cell_info_dbus_methods[] = {
 	{ GDBUS_METHOD("GetCells", NULL,
 			GDBUS_ARGS({ "paths", "ao" }),
 			cell_info_dbus_get_cells) },
+	{ GDBUS_METHOD("GetCellsBatched", NULL,
+			GDBUS_ARGS({ "paths", "ao" }),
+			cell_info_dbus_get_cells_batched) },
 	{ GDBUS_METHOD("Unsubscribe", NULL, NULL,
 			cell_info_dbus_unsubscribe) },
 	{ }
@@ -639,6 +761,8 @@ static const GDBusSignalTable cell_info_dbus_signals[] = {
 			GDBUS_ARGS({ "paths", "ao" })) },
 	{ GDBUS_SIGNAL(CELL_INFO_DBUS_CELLS_REMOVED_SIGNAL,
 			GDBUS_ARGS({ "paths", "ao" })) },
+	{ GDBUS_SIGNAL(CELL_INFO_DBUS_CELLS_CHANGED_SIGNAL,
+			GDBUS_ARGS({ "changes", "a(oa{sv})" })) },
 	{ GDBUS_SIGNAL(CELL_INFO_DBUS_UNSUBSCRIBED_SIGNAL,
 			GDBUS_ARGS({})) },
 	{ }
@@ -648,7 +772,7 @@ static void cell_info_dbus_disconnect_cb(const char *name, void *data)
 {
 	CellInfoDBus *dbus = data;
 
-	if (!ofono_dbus_clients_count(dbus->clients)) {
+	if (!cell_info_dbus_subscriber_count(dbus)) {
 		cell_info_dbus_set_updates_enabled(dbus, FALSE);
 	}
 }
@@ -665,6 +789,12 @@ CellInfoDBus *cell_info_dbus_new(struct ofono_modem *modem,
 		dbus->conn = dbus_connection_ref(ofono_dbus_get_connection());
 		dbus->info = ofono_cell_info_ref(info);
 		dbus->ctl = cell_info_control_ref(ctl);
+		dbus->entry_table = g_hash_table_new(
+			cell_info_dbus_location_hash,
+			cell_info_dbus_location_equal);
+		dbus->cell_ids = g_hash_table_new(g_direct_hash,
+							g_direct_equal);
+		g_queue_init(&dbus->entries);
 		dbus->handler_id = ofono_cell_info_add_change_handler(info,
 			cell_info_dbus_cells_changed_cb, dbus);
 
@@ -679,6 +809,8 @@ CellInfoDBus *cell_info_dbus_new(struct ofono_modem *modem,
 			cell_info_dbus_update_entries(dbus, FALSE);
 			dbus->clients = ofono_dbus_clients_new(dbus->conn,
 				cell_info_dbus_disconnect_cb, dbus);
+			dbus->batch_clients = ofono_dbus_clients_new(dbus->conn,
+				cell_info_dbus_disconnect_cb, dbus);
 			return dbus;
 		} else {
 			ofono_error("CellInfo D-Bus register failed");
@@ -691,15 +823,16 @@ CellInfoDBus *cell_info_dbus_new(struct ofono_modem *modem,
 void cell_info_dbus_free(CellInfoDBus *dbus)
 {
 	if (dbus) {
-		GSList *l;
+		GList *l;
 
 		DBG("%s", dbus->path);
 		ofono_dbus_clients_free(dbus->clients);
+		ofono_dbus_clients_free(dbus->batch_clients);
 		g_dbus_unregister_interface(dbus->conn, dbus->path,
 			CELL_INFO_DBUS_INTERFACE);
 
 		/* Unregister cells */
-		l = dbus->entries;
+		l = dbus->entries.head;
 		while (l) {
 			CellEntry *entry = l->data;
 			g_dbus_unregister_interface(dbus->conn, entry->path,
@@ -707,7 +840,9 @@ void cell_info_dbus_free(CellInfoDBus *dbus)
 			cell_info_destroy_entry(entry);
 			l = l->next;
 		}
-		g_slist_free(dbus->entries);
+		g_queue_clear(&dbus->entries);
+		g_hash_table_destroy(dbus->entry_table);
+		g_hash_table_destroy(dbus->cell_ids);
 
 		dbus_connection_unref(dbus->conn);
 
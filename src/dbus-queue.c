@@ -21,6 +21,8 @@
 
 struct ofono_dbus_queue {
 	struct ofono_dbus_queue_request *requests;
+	guint expire_id;
+	gint64 expire_at;
 };
 
 struct ofono_dbus_queue_request {
@@ -28,8 +30,12 @@ struct ofono_dbus_queue_request {
 	ofono_dbus_cb_t fn;
 	DBusMessage *msg;
 	void *data;
+	int priority;
+	gint64 deadline;
 };
 
+static void __ofono_dbus_queue_schedule_expire(struct ofono_dbus_queue *q);
+
 struct ofono_dbus_queue *__ofono_dbus_queue_new()
 {
 	return g_new0(struct ofono_dbus_queue, 1);
@@ -52,6 +58,94 @@ static void __ofono_dbus_queue_req_free(struct ofono_dbus_queue_request *req)
 	g_slice_free1(sizeof(*req), req);
 }
 
+static void __ofono_dbus_queue_add(struct ofono_dbus_queue *q,
+				struct ofono_dbus_queue_request *req)
+{
+	if (q->requests) {
+		/* The first request is being processed, keep it there */
+		struct ofono_dbus_queue_request *prev = q->requests;
+
+		while (prev->next && prev->next->priority >= req->priority)
+			prev = prev->next;
+
+		req->next = prev->next;
+		prev->next = req;
+	} else {
+		q->requests = req;
+	}
+}
+
+/* Removes and returns the first request */
+static struct ofono_dbus_queue_request *__ofono_dbus_queue_pop
+					(struct ofono_dbus_queue *q)
+{
+	struct ofono_dbus_queue_request *req = q->requests;
+
+	q->requests = req->next;
+	req->next = NULL;
+	return req;
+}
+
+static gboolean __ofono_dbus_queue_expire(gpointer data)
+{
+	struct ofono_dbus_queue *q = data;
+	struct ofono_dbus_queue_request *prev = q->requests;
+	const gint64 now = g_get_monotonic_time();
+
+	q->expire_id = 0;
+
+	/* The request being processed (if any) can't be expired */
+	while (prev && prev->next) {
+		struct ofono_dbus_queue_request *req = prev->next;
+
+		if (req->deadline && req->deadline <= now) {
+			prev->next = req->next;
+			req->next = NULL;
+			__ofono_dbus_pending_reply(&req->msg,
+					__ofono_error_timed_out(req->msg));
+			__ofono_dbus_queue_req_free(req);
+		} else {
+			prev = req;
+		}
+	}
+
+	__ofono_dbus_queue_schedule_expire(q);
+	return G_SOURCE_REMOVE;
+}
+
+static void __ofono_dbus_queue_schedule_expire(struct ofono_dbus_queue *q)
+{
+	struct ofono_dbus_queue_request *req;
+	gint64 expire_at = 0;
+
+	for (req = q->requests ? q->requests->next : NULL; req;
+							req = req->next) {
+		if (req->deadline && (!expire_at ||
+					req->deadline < expire_at)) {
+			expire_at = req->deadline;
+		}
+	}
+
+	if (q->expire_id) {
+		if (expire_at && expire_at >= q->expire_at) {
+			/* Will fire in time, and reschedule itself */
+			return;
+		}
+
+		g_source_remove(q->expire_id);
+		q->expire_id = 0;
+	}
+
+	if (expire_at) {
+		const gint64 now = g_get_monotonic_time();
+		const guint ms = expire_at > now ?
+			(guint)((expire_at - now + 999) / 1000) : 0;
+
+		q->expire_at = expire_at;
+		q->expire_id = g_timeout_add(ms, __ofono_dbus_queue_expire, q);
+	}
+}
+
 static void __ofono_dbus_queue_req_complete
 				(struct ofono_dbus_queue_request *req,
 					ofono_dbus_cb_t fn, void *param)
@@ -68,6 +162,10 @@ static void __ofono_dbus_queue_req_complete
 void __ofono_dbus_queue_free(struct ofono_dbus_queue *q)
 {
 	if (q) {
+		if (q->expire_id) {
+			g_source_remove(q->expire_id);
+		}
+
 		while (q->requests) {
 			struct ofono_dbus_queue_request *req = q->requests;
 			DBusMessage *reply = __ofono_error_canceled(req->msg);
@@ -92,27 +190,42 @@ ofono_bool_t __ofono_dbus_queue_set_pending(struct ofono_dbus_queue *q,
 	if (!q || q->requests)
 		return FALSE;
 
-	q->requests = __ofono_dbus_queue_req_new(NULL, msg, NULL);
+	__ofono_dbus_queue_add(q, __ofono_dbus_queue_req_new(NULL, msg, NULL));
 	return TRUE;
 }
 
 void __ofono_dbus_queue_request(struct ofono_dbus_queue *q,
 			ofono_dbus_cb_t fn, DBusMessage *msg, void *data)
+{
+	__ofono_dbus_queue_request_full(q, fn, msg, data,
+					OFONO_DBUS_QUEUE_PRIORITY_DEFAULT, 0);
+}
+
+void __ofono_dbus_queue_request_full(struct ofono_dbus_queue *q,
+			ofono_dbus_cb_t fn, DBusMessage *msg, void *data,
+			enum ofono_dbus_queue_priority priority,
+			unsigned int timeout_ms)
 {
 	struct ofono_dbus_queue_request *req =
 		__ofono_dbus_queue_req_new(fn, msg, data);
 
-	if (q->requests) {
-		struct ofono_dbus_queue_request *prev = q->requests;
+	req->priority = priority;
 
-		while (prev->next)
-			prev = prev->next;
+	if (q->requests) {
+		if (timeout_ms) {
+			req->deadline = g_get_monotonic_time() +
+					(gint64)timeout_ms * 1000;
+		}
 
-		prev->next = req;
+		__ofono_dbus_queue_add(q, req);
+		if (req->deadline) {
+			__ofono_dbus_queue_schedule_expire(q);
+		}
 	} else {
 		DBusMessage *reply;
 
-		q->requests = req;
+		/* Submitted right away, the deadline doesn't apply */
+		__ofono_dbus_queue_add(q, req);
 		reply = req->fn(req->msg, req->data);
 		if (reply) {
 			/* The request has completed synchronously */
@@ -134,10 +247,8 @@ static void __ofono_dbus_queue_submit_next(struct ofono_dbus_queue *q)
 			break;
 
 		/* The request has completed synchronously */
-		done = next;
-		next = done->next;
-		q->requests = next;
-		done->next = NULL;
+		done = __ofono_dbus_queue_pop(q);
+		next = q->requests;
 
 		/* Send the reply */
 		__ofono_dbus_pending_reply(&done->msg, reply);
@@ -149,7 +260,7 @@ static void __ofono_dbus_queue_submit_next(struct ofono_dbus_queue *q)
 void __ofono_dbus_queue_reply_msg(struct ofono_dbus_queue *q,
 							DBusMessage *reply)
 {
-	struct ofono_dbus_queue_request *done, *next;
+	struct ofono_dbus_queue_request *done;
 
 	if (!q || !q->requests) {
 		/* This should never happen */
@@ -160,10 +271,7 @@ void __ofono_dbus_queue_reply_msg(struct ofono_dbus_queue *q,
 	}
 
 	/* De-queue one request */
-	done = q->requests;
-	next = done->next;
-	q->requests = next;
-	done->next = NULL;
+	done = __ofono_dbus_queue_pop(q);
 
 	/* Interpret NULL reply as a cancel */
 	if (!reply)
@@ -251,8 +359,7 @@ void __ofono_dbus_queue_reply_all_fn_param(struct ofono_dbus_queue *q,
 	data = req->data;
 
 	/* De-queue the first request */
-	q->requests = req->next;
-	req->next = NULL;
+	__ofono_dbus_queue_pop(q);
 
 	/* Send the reply and free the request */
 	__ofono_dbus_queue_req_complete(req, fn, param);
@@ -24,10 +24,25 @@ struct ofono_dbus_queue;
 typedef DBusMessage * (* ofono_dbus_cb_t) (DBusMessage *msg, void *data);
 typedef DBusMessage * (* ofono_dbus_reply_cb_t) (DBusMessage *msg);
 
+/*
+ * Waiting requests are submitted in order of priority, FIFO within the
+ * same priority. The request being processed is never preempted.
+ */
+enum ofono_dbus_queue_priority {
+	OFONO_DBUS_QUEUE_PRIORITY_BACKGROUND = -1,
+	OFONO_DBUS_QUEUE_PRIORITY_DEFAULT = 0,
+	OFONO_DBUS_QUEUE_PRIORITY_INTERACTIVE = 1
+};
+
 struct ofono_dbus_queue *__ofono_dbus_queue_new(void);
 void __ofono_dbus_queue_free(struct ofono_dbus_queue *q);
 void __ofono_dbus_queue_request(struct ofono_dbus_queue *q,
 			ofono_dbus_cb_t fn, DBusMessage *msg, void *data);
+/* Requests still waiting after timeout_ms (if non-zero) get TimedOut */
+void __ofono_dbus_queue_request_full(struct ofono_dbus_queue *q,
+			ofono_dbus_cb_t fn, DBusMessage *msg, void *data,
+			enum ofono_dbus_queue_priority priority,
+			unsigned int timeout_ms);
 ofono_bool_t __ofono_dbus_queue_pending(struct ofono_dbus_queue *q);
 ofono_bool_t __ofono_dbus_queue_set_pending(struct ofono_dbus_queue *q,
 						DBusMessage *msg);
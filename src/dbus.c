@@ -23,6 +23,7 @@
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <glib.h>
 #include <errno.h>
 #include <gdbus.h>
@@ -32,6 +33,34 @@
 #define OFONO_ERROR_INTERFACE "org.ofono.Error"
 
 static DBusConnection *g_connection;
+static guint stats_timeout;
+
+/*
+ * Pre-marshalled GetProperties replies, keyed by "path:interface". An
+ * entry is dropped as soon as a property change is signalled for that
+ * object and rebuilt by the next GetProperties.
+ */
+static GHashTable *property_cache;
+
+struct batched_property {
+	char *name;
+	int type;
+	DBusBasicValue value;
+};
+
+/*
+ * Property changes made within one main loop iteration, emitted from an
+ * idle callback as a single PropertiesChanged signal (the last value of
+ * each property wins). The legacy PropertyChanged signals are not held
+ * back, they are sent as the changes are made.
+ */
+struct ofono_dbus_property_batch {
+	DBusConnection *conn;
+	char *path;
+	char *interface;
+	GPtrArray *props;
+	guint idle_id;
+};
 
 struct error_mapping_entry {
 	int error;
@@ -218,6 +247,8 @@ DBusMessage *ofono_dbus_signal_new_property_changed(const char *path,
 	DBusMessage *signal;
 	DBusMessageIter iter;
 
+	__ofono_dbus_cached_properties_invalidate(path, interface);
+
 	signal = dbus_message_new_signal(path, interface, "PropertyChanged");
 	if (signal == NULL)
 		return NULL;
@@ -231,14 +262,275 @@ DBusMessage *ofono_dbus_signal_new_property_changed(const char *path,
 	return signal;
 }
 
+static gboolean is_string_type(int type)
+{
+	return type == DBUS_TYPE_STRING || type == DBUS_TYPE_OBJECT_PATH ||
+						type == DBUS_TYPE_SIGNATURE;
+}
+
+static size_t basic_type_size(int type)
+{
+	switch (type) {
+	case DBUS_TYPE_BYTE:
+		return 1;
+	case DBUS_TYPE_INT16:
+	case DBUS_TYPE_UINT16:
+		return 2;
+	case DBUS_TYPE_BOOLEAN:
+	case DBUS_TYPE_INT32:
+	case DBUS_TYPE_UINT32:
+	case DBUS_TYPE_UNIX_FD:
+		return 4;
+	default:
+		return 8;
+	}
+}
+
+static void batched_property_free(gpointer data)
+{
+	struct batched_property *prop = data;
+
+	if (is_string_type(prop->type))
+		g_free(prop->value.str);
+
+	g_free(prop->name);
+	g_free(prop);
+}
+
+static void property_batch_flush(struct ofono_dbus_property_batch *batch)
+{
+	DBusMessage *signal;
+	DBusMessageIter iter, dict;
+	unsigned int i;
+
+	if (batch->idle_id) {
+		g_source_remove(batch->idle_id);
+		batch->idle_id = 0;
+	}
+
+	if (batch->props->len == 0)
+		return;
+
+	signal = dbus_message_new_signal(batch->path, batch->interface,
+						"PropertiesChanged");
+	if (signal) {
+		dbus_message_iter_init_append(signal, &iter);
+		dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+					OFONO_PROPERTIES_ARRAY_SIGNATURE,
+					&dict);
+
+		for (i = 0; i < batch->props->len; i++) {
+			struct batched_property *prop = batch->props->pdata[i];
+
+			ofono_dbus_dict_append(&dict, prop->name, prop->type,
+							&prop->value);
+		}
+
+		dbus_message_iter_close_container(&iter, &dict);
+		g_dbus_send_message(batch->conn, signal);
+	}
+
+	g_ptr_array_set_size(batch->props, 0);
+}
+
+static gboolean property_batch_idle_cb(gpointer user_data)
+{
+	struct ofono_dbus_property_batch *batch = user_data;
+
+	batch->idle_id = 0;
+	property_batch_flush(batch);
+
+	return FALSE;
+}
+
+static void property_batch_add(struct ofono_dbus_property_batch *batch,
+				DBusConnection *conn, const char *name,
+				int type, const void *value)
+{
+	struct batched_property *prop = NULL;
+	unsigned int i;
+
+	if (batch->conn != conn) {
+		property_batch_flush(batch);
+
+		if (batch->conn)
+			dbus_connection_unref(batch->conn);
+
+		batch->conn = dbus_connection_ref(conn);
+	}
+
+	for (i = 0; i < batch->props->len; i++) {
+		struct batched_property *p = batch->props->pdata[i];
+
+		if (g_str_equal(p->name, name)) {
+			prop = p;
+			break;
+		}
+	}
+
+	if (prop == NULL) {
+		prop = g_new0(struct batched_property, 1);
+		prop->name = g_strdup(name);
+		g_ptr_array_add(batch->props, prop);
+	} else if (is_string_type(prop->type)) {
+		g_free(prop->value.str);
+	}
+
+	prop->type = type;
+
+	memset(&prop->value, 0, sizeof(prop->value));
+
+	if (is_string_type(type))
+		prop->value.str = g_strdup(*(const char **) value);
+	else
+		memcpy(&prop->value, value, basic_type_size(type));
+
+	if (batch->idle_id == 0)
+		batch->idle_id = g_idle_add(property_batch_idle_cb, batch);
+}
+
+struct ofono_dbus_property_batch *__ofono_dbus_property_batch_new(
+						const char *path,
+						const char *interface)
+{
+	struct ofono_dbus_property_batch *batch;
+
+	if (path == NULL || interface == NULL)
+		return NULL;
+
+	batch = g_new0(struct ofono_dbus_property_batch, 1);
+	batch->path = g_strdup(path);
+	batch->interface = g_strdup(interface);
+	batch->props = g_ptr_array_new_with_free_func(batched_property_free);
+
+	return batch;
+}
+
+void __ofono_dbus_property_batch_flush(struct ofono_dbus_property_batch *batch)
+{
+	if (batch)
+		property_batch_flush(batch);
+}
+
+void __ofono_dbus_property_batch_free(struct ofono_dbus_property_batch *batch)
+{
+	if (batch == NULL)
+		return;
+
+	property_batch_flush(batch);
+
+	if (batch->conn)
+		dbus_connection_unref(batch->conn);
+
+	g_ptr_array_free(batch->props, TRUE);
+	g_free(batch->path);
+	g_free(batch->interface);
+	g_free(batch);
+}
+
+int __ofono_dbus_property_batch_changed(
+				struct ofono_dbus_property_batch *batch,
+				DBusConnection *conn, const char *name,
+				int type, const void *value)
+{
+	int err;
+
+	err = ofono_dbus_signal_property_changed(conn, batch->path,
+						batch->interface, name,
+						type, value);
+	property_batch_add(batch, conn, name, type, value);
+
+	return err;
+}
+
+DBusMessage *__ofono_dbus_cached_properties_reply(DBusMessage *msg,
+					const char *interface,
+					ofono_dbus_append_dict_func append,
+					void *data)
+{
+	const char *path = dbus_message_get_path(msg);
+	DBusMessage *cached = NULL;
+	DBusMessage *reply;
+	DBusMessageIter iter;
+	DBusMessageIter dict;
+	char *key;
+
+	key = g_strconcat(path, ":", interface, NULL);
+
+	if (property_cache)
+		cached = g_hash_table_lookup(property_cache, key);
+
+	if (cached) {
+		g_free(key);
+
+		/*
+		 * The copy takes the marshalled body as is, only the reply
+		 * header fields need to be pointed at the new caller.
+		 */
+		reply = dbus_message_copy(cached);
+		if (reply == NULL)
+			return NULL;
+
+		dbus_message_set_reply_serial(reply,
+					dbus_message_get_serial(msg));
+		dbus_message_set_destination(reply,
+					dbus_message_get_sender(msg));
+
+		return reply;
+	}
+
+	reply = dbus_message_new_method_return(msg);
+	if (reply == NULL) {
+		g_free(key);
+		return NULL;
+	}
+
+	dbus_message_iter_init_append(reply, &iter);
+
+	dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+					OFONO_PROPERTIES_ARRAY_SIGNATURE,
+					&dict);
+	append(&dict, data);
+	dbus_message_iter_close_container(&iter, &dict);
+
+	cached = dbus_message_copy(reply);
+	if (cached == NULL) {
+		g_free(key);
+		return reply;
+	}
+
+	if (property_cache == NULL)
+		property_cache = g_hash_table_new_full(g_str_hash, g_str_equal,
+				g_free, (GDestroyNotify) dbus_message_unref);
+
+	g_hash_table_replace(property_cache, key, cached);
+
+	return reply;
+}
+
+void __ofono_dbus_cached_properties_invalidate(const char *path,
+						const char *interface)
+{
+	char *key;
+
+	if (property_cache == NULL || path == NULL || interface == NULL)
+		return;
+
+	key = g_strconcat(path, ":", interface, NULL);
+	g_hash_table_remove(property_cache, key);
+	g_free(key);
+}
+
 int ofono_dbus_signal_property_changed(DBusConnection *conn,
 					const char *path,
 					const char *interface,
 					const char *name,
 					int type, const void *value)
 {
-	DBusMessage *signal = ofono_dbus_signal_new_property_changed(path,
-						interface, name, type, value);
+	DBusMessage *signal;
+
+	signal = ofono_dbus_signal_new_property_changed(path, interface,
+							name, type, value);
 
 	if (signal == NULL) {
 		ofono_error("Unable to allocate new %s.PropertyChanged signal",
@@ -259,6 +551,8 @@ int ofono_dbus_signal_array_property_changed(DBusConnection *conn,
 	DBusMessage *signal;
 	DBusMessageIter iter;
 
+	__ofono_dbus_cached_properties_invalidate(path, interface);
+
 	signal = dbus_message_new_signal(path, interface, "PropertyChanged");
 	if (signal == NULL) {
 		ofono_error("Unable to allocate new %s.PropertyChanged signal",
@@ -285,6 +579,8 @@ int ofono_dbus_signal_dict_property_changed(DBusConnection *conn,
 	DBusMessage *signal;
 	DBusMessageIter iter;
 
+	__ofono_dbus_cached_properties_invalidate(path, interface);
+
 	signal = dbus_message_new_signal(path, interface, "PropertyChanged");
 	if (signal == NULL) {
 		ofono_error("Unable to allocate new %s.PropertyChanged signal",
@@ -502,6 +798,60 @@ static void dbus_gsm_set_connection(DBusConnection *conn)
 	g_connection = conn;
 }
 
+static void dbus_stats_log(const GDBusStatistics *stats, void *user_data)
+{
+	if (stats->signal) {
+		ofono_info("D-Bus signal %s.%s: %u", stats->interface,
+					stats->member, stats->count);
+		return;
+	}
+
+	if (stats->dropped)
+		ofono_info("D-Bus method %s.%s: %u calls released without"
+				" a reply", stats->interface, stats->member,
+				stats->dropped);
+
+	if (stats->count == 0)
+		return;
+
+	ofono_info("D-Bus method %s.%s: %u calls (%u errors, %u deferred),"
+			" avg %" G_GUINT64_FORMAT " us,"
+			" max %" G_GUINT64_FORMAT " us",
+			stats->interface, stats->member, stats->count,
+			stats->errors, stats->deferred,
+			stats->total_time / stats->count, stats->max_time);
+}
+
+static void dbus_stats_log_sender(const char *sender, unsigned int count,
+							void *user_data)
+{
+	ofono_info("D-Bus client %s: %u calls", sender, count);
+}
+
+static void dbus_stats_dump(void)
+{
+	g_dbus_foreach_statistics(dbus_stats_log, NULL);
+	g_dbus_foreach_sender_statistics(dbus_stats_log_sender, NULL);
+}
+
+static gboolean dbus_stats_timeout_cb(gpointer user_data)
+{
+	dbus_stats_dump();
+
+	return TRUE;
+}
+
+void __ofono_dbus_stats_enable(unsigned int interval)
+{
+	g_dbus_set_flags(g_dbus_get_flags() | G_DBUS_FLAG_ENABLE_STATISTICS);
+
+	if (stats_timeout)
+		g_source_remove(stats_timeout);
+
+	stats_timeout = g_timeout_add_seconds(interval, dbus_stats_timeout_cb,
+									NULL);
+}
+
 int __ofono_dbus_init(DBusConnection *conn)
 {
 	dbus_gsm_set_connection(conn);
@@ -513,6 +863,21 @@ void __ofono_dbus_cleanup(void)
 {
 	DBusConnection *conn = ofono_dbus_get_connection();
 
+	if (stats_timeout) {
+		g_source_remove(stats_timeout);
+		stats_timeout = 0;
+
+		dbus_stats_dump();
+		g_dbus_set_flags(g_dbus_get_flags() &
+					~G_DBUS_FLAG_ENABLE_STATISTICS);
+		g_dbus_reset_statistics();
+	}
+
+	if (property_cache) {
+		g_hash_table_destroy(property_cache);
+		property_cache = NULL;
+	}
+
 	if (conn == NULL || !dbus_connection_get_is_connected(conn))
 		return;
 
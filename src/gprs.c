@@ -506,6 +506,9 @@ static void signal_settings(struct pri_context *ctx, const char *prop,
 	struct context_settings *settings;
 	const char *interface;
 
+	__ofono_dbus_cached_properties_invalidate(path,
+					OFONO_CONNECTION_CONTEXT_INTERFACE);
+
 	signal = dbus_message_new_signal(path,
 					OFONO_CONNECTION_CONTEXT_INTERFACE,
 					"PropertyChanged");
@@ -809,27 +812,17 @@ static void append_context_properties(struct pri_context *ctx,
 	context_settings_append_ipv6_dict(settings, interface, dict);
 }
 
+static void pri_append_properties(DBusMessageIter *dict, void *data)
+{
+	append_context_properties(data, dict);
+}
+
 static DBusMessage *pri_get_properties(DBusConnection *conn,
 					DBusMessage *msg, void *data)
 {
-	struct pri_context *ctx = data;
-	DBusMessage *reply;
-	DBusMessageIter iter;
-	DBusMessageIter dict;
-
-	reply = dbus_message_new_method_return(msg);
-	if (reply == NULL)
-		return NULL;
-
-	dbus_message_iter_init_append(reply, &iter);
-
-	dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-					OFONO_PROPERTIES_ARRAY_SIGNATURE,
-					&dict);
-	append_context_properties(ctx, &dict);
-	dbus_message_iter_close_container(&iter, &dict);
-
-	return reply;
+	return __ofono_dbus_cached_properties_reply(msg,
+					OFONO_CONNECTION_CONTEXT_INTERFACE,
+					pri_append_properties, data);
 }
 
 static void pri_activate_callback(const struct ofono_error *error, void *data)
@@ -1460,6 +1453,9 @@ static gboolean context_dbus_unregister(struct pri_context *ctx)
 	strcpy(path, ctx->path);
 	l_uintset_take(ctx->gprs->used_pids, ctx->id);
 
+	__ofono_dbus_cached_properties_invalidate(path,
+					OFONO_CONNECTION_CONTEXT_INTERFACE);
+
 	return g_dbus_unregister_interface(conn, path,
 					OFONO_CONNECTION_CONTEXT_INTERFACE);
 }
@@ -135,6 +135,7 @@ static gchar *option_plugin = NULL;
 static gchar *option_noplugin = NULL;
 static gboolean option_detach = TRUE;
 static gboolean option_version = FALSE;
+static gint option_dbus_stats = 0;
 
 static gboolean parse_debug(const char *key, const char *value,
 					gpointer user_data, GError **error)
@@ -167,6 +168,9 @@ static GOptionEntry options[] = {
 	{ "nodetach", 'n', G_OPTION_FLAG_REVERSE,
 				G_OPTION_ARG_NONE, &option_detach,
 				"Don't run as daemon in background" },
+	{ "dbus-stats", 0, 0, G_OPTION_ARG_INT, &option_dbus_stats,
+				"Log D-Bus call statistics every SECONDS",
+				"SECONDS" },
 	{ "version", 'v', 0, G_OPTION_ARG_NONE, &option_version,
 				"Show version information and exit" },
 	{ NULL },
@@ -274,6 +278,9 @@ int main(int argc, char **argv)
 
 	__ofono_dbus_init(conn);
 
+	if (option_dbus_stats > 0)
+		__ofono_dbus_stats_enable(option_dbus_stats);
+
 	if (__ofono_modules_init() < 0)
 		goto fail_module_init;
 
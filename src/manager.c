@@ -80,10 +80,25 @@ static DBusMessage *manager_get_modems(DBusConnection *conn,
 	return reply;
 }
 
+static DBusMessage *manager_get_managed_objects(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	DBusMessage *reply;
+
+	reply = g_dbus_get_managed_objects(conn, msg);
+	if (reply == NULL)
+		return __ofono_error_failed(msg);
+
+	return reply;
+}
+
 static const GDBusMethodTable manager_methods[] = {
 	{ GDBUS_METHOD("GetModems",
 				NULL, GDBUS_ARGS({ "modems", "a(oa{sv})" }),
 				manager_get_modems) },
+	{ GDBUS_METHOD("GetManagedObjects",
+			NULL, GDBUS_ARGS({ "objects", "a{oa{sa{sv}}}" }),
+			manager_get_managed_objects) },
 	{ }
 };
 
@@ -62,7 +62,8 @@ struct ofono_modem {
 	char			*path;
 	enum modem_state	modem_state;
 	GSList			*atoms;
-	struct ofono_watchlist	*atom_watches;
+	struct ofono_atom	*atom_table[OFONO_ATOM_TYPE_COUNT];
+	struct ofono_watchlist	*atom_watches[OFONO_ATOM_TYPE_COUNT];
 	GSList			*interface_list;
 	GSList			*feature_list;
 	unsigned int		call_ids;
@@ -109,8 +110,18 @@ struct ofono_atom {
 	void (*unregister)(struct ofono_atom *atom);
 	void *data;
 	struct ofono_modem *modem;
+	struct ofono_atom *next;	/* Next atom of the same type */
 };
 
+/*
+ * Atom watches live in one watchlist per atom type.  The id handed out
+ * to the caller encodes the type, so that removal knows which list to
+ * look in.
+ */
+#define ATOM_WATCH_ID(type, id) ((id) * OFONO_ATOM_TYPE_COUNT + (type))
+#define ATOM_WATCH_TYPE(id) ((id) % OFONO_ATOM_TYPE_COUNT)
+#define ATOM_WATCH_ITEM_ID(id) ((id) / OFONO_ATOM_TYPE_COUNT)
+
 struct atom_watch {
 	struct ofono_watchlist_item item;
 	enum ofono_atom_type type;
@@ -207,7 +218,7 @@ struct ofono_atom *__ofono_modem_add_atom(struct ofono_modem *modem,
 {
 	struct ofono_atom *atom;
 
-	if (modem == NULL)
+	if (modem == NULL || type >= OFONO_ATOM_TYPE_COUNT)
 		return NULL;
 
 	atom = g_new0(struct ofono_atom, 1);
@@ -220,9 +231,28 @@ struct ofono_atom *__ofono_modem_add_atom(struct ofono_modem *modem,
 
 	modem->atoms = g_slist_prepend(modem->atoms, atom);
 
+	atom->next = modem->atom_table[type];
+	modem->atom_table[type] = atom;
+
 	return atom;
 }
 
+static void atom_table_remove(struct ofono_modem *modem,
+				struct ofono_atom *atom)
+{
+	struct ofono_atom **p = &modem->atom_table[atom->type];
+
+	while (*p) {
+		if (*p == atom) {
+			*p = atom->next;
+			atom->next = NULL;
+			return;
+		}
+
+		p = &(*p)->next;
+	}
+}
+
 struct ofono_atom *__ofono_modem_add_atom_offline(struct ofono_modem *modem,
 					enum ofono_atom_type type,
 					void (*destruct)(struct ofono_atom *),
@@ -256,20 +286,19 @@ static void call_watches(struct ofono_atom *atom,
 				enum ofono_atom_watch_condition cond)
 {
 	struct ofono_modem *modem = atom->modem;
-	GSList *atom_watches = modem->atom_watches->items;
-	GSList *l;
-	struct atom_watch *watch;
+	struct ofono_watchlist *watchlist = modem->atom_watches[atom->type];
+	struct ofono_watchlist_item *item;
 	ofono_atom_watch_func notify;
 
-	for (l = atom_watches; l; l = l->next) {
-		watch = l->data;
-
-		if (watch->type != atom->type)
-			continue;
+	__ofono_watchlist_dispatch_begin(watchlist);
 
-		notify = watch->item.notify;
-		notify(atom, cond, watch->item.notify_data);
+	for (item = __ofono_watchlist_first(watchlist); item;
+					item = __ofono_watchlist_next(item)) {
+		notify = item->notify;
+		notify(atom, cond, item->notify_data);
 	}
+
+	__ofono_watchlist_dispatch_end(watchlist);
 }
 
 void __ofono_atom_register(struct ofono_atom *atom,
@@ -306,10 +335,9 @@ unsigned int __ofono_modem_add_atom_watch(struct ofono_modem *modem,
 {
 	struct atom_watch *watch;
 	unsigned int id;
-	GSList *l;
 	struct ofono_atom *atom;
 
-	if (notify == NULL)
+	if (notify == NULL || type >= OFONO_ATOM_TYPE_COUNT)
 		return 0;
 
 	watch = g_new0(struct atom_watch, 1);
@@ -319,40 +347,37 @@ unsigned int __ofono_modem_add_atom_watch(struct ofono_modem *modem,
 	watch->item.destroy = destroy;
 	watch->item.notify_data = data;
 
-	id = __ofono_watchlist_add_item(modem->atom_watches,
+	id = __ofono_watchlist_add_item(modem->atom_watches[type],
 					(struct ofono_watchlist_item *)watch);
 
-	for (l = modem->atoms; l; l = l->next) {
-		atom = l->data;
-
-		if (atom->type != type || atom->unregister == NULL)
+	for (atom = modem->atom_table[type]; atom; atom = atom->next) {
+		if (atom->unregister == NULL)
 			continue;
 
 		notify(atom, OFONO_ATOM_WATCH_CONDITION_REGISTERED, data);
 	}
 
-	return id;
+	return ATOM_WATCH_ID(type, id);
 }
 
 gboolean __ofono_modem_remove_atom_watch(struct ofono_modem *modem,
 						unsigned int id)
 {
-	return __ofono_watchlist_remove_item(modem->atom_watches, id);
+	return __ofono_watchlist_remove_item(
+				modem->atom_watches[ATOM_WATCH_TYPE(id)],
+				ATOM_WATCH_ITEM_ID(id));
 }
 
 struct ofono_atom *__ofono_modem_find_atom(struct ofono_modem *modem,
 						enum ofono_atom_type type)
 {
-	GSList *l;
 	struct ofono_atom *atom;
 
-	if (modem == NULL)
+	if (modem == NULL || type >= OFONO_ATOM_TYPE_COUNT)
 		return NULL;
 
-	for (l = modem->atoms; l; l = l->next) {
-		atom = l->data;
-
-		if (atom->type == type && atom->unregister != NULL)
+	for (atom = modem->atom_table[type]; atom; atom = atom->next) {
+		if (atom->unregister != NULL)
 			return atom;
 	}
 
@@ -363,18 +388,14 @@ void __ofono_modem_foreach_atom(struct ofono_modem *modem,
 				enum ofono_atom_type type,
 				ofono_atom_func callback, void *data)
 {
-	GSList *l;
 	struct ofono_atom *atom;
+	struct ofono_atom *next;
 
-	if (modem == NULL)
+	if (modem == NULL || type >= OFONO_ATOM_TYPE_COUNT)
 		return;
 
-	for (l = modem->atoms; l; l = l->next) {
-		atom = l->data;
-
-		if (atom->type != type)
-			continue;
-
+	for (atom = modem->atom_table[type]; atom; atom = next) {
+		next = atom->next;
 		callback(atom, data);
 	}
 }
@@ -384,17 +405,14 @@ void __ofono_modem_foreach_registered_atom(struct ofono_modem *modem,
 						ofono_atom_func callback,
 						void *data)
 {
-	GSList *l;
 	struct ofono_atom *atom;
+	struct ofono_atom *next;
 
-	if (modem == NULL)
+	if (modem == NULL || type >= OFONO_ATOM_TYPE_COUNT)
 		return;
 
-	for (l = modem->atoms; l; l = l->next) {
-		atom = l->data;
-
-		if (atom->type != type)
-			continue;
+	for (atom = modem->atom_table[type]; atom; atom = next) {
+		next = atom->next;
 
 		if (atom->unregister == NULL)
 			continue;
@@ -408,6 +426,7 @@ void __ofono_atom_free(struct ofono_atom *atom)
 	struct ofono_modem *modem = atom->modem;
 
 	modem->atoms = g_slist_remove(modem->atoms, atom);
+	atom_table_remove(modem, atom);
 
 	__ofono_atom_unregister(atom);
 
@@ -437,6 +456,7 @@ static void flush_atoms(struct ofono_modem *modem, enum modem_state new_state)
 			continue;
 		}
 
+		atom_table_remove(modem, atom);
 		__ofono_atom_unregister(atom);
 
 		if (atom->destruct)
@@ -479,34 +499,42 @@ const void *__ofono_driver_builtin_find(const char *name,
 
 static void notify_online_watches(struct ofono_modem *modem)
 {
+	struct ofono_watchlist *watchlist = modem->online_watches;
 	struct ofono_watchlist_item *item;
-	GSList *l;
 	ofono_modem_online_notify_func notify;
 
-	if (modem->online_watches == NULL)
+	if (watchlist == NULL)
 		return;
 
-	for (l = modem->online_watches->items; l; l = l->next) {
-		item = l->data;
+	__ofono_watchlist_dispatch_begin(watchlist);
+
+	for (item = __ofono_watchlist_first(watchlist); item;
+					item = __ofono_watchlist_next(item)) {
 		notify = item->notify;
 		notify(modem, modem->online, item->notify_data);
 	}
+
+	__ofono_watchlist_dispatch_end(watchlist);
 }
 
 static void notify_powered_watches(struct ofono_modem *modem)
 {
+	struct ofono_watchlist *watchlist = modem->powered_watches;
 	struct ofono_watchlist_item *item;
-	GSList *l;
 	ofono_modem_powered_notify_func notify;
 
-	if (modem->powered_watches == NULL)
+	if (watchlist == NULL)
 		return;
 
-	for (l = modem->powered_watches->items; l; l = l->next) {
-		item = l->data;
+	__ofono_watchlist_dispatch_begin(watchlist);
+
+	for (item = __ofono_watchlist_first(watchlist); item;
+					item = __ofono_watchlist_next(item)) {
 		notify = item->notify;
 		notify(modem, modem->powered, item->notify_data);
 	}
+
+	__ofono_watchlist_dispatch_end(watchlist);
 }
 
 static void set_online(struct ofono_modem *modem, ofono_bool_t new_online)
@@ -621,17 +649,7 @@ void __ofono_modem_remove_powered_watch(struct ofono_modem *modem,
 
 static gboolean modem_has_sim(struct ofono_modem *modem)
 {
-	GSList *l;
-	struct ofono_atom *atom;
-
-	for (l = modem->atoms; l; l = l->next) {
-		atom = l->data;
-
-		if (atom->type == OFONO_ATOM_TYPE_SIM)
-			return TRUE;
-	}
-
-	return FALSE;
+	return modem->atom_table[OFONO_ATOM_TYPE_SIM] != NULL;
 }
 
 static gboolean modem_is_always_online(struct ofono_modem *modem)
@@ -1952,18 +1970,20 @@ gboolean __ofono_modemwatch_remove(unsigned int id)
 
 static void call_modemwatches(struct ofono_modem *modem, gboolean added)
 {
-	GSList *l;
 	struct ofono_watchlist_item *watch;
 	ofono_modemwatch_cb_t notify;
 
 	DBG("%p added:%d", modem, added);
 
-	for (l = g_modemwatches->items; l; l = l->next) {
-		watch = l->data;
+	__ofono_watchlist_dispatch_begin(g_modemwatches);
 
+	for (watch = __ofono_watchlist_first(g_modemwatches); watch;
+				watch = __ofono_watchlist_next(watch)) {
 		notify = watch->notify;
 		notify(modem, added, watch->notify_data);
 	}
+
+	__ofono_watchlist_dispatch_end(g_modemwatches);
 }
 
 static void emit_modem_added(struct ofono_modem *modem)
@@ -2014,6 +2034,7 @@ int ofono_modem_register(struct ofono_modem *modem)
 	const struct ofono_modem_driver *drv;
 	DBusConnection *conn = ofono_dbus_get_connection();
 	int r;
+	int i;
 
 	DBG("%p", modem);
 
@@ -2055,7 +2076,9 @@ int ofono_modem_register(struct ofono_modem *modem)
 	l_free(modem->driver_type);
 	modem->driver_type = NULL;
 
-	modem->atom_watches = __ofono_watchlist_new(g_free);
+	for (i = 0; i < OFONO_ATOM_TYPE_COUNT; i++)
+		modem->atom_watches[i] = __ofono_watchlist_new(g_free);
+
 	modem->online_watches = __ofono_watchlist_new(g_free);
 	modem->powered_watches = __ofono_watchlist_new(g_free);
 
@@ -2084,14 +2107,17 @@ static void emit_modem_removed(struct ofono_modem *modem)
 static void modem_unregister(struct ofono_modem *modem)
 {
 	DBusConnection *conn = ofono_dbus_get_connection();
+	int i;
 
 	DBG("%p", modem);
 
 	if (modem->powered == TRUE)
 		set_powered(modem, FALSE);
 
-	__ofono_watchlist_free(modem->atom_watches);
-	modem->atom_watches = NULL;
+	for (i = 0; i < OFONO_ATOM_TYPE_COUNT; i++) {
+		__ofono_watchlist_free(modem->atom_watches[i]);
+		modem->atom_watches[i] = NULL;
+	}
 
 	__ofono_watchlist_free(modem->online_watches);
 	modem->online_watches = NULL;
@@ -76,6 +76,7 @@ struct ofono_netreg {
 	struct ofono_atom *atom;
 	unsigned int hfp_watch;
 	unsigned int spn_watch;
+	struct ofono_dbus_property_batch *batch;
 };
 
 struct network_operator_data {
@@ -176,11 +177,41 @@ static void enforce_auto_only(struct ofono_netreg *netreg)
 	netreg->driver->register_auto(netreg, init_register, netreg);
 }
 
+/*
+ * A registration update typically changes several properties at once
+ * (Status, LocationAreaCode, CellId, Technology...).  PropertyChanged is
+ * sent right away, PropertiesChanged carries all of them once the update
+ * is done.
+ */
+static void netreg_property_changed(struct ofono_netreg *netreg,
+					const char *name, int type,
+					const void *value)
+{
+	DBusConnection *conn = ofono_dbus_get_connection();
+
+	if (netreg->batch) {
+		__ofono_dbus_property_batch_changed(netreg->batch, conn,
+							name, type, value);
+		return;
+	}
+
+	ofono_dbus_signal_property_changed(conn,
+					__ofono_atom_get_path(netreg->atom),
+					OFONO_NETWORK_REGISTRATION_INTERFACE,
+					name, type, value);
+}
+
+/* For properties which go away without a signal */
+static void netreg_properties_invalidate(struct ofono_netreg *netreg)
+{
+	__ofono_dbus_cached_properties_invalidate(
+					__ofono_atom_get_path(netreg->atom),
+					OFONO_NETWORK_REGISTRATION_INTERFACE);
+}
+
 static void set_registration_mode(struct ofono_netreg *netreg, int mode)
 {
-	DBusConnection *conn;
 	const char *strmode;
-	const char *path;
 
 	if (netreg->mode == mode)
 		return;
@@ -205,12 +236,7 @@ static void set_registration_mode(struct ofono_netreg *netreg, int mode)
 
 	strmode = registration_mode_to_string(mode);
 
-	conn = ofono_dbus_get_connection();
-	path = __ofono_atom_get_path(netreg->atom);
-
-	ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"Mode", DBUS_TYPE_STRING, &strmode);
+	netreg_property_changed(netreg, "Mode", DBUS_TYPE_STRING, &strmode);
 }
 
 static void register_callback(const struct ofono_error *error, void *data)
@@ -418,10 +444,7 @@ static void netreg_emit_operator_display_name(struct ofono_netreg *netreg)
 {
 	const char *operator = get_operator_display_name(netreg);
 
-	ofono_dbus_signal_property_changed(ofono_dbus_get_connection(),
-					__ofono_atom_get_path(netreg->atom),
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"Name", DBUS_TYPE_STRING, &operator);
+	netreg_property_changed(netreg, "Name", DBUS_TYPE_STRING, &operator);
 }
 
 static void set_network_operator_name(struct network_operator_data *opd,
@@ -774,40 +797,25 @@ static gboolean update_operator_list(struct ofono_netreg *netreg, int total,
 	return changed;
 }
 
-static DBusMessage *network_get_properties(DBusConnection *conn,
-						DBusMessage *msg, void *data)
+static void append_network_properties(DBusMessageIter *dict, void *data)
 {
 	struct ofono_netreg *netreg = data;
-	DBusMessage *reply;
-	DBusMessageIter iter;
-	DBusMessageIter dict;
-
 	const char *status = registration_status_to_string(netreg->status);
 	const char *operator;
 	const char *mode = registration_mode_to_string(netreg->mode);
 
-	reply = dbus_message_new_method_return(msg);
-	if (reply == NULL)
-		return NULL;
-
-	dbus_message_iter_init_append(reply, &iter);
-
-	dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-					OFONO_PROPERTIES_ARRAY_SIGNATURE,
-					&dict);
-
-	ofono_dbus_dict_append(&dict, "Status", DBUS_TYPE_STRING, &status);
-	ofono_dbus_dict_append(&dict, "Mode", DBUS_TYPE_STRING, &mode);
+	ofono_dbus_dict_append(dict, "Status", DBUS_TYPE_STRING, &status);
+	ofono_dbus_dict_append(dict, "Mode", DBUS_TYPE_STRING, &mode);
 
 	if (netreg->location != -1) {
 		dbus_uint16_t location = netreg->location;
-		ofono_dbus_dict_append(&dict, "LocationAreaCode",
+		ofono_dbus_dict_append(dict, "LocationAreaCode",
 					DBUS_TYPE_UINT16, &location);
 	}
 
 	if (netreg->cellid != -1) {
 		dbus_uint32_t cellid = netreg->cellid;
-		ofono_dbus_dict_append(&dict, "CellId",
+		ofono_dbus_dict_append(dict, "CellId",
 					DBUS_TYPE_UINT32, &cellid);
 	}
 
@@ -815,41 +823,46 @@ static DBusMessage *network_get_properties(DBusConnection *conn,
 		const char *technology =
 			registration_tech_to_string(netreg->technology);
 
-		ofono_dbus_dict_append(&dict, "Technology", DBUS_TYPE_STRING,
+		ofono_dbus_dict_append(dict, "Technology", DBUS_TYPE_STRING,
 					&technology);
 	}
 
 	if (netreg->current_operator) {
 		if (netreg->current_operator->mcc[0] != '\0') {
 			const char *mcc = netreg->current_operator->mcc;
-			ofono_dbus_dict_append(&dict, "MobileCountryCode",
+			ofono_dbus_dict_append(dict, "MobileCountryCode",
 						DBUS_TYPE_STRING, &mcc);
 		}
 
 		if (netreg->current_operator->mnc[0] != '\0') {
 			const char *mnc = netreg->current_operator->mnc;
-			ofono_dbus_dict_append(&dict, "MobileNetworkCode",
+			ofono_dbus_dict_append(dict, "MobileNetworkCode",
 						DBUS_TYPE_STRING, &mnc);
 		}
 	}
 
 	operator = get_operator_display_name(netreg);
-	ofono_dbus_dict_append(&dict, "Name", DBUS_TYPE_STRING, &operator);
+	ofono_dbus_dict_append(dict, "Name", DBUS_TYPE_STRING, &operator);
 
 	if (netreg->signal_strength != -1) {
 		unsigned char strength = netreg->signal_strength;
 
-		ofono_dbus_dict_append(&dict, "Strength", DBUS_TYPE_BYTE,
+		ofono_dbus_dict_append(dict, "Strength", DBUS_TYPE_BYTE,
 					&strength);
 	}
 
 	if (netreg->base_station)
-		ofono_dbus_dict_append(&dict, "BaseStation", DBUS_TYPE_STRING,
+		ofono_dbus_dict_append(dict, "BaseStation", DBUS_TYPE_STRING,
 					&netreg->base_station);
 
-	dbus_message_iter_close_container(&iter, &dict);
+}
 
-	return reply;
+static DBusMessage *network_get_properties(DBusConnection *conn,
+						DBusMessage *msg, void *data)
+{
+	return __ofono_dbus_cached_properties_reply(msg,
+					OFONO_NETWORK_REGISTRATION_INTERFACE,
+					append_network_properties, data);
 }
 
 static DBusMessage *network_register(DBusConnection *conn,
@@ -1043,27 +1056,23 @@ static const GDBusMethodTable network_registration_methods[] = {
 static const GDBusSignalTable network_registration_signals[] = {
 	{ GDBUS_SIGNAL("PropertyChanged",
 			GDBUS_ARGS({ "name", "s" }, { "value", "v" })) },
+	{ GDBUS_SIGNAL("PropertiesChanged",
+			GDBUS_ARGS({ "properties", "a{sv}" })) },
 	{ }
 };
 
 static void set_registration_status(struct ofono_netreg *netreg, int status)
 {
 	const char *str_status = registration_status_to_string(status);
-	const char *path = __ofono_atom_get_path(netreg->atom);
-	DBusConnection *conn = ofono_dbus_get_connection();
 
 	netreg->status = status;
 
-	ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"Status", DBUS_TYPE_STRING,
+	netreg_property_changed(netreg, "Status", DBUS_TYPE_STRING,
 					&str_status);
 }
 
 static void set_registration_location(struct ofono_netreg *netreg, int lac)
 {
-	DBusConnection *conn = ofono_dbus_get_connection();
-	const char *path = __ofono_atom_get_path(netreg->atom);
 	dbus_uint16_t dbus_lac = lac;
 
 	if (lac > 0xffff)
@@ -1071,53 +1080,47 @@ static void set_registration_location(struct ofono_netreg *netreg, int lac)
 
 	netreg->location = lac;
 
-	if (netreg->location == -1)
+	if (netreg->location == -1) {
+		netreg_properties_invalidate(netreg);
 		return;
+	}
 
-	ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"LocationAreaCode",
+	netreg_property_changed(netreg, "LocationAreaCode",
 					DBUS_TYPE_UINT16, &dbus_lac);
 }
 
 static void set_registration_cellid(struct ofono_netreg *netreg, int ci)
 {
-	DBusConnection *conn = ofono_dbus_get_connection();
-	const char *path = __ofono_atom_get_path(netreg->atom);
 	dbus_uint32_t dbus_ci = ci;
 
 	netreg->cellid = ci;
 
-	if (netreg->cellid == -1)
+	if (netreg->cellid == -1) {
+		netreg_properties_invalidate(netreg);
 		return;
+	}
 
-	ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"CellId", DBUS_TYPE_UINT32, &dbus_ci);
+	netreg_property_changed(netreg, "CellId", DBUS_TYPE_UINT32, &dbus_ci);
 }
 
 static void set_registration_technology(struct ofono_netreg *netreg, int tech)
 {
 	const char *tech_str = registration_tech_to_string(tech);
-	DBusConnection *conn = ofono_dbus_get_connection();
-	const char *path = __ofono_atom_get_path(netreg->atom);
 
 	netreg->technology = tech;
 
-	if (netreg->technology == -1)
+	if (netreg->technology == -1) {
+		netreg_properties_invalidate(netreg);
 		return;
+	}
 
-	ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"Technology", DBUS_TYPE_STRING,
+	netreg_property_changed(netreg, "Technology", DBUS_TYPE_STRING,
 					&tech_str);
 }
 
 void __ofono_netreg_set_base_station_name(struct ofono_netreg *netreg,
 						const char *name)
 {
-	DBusConnection *conn = ofono_dbus_get_connection();
-	const char *path = __ofono_atom_get_path(netreg->atom);
 	const char *base_station = name ? name : "";
 
 	/* Cell ID changed, but we don't have a cell name, nothing to do */
@@ -1128,12 +1131,12 @@ void __ofono_netreg_set_base_station_name(struct ofono_netreg *netreg,
 	netreg->base_station = l_strdup(name);
 
 	/* We just got unregistered, set name to NULL, but don't emit signal */
-	if (!name && !netreg->current_operator)
+	if (!name && !netreg->current_operator) {
+		netreg_properties_invalidate(netreg);
 		return;
+	}
 
-	ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"BaseStation", DBUS_TYPE_STRING,
+	netreg_property_changed(netreg, "BaseStation", DBUS_TYPE_STRING,
 					&base_station);
 }
 
@@ -1171,7 +1174,6 @@ gboolean __ofono_netreg_remove_status_watch(struct ofono_netreg *netreg,
 static void notify_status_watches(struct ofono_netreg *netreg)
 {
 	struct ofono_watchlist_item *item;
-	GSList *l;
 	ofono_netreg_status_notify_cb_t notify;
 	const char *mcc = NULL;
 	const char *mnc = NULL;
@@ -1184,13 +1186,17 @@ static void notify_status_watches(struct ofono_netreg *netreg)
 		mnc = netreg->current_operator->mnc;
 	}
 
-	for (l = netreg->status_watches->items; l; l = l->next) {
-		item = l->data;
+	__ofono_watchlist_dispatch_begin(netreg->status_watches);
+
+	for (item = __ofono_watchlist_first(netreg->status_watches); item;
+					item = __ofono_watchlist_next(item)) {
 		notify = item->notify;
 
 		notify(netreg->status, netreg->location, netreg->cellid,
 			netreg->technology, mcc, mnc, item->notify_data);
 	}
+
+	__ofono_watchlist_dispatch_end(netreg->status_watches);
 }
 
 static void reset_available(struct network_operator_data *old,
@@ -1207,9 +1213,7 @@ static void current_operator_callback(const struct ofono_error *error,
 				const struct ofono_network_operator *current,
 				void *data)
 {
-	DBusConnection *conn = ofono_dbus_get_connection();
 	struct ofono_netreg *netreg = data;
-	const char *path = __ofono_atom_get_path(netreg->atom);
 	GSList *op = NULL;
 
 	DBG("%p, %p", netreg, netreg->current_operator);
@@ -1285,18 +1289,14 @@ emit:
 	if (netreg->current_operator) {
 		if (netreg->current_operator->mcc[0] != '\0') {
 			const char *mcc = netreg->current_operator->mcc;
-			ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"MobileCountryCode",
-					DBUS_TYPE_STRING, &mcc);
+			netreg_property_changed(netreg, "MobileCountryCode",
+						DBUS_TYPE_STRING, &mcc);
 		}
 
 		if (netreg->current_operator->mnc[0] != '\0') {
 			const char *mnc = netreg->current_operator->mnc;
-			ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"MobileNetworkCode",
-					DBUS_TYPE_STRING, &mnc);
+			netreg_property_changed(netreg, "MobileNetworkCode",
+						DBUS_TYPE_STRING, &mnc);
 		}
 	}
 
@@ -1384,6 +1384,7 @@ void ofono_netreg_status_notify(struct ofono_netreg *netreg, int status,
 		__ofono_netreg_set_base_station_name(netreg, NULL);
 
 		netreg->signal_strength = -1;
+		netreg_properties_invalidate(netreg);
 	}
 
 	notify_status_watches(netreg);
@@ -1520,7 +1521,6 @@ static void notify_emulator_strength(struct ofono_atom *atom, void *data)
 
 void ofono_netreg_strength_notify(struct ofono_netreg *netreg, int strength)
 {
-	DBusConnection *conn = ofono_dbus_get_connection();
 	struct ofono_modem *modem;
 
 	if (netreg->signal_strength == strength)
@@ -1539,13 +1539,12 @@ void ofono_netreg_strength_notify(struct ofono_netreg *netreg, int strength)
 	netreg->signal_strength = strength;
 
 	if (strength != -1) {
-		const char *path = __ofono_atom_get_path(netreg->atom);
 		unsigned char strength_byte = netreg->signal_strength;
 
-		ofono_dbus_signal_property_changed(conn, path,
-					OFONO_NETWORK_REGISTRATION_INTERFACE,
-					"Strength", DBUS_TYPE_BYTE,
+		netreg_property_changed(netreg, "Strength", DBUS_TYPE_BYTE,
 					&strength_byte);
+	} else {
+		netreg_properties_invalidate(netreg);
 	}
 
 	modem = __ofono_atom_get_modem(netreg->atom);
@@ -1803,6 +1802,10 @@ static void netreg_unregister(struct ofono_atom *atom)
 
 	netreg->sim = NULL;
 
+	__ofono_dbus_property_batch_free(netreg->batch);
+	netreg->batch = NULL;
+	__ofono_dbus_cached_properties_invalidate(path,
+					OFONO_NETWORK_REGISTRATION_INTERFACE);
 	g_dbus_unregister_interface(conn, path,
 					OFONO_NETWORK_REGISTRATION_INTERFACE);
 	ofono_modem_remove_interface(modem,
@@ -2015,6 +2018,9 @@ void ofono_netreg_register(struct ofono_netreg *netreg)
 
 	netreg->status_watches = __ofono_watchlist_new(g_free);
 
+	netreg->batch = __ofono_dbus_property_batch_new(path,
+					OFONO_NETWORK_REGISTRATION_INTERFACE);
+
 	ofono_modem_add_interface(modem, OFONO_NETWORK_REGISTRATION_INTERFACE);
 
 	if (netreg->driver->registration_status != NULL)
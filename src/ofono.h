@@ -45,6 +45,7 @@ void __ofono_log_enable(struct ofono_debug_desc *start,
 
 int __ofono_dbus_init(DBusConnection *conn);
 void __ofono_dbus_cleanup(void);
+void __ofono_dbus_stats_enable(unsigned int interval);
 
 DBusMessage *__ofono_error_invalid_args(DBusMessage *msg);
 DBusMessage *__ofono_error_invalid_format(DBusMessage *msg);
@@ -74,16 +75,44 @@ DBusMessage *__ofono_error_from_error(const struct ofono_error *error,
 
 void __ofono_dbus_pending_reply(DBusMessage **msg, DBusMessage *reply);
 
+struct ofono_dbus_property_batch;
+
+struct ofono_dbus_property_batch *__ofono_dbus_property_batch_new(
+						const char *path,
+						const char *interface);
+void __ofono_dbus_property_batch_flush(struct ofono_dbus_property_batch *batch);
+void __ofono_dbus_property_batch_free(struct ofono_dbus_property_batch *batch);
+int __ofono_dbus_property_batch_changed(
+				struct ofono_dbus_property_batch *batch,
+				DBusConnection *conn, const char *name,
+				int type, const void *value);
+
+typedef void (*ofono_dbus_append_dict_func)(DBusMessageIter *dict,
+							void *data);
+
+DBusMessage *__ofono_dbus_cached_properties_reply(DBusMessage *msg,
+					const char *interface,
+					ofono_dbus_append_dict_func append,
+					void *data);
+void __ofono_dbus_cached_properties_invalidate(const char *path,
+						const char *interface);
+
 struct ofono_watchlist_item {
 	unsigned int id;
 	void *notify;
 	void *notify_data;
 	ofono_destroy_func destroy;
+	struct ofono_watchlist_item *prev;
+	struct ofono_watchlist_item *next;
 };
 
 struct ofono_watchlist {
 	int next_id;
-	GSList *items;
+	struct ofono_watchlist_item *items;
+	GHashTable *index;
+	unsigned int n_items;
+	unsigned int dispatching;
+	GSList *removed;
 	ofono_destroy_func destroy;
 };
 
@@ -93,6 +122,20 @@ unsigned int __ofono_watchlist_add_item(struct ofono_watchlist *watchlist,
 gboolean __ofono_watchlist_remove_item(struct ofono_watchlist *watchlist,
 					unsigned int id);
 void __ofono_watchlist_free(struct ofono_watchlist *watchlist);
+gboolean __ofono_watchlist_is_empty(struct ofono_watchlist *watchlist);
+
+/*
+ * Notifying watches must be bracketed by dispatch_begin/dispatch_end.
+ * Items removed in between are not notified anymore, but stay linked
+ * until the outermost dispatch_end so that iteration remains valid.
+ * The watchlist itself must not be freed while a dispatch is ongoing.
+ */
+void __ofono_watchlist_dispatch_begin(struct ofono_watchlist *watchlist);
+void __ofono_watchlist_dispatch_end(struct ofono_watchlist *watchlist);
+struct ofono_watchlist_item *__ofono_watchlist_first(
+					struct ofono_watchlist *watchlist);
+struct ofono_watchlist_item *__ofono_watchlist_next(
+					struct ofono_watchlist_item *item);
 
 struct ofono_module_desc {
 	const char *name;
@@ -176,6 +219,7 @@ enum ofono_atom_type {
 	OFONO_ATOM_TYPE_NETMON,
 	OFONO_ATOM_TYPE_LTE,
 	OFONO_ATOM_TYPE_IMS,
+	OFONO_ATOM_TYPE_COUNT,	/* Must be last */
 };
 
 enum ofono_atom_watch_condition {
@@ -28,6 +28,8 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
 
 #include <glib.h>
 #include <gdbus.h>
@@ -41,6 +43,13 @@
 
 #define PHONEBOOK_FLAG_CACHED 0x1
 
+/* vCards are handed to the stream reader in chunks of about this size */
+#define PHONEBOOK_STREAM_CHUNK 4096
+/* Reading from the driver pauses while the reader is this far behind */
+#define PHONEBOOK_STREAM_HIGH_WATER (16 * PHONEBOOK_STREAM_CHUNK)
+/* A reader that takes nothing for this long is dropped, in seconds */
+#define PHONEBOOK_STREAM_STALL_TIMEOUT 30
+
 enum phonebook_number_type {
 	TEL_TYPE_HOME,
 	TEL_TYPE_MOBILE,
@@ -56,6 +65,16 @@ struct ofono_phonebook {
 	struct l_string *vcards_builder; /* entries with vcard 3.0 format */
 	char *cached_vcards;
 	GSList *merge_list; /* cache the entries that may need a merge */
+	bool stream_export; /* export in progress for ImportStream */
+	bool stream_done; /* nothing left to queue on stream_io */
+	GIOChannel *stream_io;
+	guint stream_watch;
+	guint stream_stall_source;
+	GByteArray *stream_buf; /* vCards not yet taken by the reader */
+	const char *stream_replay; /* unsent part of cached_vcards */
+	ofono_phonebook_ready_cb_t stream_ready_cb; /* paused driver */
+	void *stream_ready_data;
+	ofono_destroy_func stream_ready_destroy;
 	const struct ofono_phonebook_driver *driver;
 	void *driver_data;
 	struct ofono_atom *atom;
@@ -79,6 +98,187 @@ struct phonebook_person {
 static const char *storage_support[] = { "SM", "ME", NULL };
 static void export_phonebook(struct ofono_phonebook *pb);
 
+static void phonebook_stream_close(struct ofono_phonebook *pb)
+{
+	if (pb->stream_watch) {
+		g_source_remove(pb->stream_watch);
+		pb->stream_watch = 0;
+	}
+
+	if (pb->stream_stall_source) {
+		g_source_remove(pb->stream_stall_source);
+		pb->stream_stall_source = 0;
+	}
+
+	if (pb->stream_io) {
+		g_io_channel_unref(pb->stream_io);
+		pb->stream_io = NULL;
+	}
+
+	if (pb->stream_buf) {
+		g_byte_array_free(pb->stream_buf, TRUE);
+		pb->stream_buf = NULL;
+	}
+
+	pb->stream_replay = NULL;
+}
+
+static gboolean stream_writable_cb(GIOChannel *io, GIOCondition cond,
+							gpointer user_data);
+static gboolean stream_stalled_cb(gpointer user_data);
+
+/*
+ * Hands as much of the queued vCards to the reader as it takes without
+ * blocking.  Only what the reader has not consumed yet stays queued, and
+ * when replaying the cache it is refilled one chunk at a time.
+ */
+static void phonebook_stream_write(struct ofono_phonebook *pb)
+{
+	int fd;
+
+	if (pb->stream_io == NULL)
+		return;
+
+	fd = g_io_channel_unix_get_fd(pb->stream_io);
+
+	while (1) {
+		ssize_t written;
+
+		if (pb->stream_buf->len == 0 && pb->stream_replay) {
+			size_t len = strnlen(pb->stream_replay,
+						PHONEBOOK_STREAM_CHUNK);
+
+			g_byte_array_append(pb->stream_buf,
+				(const guint8 *) pb->stream_replay, len);
+			pb->stream_replay += len;
+
+			if (*pb->stream_replay == '\0') {
+				pb->stream_replay = NULL;
+				pb->stream_done = true;
+			}
+		}
+
+		if (pb->stream_buf->len == 0)
+			break;
+
+		written = send(fd, pb->stream_buf->data, pb->stream_buf->len,
+					MSG_DONTWAIT | MSG_NOSIGNAL);
+		if (written < 0) {
+			if (errno == EINTR)
+				continue;
+
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+
+			DBG("stream reader gone: %s", strerror(errno));
+			phonebook_stream_close(pb);
+			return;
+		}
+
+		g_byte_array_remove_range(pb->stream_buf, 0, written);
+	}
+
+	if (pb->stream_buf->len == 0) {
+		/* Closing our end signals EOF to the reader */
+		if (pb->stream_done)
+			phonebook_stream_close(pb);
+
+		return;
+	}
+
+	if (pb->stream_watch == 0)
+		pb->stream_watch = g_io_add_watch(pb->stream_io,
+					G_IO_OUT | G_IO_ERR | G_IO_HUP |
+					G_IO_NVAL, stream_writable_cb, pb);
+
+	if (pb->stream_stall_source == 0)
+		pb->stream_stall_source = g_timeout_add_seconds(
+					PHONEBOOK_STREAM_STALL_TIMEOUT,
+					stream_stalled_cb, pb);
+}
+
+/* Lets a paused driver go on once the reader has caught up or left */
+static void phonebook_stream_resume(struct ofono_phonebook *pb)
+{
+	ofono_phonebook_ready_cb_t cb = pb->stream_ready_cb;
+
+	if (cb == NULL)
+		return;
+
+	if (pb->stream_io && pb->stream_buf->len > PHONEBOOK_STREAM_CHUNK)
+		return;
+
+	DBG("resuming the export");
+
+	pb->stream_ready_cb = NULL;
+	pb->stream_ready_destroy = NULL;
+	cb(pb->stream_ready_data);
+}
+
+static gboolean stream_stalled_cb(gpointer user_data)
+{
+	struct ofono_phonebook *pb = user_data;
+
+	pb->stream_stall_source = 0;
+
+	ofono_warn("Phonebook stream reader stalled, dropping it");
+
+	phonebook_stream_close(pb);
+	phonebook_stream_resume(pb);
+
+	return FALSE;
+}
+
+static gboolean stream_writable_cb(GIOChannel *io, GIOCondition cond,
+							gpointer user_data)
+{
+	struct ofono_phonebook *pb = user_data;
+
+	pb->stream_watch = 0;
+
+	/* The reader is taking data, give it another period */
+	if (pb->stream_stall_source) {
+		g_source_remove(pb->stream_stall_source);
+		pb->stream_stall_source = 0;
+	}
+
+	if (cond & (G_IO_ERR | G_IO_HUP | G_IO_NVAL))
+		phonebook_stream_close(pb);
+	else
+		phonebook_stream_write(pb);
+
+	phonebook_stream_resume(pb);
+
+	return FALSE;
+}
+
+/* Moves the vCards built so far to the stream once a chunk is ready */
+static void phonebook_stream_flush(struct ofono_phonebook *pb, bool force)
+{
+	unsigned int len = l_string_length(pb->vcards_builder);
+	char *vcards;
+
+	if (len == 0)
+		return;
+
+	if (!force && len < PHONEBOOK_STREAM_CHUNK)
+		return;
+
+	vcards = l_string_unwrap(pb->vcards_builder);
+	pb->vcards_builder = l_string_new(PHONEBOOK_STREAM_CHUNK);
+
+	/* The reader went away, the export still has to run its course */
+	if (pb->stream_io == NULL) {
+		l_free(vcards);
+		return;
+	}
+
+	g_byte_array_append(pb->stream_buf, (const guint8 *) vcards, len);
+	l_free(vcards);
+
+	phonebook_stream_write(pb);
+}
+
 /* according to RFC 2425, the output string may need folding */
 static void vcard_printf(struct l_string *str, const char *fmt, ...)
 {
@@ -416,6 +616,31 @@ void ofono_phonebook_entry(struct ofono_phonebook *phonebook, int index,
 	vcard_printf_email(phonebook->vcards_builder, email);
 	vcard_printf_sip_uri(phonebook->vcards_builder, sip_uri);
 	vcard_printf_end(phonebook->vcards_builder);
+
+	if (phonebook->stream_export)
+		phonebook_stream_flush(phonebook, false);
+}
+
+void ofono_phonebook_when_ready(struct ofono_phonebook *pb,
+				ofono_phonebook_ready_cb_t cb, void *data,
+				ofono_destroy_func destroy)
+{
+	if (pb->stream_io == NULL ||
+			pb->stream_buf->len < PHONEBOOK_STREAM_HIGH_WATER) {
+		cb(data);
+		return;
+	}
+
+	DBG("stream reader is behind, pausing the export");
+
+	pb->stream_ready_cb = cb;
+	pb->stream_ready_data = data;
+	pb->stream_ready_destroy = destroy;
+}
+
+static void export_phonebook_next(void *data)
+{
+	export_phonebook(data);
 }
 
 static void export_phonebook_cb(const struct ofono_error *error, void *data)
@@ -433,8 +658,12 @@ static void export_phonebook_cb(const struct ofono_error *error, void *data)
 	g_slist_free_full(phonebook->merge_list, destroy_merged_entry);
 	phonebook->merge_list = NULL;
 
+	if (phonebook->stream_export)
+		phonebook_stream_flush(phonebook, true);
+
 	phonebook->storage_index++;
-	export_phonebook(phonebook);
+	ofono_phonebook_when_ready(phonebook, export_phonebook_next,
+					phonebook, NULL);
 }
 
 static void export_phonebook(struct ofono_phonebook *phonebook)
@@ -448,6 +677,17 @@ static void export_phonebook(struct ofono_phonebook *phonebook)
 		return;
 	}
 
+	/* Streamed vCards are not kept, memory stays bounded */
+	if (phonebook->stream_export) {
+		phonebook_stream_flush(phonebook, true);
+		l_string_free(phonebook->vcards_builder);
+		phonebook->vcards_builder = NULL;
+		phonebook->stream_export = false;
+		phonebook->stream_done = true;
+		phonebook_stream_write(phonebook);
+		return;
+	}
+
 	phonebook->cached_vcards = l_string_unwrap(phonebook->vcards_builder);
 	phonebook->vcards_builder = NULL;
 	phonebook->flags |= PHONEBOOK_FLAG_CACHED;
@@ -469,6 +709,9 @@ static DBusMessage *import_entries(DBusConnection *conn, DBusMessage *msg,
 	if (phonebook->pending)
 		return  __ofono_error_busy(phonebook->pending);
 
+	if (phonebook->stream_export)
+		return __ofono_error_busy(msg);
+
 	if (phonebook->flags & PHONEBOOK_FLAG_CACHED)
 		return generate_export_entries_reply(phonebook, msg);
 
@@ -481,10 +724,67 @@ static DBusMessage *import_entries(DBusConnection *conn, DBusMessage *msg,
 	return NULL;
 }
 
+static DBusMessage *import_stream(DBusConnection *conn, DBusMessage *msg,
+					void *data)
+{
+	struct ofono_phonebook *phonebook = data;
+	DBusMessage *reply;
+	int fds[2];
+
+	if (phonebook->pending || phonebook->stream_export ||
+			phonebook->stream_io)
+		return __ofono_error_busy(msg);
+
+	if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0)
+		return __ofono_error_failed(msg);
+
+	reply = dbus_message_new_method_return(msg);
+	if (reply == NULL ||
+			!dbus_message_append_args(reply, DBUS_TYPE_UNIX_FD,
+						&fds[1], DBUS_TYPE_INVALID)) {
+		if (reply)
+			dbus_message_unref(reply);
+
+		close(fds[0]);
+		close(fds[1]);
+		return __ofono_error_failed(msg);
+	}
+
+	/* The message holds its own duplicate of the reader's end */
+	close(fds[1]);
+
+	phonebook->stream_io = g_io_channel_unix_new(fds[0]);
+	g_io_channel_set_close_on_unref(phonebook->stream_io, TRUE);
+	phonebook->stream_buf = g_byte_array_sized_new(PHONEBOOK_STREAM_CHUNK);
+	phonebook->stream_done = false;
+
+	if (phonebook->flags & PHONEBOOK_FLAG_CACHED) {
+		phonebook->stream_replay = phonebook->cached_vcards;
+
+		if (*phonebook->stream_replay == '\0') {
+			phonebook->stream_replay = NULL;
+			phonebook->stream_done = true;
+		}
+
+		phonebook_stream_write(phonebook);
+		return reply;
+	}
+
+	phonebook->stream_export = true;
+	phonebook->vcards_builder = l_string_new(PHONEBOOK_STREAM_CHUNK);
+	phonebook->storage_index = 0;
+	export_phonebook(phonebook);
+
+	return reply;
+}
+
 static const GDBusMethodTable phonebook_methods[] = {
 	{ GDBUS_ASYNC_METHOD("Import",
 			NULL, GDBUS_ARGS({ "entries", "s" }),
 			import_entries) },
+	{ GDBUS_METHOD("ImportStream",
+			NULL, GDBUS_ARGS({ "fd", "h" }),
+			import_stream) },
 	{ }
 };
 
@@ -515,6 +815,11 @@ static void phonebook_remove(struct ofono_atom *atom)
 	if (pb->driver && pb->driver->remove)
 		pb->driver->remove(pb);
 
+	/* A paused driver request is never going to be resumed */
+	if (pb->stream_ready_cb && pb->stream_ready_destroy)
+		pb->stream_ready_destroy(pb->stream_ready_data);
+
+	phonebook_stream_close(pb);
 	l_string_free(pb->vcards_builder);
 	l_free(pb->cached_vcards);
 	g_free(pb);
@@ -69,6 +69,22 @@ struct ofono_sim_aid_session {
 	enum session_state state;
 };
 
+enum sim_init_stage {
+	SIM_INIT_EFPHASE = 0,
+	SIM_INIT_EFAD,
+	SIM_INIT_CPHS_INFORMATION,
+	SIM_INIT_EFUST,
+	SIM_INIT_EFEST,
+	SIM_INIT_EFSST,
+	SIM_INIT_EFADN_INFO,
+	SIM_INIT_EFBDN_INFO,
+	SIM_INIT_STAGES,
+};
+
+#define SIM_INIT_ALL_STAGES ((1 << SIM_INIT_STAGES) - 1)
+/* Bounds the simfs queue, the driver still gets one request at a time */
+#define SIM_INIT_MAX_PENDING_READS 4
+
 struct ofono_sim {
 	/* Contents of the SIM file system, in rough initialization order */
 	char *iccid;
@@ -148,6 +164,21 @@ struct ofono_sim {
 	bool sdn_ready : 1;
 	bool initialized : 1;
 	bool wait_initialized : 1;
+	bool init_scheduling : 1;
+	bool init_halted : 1;
+	bool snapshot_applied : 1;
+
+	/* Parsed state saved by the previous boot with this card */
+	struct sim_fs_snapshot *snapshot;
+	unsigned int snapshot_reset_source;
+
+	/* Post-PIN initialization, see sim_init_stages */
+	unsigned int init_issued;
+	unsigned int init_done;
+	unsigned int init_pending;
+	gint64 init_start;
+	gint64 init_stage_start[SIM_INIT_STAGES];
+	gint64 inserted_time;
 };
 
 struct cached_pin {
@@ -187,6 +218,9 @@ static const char *const passwd_name[] = {
 };
 
 static void sim_own_numbers_update(struct ofono_sim *sim);
+static void sim_init_stage_done(struct ofono_sim *sim,
+					enum sim_init_stage stage);
+static void sim_free_main_state(struct ofono_sim *sim);
 
 static GSList *cached_pins = NULL;
 
@@ -367,17 +401,32 @@ static void service_number_free(gpointer pointer)
 	l_free(num);
 }
 
-static void call_state_watches(struct ofono_sim *sim)
+static void watches_foreach(struct ofono_watchlist *watchlist,
+				GFunc func, gpointer user_data)
 {
-	GSList *l;
-	ofono_sim_state_event_cb_t notify;
+	struct ofono_watchlist_item *item;
 
-	for (l = sim->state_watches->items; l; l = l->next) {
-		struct ofono_watchlist_item *item = l->data;
-		notify = item->notify;
+	__ofono_watchlist_dispatch_begin(watchlist);
 
-		notify(sim->state, item->notify_data);
-	}
+	for (item = __ofono_watchlist_first(watchlist); item;
+					item = __ofono_watchlist_next(item))
+		func(item, user_data);
+
+	__ofono_watchlist_dispatch_end(watchlist);
+}
+
+static void state_watch_cb(gpointer data, gpointer user_data)
+{
+	struct ofono_watchlist_item *item = data;
+	struct ofono_sim *sim = user_data;
+	ofono_sim_state_event_cb_t notify = item->notify;
+
+	notify(sim->state, item->notify_data);
+}
+
+static void call_state_watches(struct ofono_sim *sim)
+{
+	watches_foreach(sim->state_watches, state_watch_cb, sim);
 }
 
 static unsigned int add_watch_item(struct ofono_watchlist *watchlist,
@@ -405,7 +454,7 @@ static void iccid_watch_cb(gpointer data, gpointer user_data)
 
 static inline void iccid_watches_notify(struct ofono_sim *sim)
 {
-	g_slist_foreach(sim->iccid_watches->items, iccid_watch_cb, sim);
+	watches_foreach(sim->iccid_watches, iccid_watch_cb, sim);
 }
 
 unsigned int ofono_sim_add_iccid_watch(struct ofono_sim *sim,
@@ -442,7 +491,7 @@ static void imsi_watch_cb(gpointer data, gpointer user_data)
 
 static inline void imsi_watches_notify(struct ofono_sim *sim)
 {
-	g_slist_foreach(sim->imsi_watches->items, imsi_watch_cb, sim);
+	watches_foreach(sim->imsi_watches, imsi_watch_cb, sim);
 }
 
 unsigned int ofono_sim_add_imsi_watch(struct ofono_sim *sim,
@@ -1718,6 +1767,11 @@ static void sim_ready(enum ofono_sim_state new_state, void *user)
 					sim_efimg_changed, sim, NULL);
 }
 
+static unsigned int sim_init_elapsed_ms(gint64 since)
+{
+	return (g_get_monotonic_time() - since) / 1000;
+}
+
 static void sim_set_ready(struct ofono_sim *sim)
 {
 	if (sim == NULL)
@@ -1729,6 +1783,8 @@ static void sim_set_ready(struct ofono_sim *sim)
 
 	sim->state = OFONO_SIM_STATE_READY;
 
+	DBG("SIM ready after %u ms", sim_init_elapsed_ms(sim->inserted_time));
+
 	sim_fs_check_version(sim->simfs);
 
 	call_state_watches(sim);
@@ -1798,7 +1854,7 @@ static void discover_apps_cb(const struct ofono_error *error,
 	}
 }
 
-static void sim_imsi_obtained(struct ofono_sim *sim, const char *imsi)
+static void sim_set_imsi(struct ofono_sim *sim, const char *imsi)
 {
 	DBusConnection *conn = ofono_dbus_get_connection();
 	const char *path = __ofono_atom_get_path(sim->atom);
@@ -1837,6 +1893,166 @@ static void sim_imsi_obtained(struct ofono_sim *sim, const char *imsi)
 
 }
 
+static GByteArray *sim_snapshot_build(struct ofono_sim *sim,
+					const char *imsi)
+{
+	GByteArray *buf = sim_fs_snapshot_begin();
+	unsigned char phase = sim->phase;
+	unsigned char cphs[3];
+
+	cphs[0] = sim->cphs_phase;
+	memcpy(cphs + 1, sim->cphs_service_table, 2);
+
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_IMSI, imsi, strlen(imsi));
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_PHASE, &phase, 1);
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_MNC_LENGTH,
+				&sim->mnc_length, 1);
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_CPHS, cphs, 3);
+
+	if (sim->efust)
+		sim_fs_snapshot_append(buf, SIM_SNAPSHOT_EFUST,
+					sim->efust, sim->efust_length);
+
+	if (sim->efest)
+		sim_fs_snapshot_append(buf, SIM_SNAPSHOT_EFEST,
+					sim->efest, sim->efest_length);
+
+	if (sim->efsst)
+		sim_fs_snapshot_append(buf, SIM_SNAPSHOT_EFSST,
+					sim->efsst, sim->efsst_length);
+
+	return buf;
+}
+
+static void sim_snapshot_close(struct ofono_sim *sim)
+{
+	if (sim->snapshot_reset_source) {
+		g_source_remove(sim->snapshot_reset_source);
+		sim->snapshot_reset_source = 0;
+	}
+
+	sim_fs_snapshot_close(sim->snapshot);
+	sim->snapshot = NULL;
+	sim->snapshot_applied = false;
+}
+
+/*
+ * Starts from the snapshot saved for this ICCID, if any.  Returns the
+ * IMSI to publish right away, the caller verifies it against the card.
+ */
+static char *sim_snapshot_apply(struct ofono_sim *sim)
+{
+	struct sim_fs_snapshot_data data;
+
+	if (sim->snapshot == NULL)
+		return NULL;
+
+	if (!sim_fs_snapshot_parse(sim->snapshot, &data))
+		return NULL;
+
+	/*
+	 * Whether FDN or BDN is enabled is only known once the fresh
+	 * reads complete, which would be after READY.  Cards that have
+	 * either service always take the regular initialization path.
+	 */
+	if (sim_ust_is_available((unsigned char *) data.efust,
+					data.efust_length,
+					SIM_UST_SERVICE_FDN) ||
+			sim_ust_is_available((unsigned char *) data.efust,
+					data.efust_length,
+					SIM_UST_SERVICE_BDN) ||
+			sim_sst_is_active((unsigned char *) data.efsst,
+					data.efsst_length,
+					SIM_SST_SERVICE_FDN) ||
+			sim_sst_is_active((unsigned char *) data.efsst,
+					data.efsst_length,
+					SIM_SST_SERVICE_BDN)) {
+		DBG("FDN or BDN allocated, not using the SIM snapshot");
+		return NULL;
+	}
+
+	sim->phase = data.phase;
+	sim->mnc_length = data.mnc_length;
+	sim->cphs_phase = data.cphs_phase;
+	memcpy(sim->cphs_service_table, data.cphs_service_table, 2);
+
+	if (data.efust) {
+		sim->efust = g_memdup2(data.efust, data.efust_length);
+		sim->efust_length = data.efust_length;
+	}
+
+	if (data.efest) {
+		sim->efest = g_memdup2(data.efest, data.efest_length);
+		sim->efest_length = data.efest_length;
+	}
+
+	if (data.efsst) {
+		sim->efsst = g_memdup2(data.efsst, data.efsst_length);
+		sim->efsst_length = data.efsst_length;
+	}
+
+	sim->snapshot_applied = true;
+
+	return l_strndup(data.imsi, data.imsi_len);
+}
+
+static gboolean sim_snapshot_reset_cb(gpointer user_data)
+{
+	struct ofono_sim *sim = user_data;
+
+	sim->snapshot_reset_source = 0;
+	sim_snapshot_close(sim);
+
+	sim->state = OFONO_SIM_STATE_RESETTING;
+	__ofono_modem_sim_reset(__ofono_atom_get_modem(sim->atom));
+
+	sim_free_main_state(sim);
+	call_state_watches(sim);
+
+	sim->state = OFONO_SIM_STATE_INSERTED;
+	__ofono_sim_recheck_pin(sim);
+
+	return FALSE;
+}
+
+/*
+ * The card no longer matches what we published from the snapshot, drop
+ * it and go through the regular initialization like after a REFRESH.
+ * We get here from simfs and driver callbacks, so sim->context is torn
+ * down from idle.
+ */
+static void sim_snapshot_reset(struct ofono_sim *sim)
+{
+	if (sim->snapshot_reset_source)
+		return;
+
+	ofono_warn("SIM snapshot for %s is stale, reinitializing", sim->iccid);
+
+	sim_fs_snapshot_remove(sim->iccid);
+	sim->snapshot_reset_source = g_idle_add(sim_snapshot_reset_cb, sim);
+}
+
+static void sim_imsi_obtained(struct ofono_sim *sim, const char *imsi)
+{
+	if (sim->snapshot_applied) {
+		if (g_strcmp0(sim->imsi, imsi)) {
+			sim_snapshot_reset(sim);
+			return;
+		}
+
+		DBG("SIM snapshot verified");
+		sim_snapshot_close(sim);
+		return;
+	}
+
+	/* Without the MNC length the snapshot would never be applied */
+	if (sim->iccid && sim->mnc_length)
+		sim_fs_snapshot_commit(sim_snapshot_build(sim, imsi),
+					sim->iccid);
+
+	sim_set_imsi(sim, imsi);
+}
+
 static void sim_efimsi_cb(const struct ofono_error *error,
 				const unsigned char *data, int len, void *user)
 {
@@ -1949,34 +2165,10 @@ static void sim_efbdn_info_read_cb(int ok, unsigned char file_status,
 {
 	struct ofono_sim *sim = userdata;
 
-	if (!ok)
-		goto out;
-
-	if (file_status & SIM_FILE_STATUS_VALID)
+	if (ok && (file_status & SIM_FILE_STATUS_VALID))
 		sim_bdn_enabled(sim);
 
-out:
-	if (!sim->fixed_dialing && !sim->barred_dialing)
-		sim_retrieve_imsi(sim);
-}
-
-static gboolean check_bdn_status(struct ofono_sim *sim)
-{
-	/*
-	 * Check the status of Barred Dialing in the SIM-card
-	 * (TS 11.11/TS 51.011, Section 11.5.1: BDN capability request).
-	 * If BDN is allocated, activated in EFsst and EFbdn is validated,
-	 * halt the SIM initialization.
-	 */
-	if (sim_sst_is_active(sim->efsst, sim->efsst_length,
-			SIM_SST_SERVICE_BDN)) {
-		sim_fs_read_info(sim->context, SIM_EFBDN_FILEID,
-				OFONO_SIM_FILE_STRUCTURE_FIXED,
-				sim_efbdn_info_read_cb, sim);
-		return TRUE;
-	}
-
-	return FALSE;
+	sim_init_stage_done(sim, SIM_INIT_EFBDN_INFO);
 }
 
 static void sim_efadn_info_read_cb(int ok, unsigned char file_status,
@@ -1985,17 +2177,10 @@ static void sim_efadn_info_read_cb(int ok, unsigned char file_status,
 {
 	struct ofono_sim *sim = userdata;
 
-	if (!ok)
-		goto out;
-
-	if (!(file_status & SIM_FILE_STATUS_VALID))
+	if (ok && !(file_status & SIM_FILE_STATUS_VALID))
 		sim_fdn_enabled(sim);
 
-out:
-	if (check_bdn_status(sim) != TRUE) {
-		if (!sim->fixed_dialing && !sim->barred_dialing)
-			sim_retrieve_imsi(sim);
-	}
+	sim_init_stage_done(sim, SIM_INIT_EFADN_INFO);
 }
 
 static void sim_efsst_read_cb(int ok, int length, int record,
@@ -2004,6 +2189,10 @@ static void sim_efsst_read_cb(int ok, int length, int record,
 {
 	struct ofono_sim *sim = userdata;
 
+	g_free(sim->efsst);
+	sim->efsst = NULL;
+	sim->efsst_length = 0;
+
 	if (!ok)
 		goto out;
 
@@ -2015,25 +2204,8 @@ static void sim_efsst_read_cb(int ok, int length, int record,
 	sim->efsst = g_memdup2(data, length);
 	sim->efsst_length = length;
 
-	/*
-	 * Check if Fixed Dialing is enabled in the SIM-card
-	 * (TS 11.11/TS 51.011, Section 11.5.1: FDN capability request).
-	 * If FDN is activated and ADN is invalidated,
-	 * don't continue initialization routine.
-	 */
-	if (sim_sst_is_active(sim->efsst, sim->efsst_length,
-				SIM_SST_SERVICE_FDN)) {
-		sim_fs_read_info(sim->context, SIM_EFADN_FILEID,
-					OFONO_SIM_FILE_STRUCTURE_FIXED,
-					sim_efadn_info_read_cb, sim);
-		return;
-	}
-
-	if (check_bdn_status(sim) == TRUE)
-		return;
-
 out:
-	sim_retrieve_imsi(sim);
+	sim_init_stage_done(sim, SIM_INIT_EFSST);
 }
 
 static void sim_efest_read_cb(int ok, int length, int record,
@@ -2043,6 +2215,10 @@ static void sim_efest_read_cb(int ok, int length, int record,
 	struct ofono_sim *sim = userdata;
 	gboolean available;
 
+	g_free(sim->efest);
+	sim->efest = NULL;
+	sim->efest_length = 0;
+
 	if (!ok)
 		goto out;
 
@@ -2077,8 +2253,7 @@ static void sim_efest_read_cb(int ok, int length, int record,
 		sim_bdn_enabled(sim);
 
 out:
-	if (!sim->fixed_dialing && !sim->barred_dialing)
-		sim_retrieve_imsi(sim);
+	sim_init_stage_done(sim, SIM_INIT_EFEST);
 }
 
 static void sim_efust_read_cb(int ok, int length, int record,
@@ -2087,6 +2262,10 @@ static void sim_efust_read_cb(int ok, int length, int record,
 {
 	struct ofono_sim *sim = userdata;
 
+	g_free(sim->efust);
+	sim->efust = NULL;
+	sim->efust_length = 0;
+
 	if (!ok)
 		goto out;
 
@@ -2098,29 +2277,8 @@ static void sim_efust_read_cb(int ok, int length, int record,
 	sim->efust = g_memdup2(data, length);
 	sim->efust_length = length;
 
-	/*
-	 * Check whether the SIM provides EFest file
-	 * According to 3GPP TS 31.102 section 4.2.47, EFest file
-	 * shall be present if FDN or BDN or EST is available
-	 * Lets be paranoid and check for the special cases as well
-	 * where EST is not available(FDN or BDN available), but EFest
-	 * is present
-	 */
-	if (sim_ust_is_available(sim->efust, sim->efust_length,
-				SIM_UST_SERVICE_ENABLED_SERVICE_TABLE) ||
-			sim_ust_is_available(sim->efust, sim->efust_length,
-				SIM_UST_SERVICE_FDN) ||
-			sim_ust_is_available(sim->efust, sim->efust_length,
-				SIM_UST_SERVICE_BDN)) {
-		ofono_sim_read(sim->context, SIM_EFEST_FILEID,
-				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
-				sim_efest_read_cb, sim);
-
-		return;
-	}
-
 out:
-	sim_retrieve_imsi(sim);
+	sim_init_stage_done(sim, SIM_INIT_EFUST);
 }
 
 static void sim_cphs_information_read_cb(int ok, int length, int record,
@@ -2130,9 +2288,10 @@ static void sim_cphs_information_read_cb(int ok, int length, int record,
 	struct ofono_sim *sim = userdata;
 
 	sim->cphs_phase = OFONO_SIM_CPHS_PHASE_NONE;
+	memset(sim->cphs_service_table, 0, 2);
 
 	if (!ok || length < 3)
-		return;
+		goto out;
 
 	if (data[0] == 0x01)
 		sim->cphs_phase = OFONO_SIM_CPHS_PHASE_1G;
@@ -2140,6 +2299,9 @@ static void sim_cphs_information_read_cb(int ok, int length, int record,
 		sim->cphs_phase = OFONO_SIM_CPHS_PHASE_2G;
 
 	memcpy(sim->cphs_service_table, data + 1, 2);
+
+out:
+	sim_init_stage_done(sim, SIM_INIT_CPHS_INFORMATION);
 }
 
 static void sim_ad_read_cb(int ok, int length, int record,
@@ -2149,21 +2311,26 @@ static void sim_ad_read_cb(int ok, int length, int record,
 	struct ofono_sim *sim = userdata;
 	int new_mnc_length;
 
+	sim->mnc_length = 0;
+
 	if (!ok)
-		return;
+		goto out;
 
 	if (length < 4) {
 		ofono_error("EFad should contain at least four bytes");
-		return;
+		goto out;
 	}
 
 	new_mnc_length = data[3] & 0xf;
 
 	/* sanity check for potential invalid values */
 	if (new_mnc_length < 2 || new_mnc_length > 3)
-		return;
+		goto out;
 
 	sim->mnc_length = new_mnc_length;
+
+out:
+	sim_init_stage_done(sim, SIM_INIT_EFAD);
 }
 
 static void sim_efphase_read_cb(int ok, int length, int record,
@@ -2174,12 +2341,7 @@ static void sim_efphase_read_cb(int ok, int length, int record,
 
 	if (!ok || length != 1) {
 		sim->phase = OFONO_SIM_PHASE_3G;
-
-		ofono_sim_read(sim->context, SIM_EFUST_FILEID,
-				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
-				sim_efust_read_cb, sim);
-
-		return;
+		goto out;
 	}
 
 	switch (data[0]) {
@@ -2194,16 +2356,242 @@ static void sim_efphase_read_cb(int ok, int length, int record,
 		break;
 	default:
 		ofono_error("Unknown phase");
+		sim->init_halted = true;
+		break;
+	}
+
+out:
+	sim_init_stage_done(sim, SIM_INIT_EFPHASE);
+}
+
+static gboolean sim_need_efust(struct ofono_sim *sim)
+{
+	return sim->phase == OFONO_SIM_PHASE_3G;
+}
+
+static gboolean sim_need_efsst(struct ofono_sim *sim)
+{
+	return sim->phase != OFONO_SIM_PHASE_3G;
+}
+
+static gboolean sim_need_efest(struct ofono_sim *sim)
+{
+	/*
+	 * Check whether the SIM provides EFest file
+	 * According to 3GPP TS 31.102 section 4.2.47, EFest file
+	 * shall be present if FDN or BDN or EST is available
+	 * Lets be paranoid and check for the special cases as well
+	 * where EST is not available(FDN or BDN available), but EFest
+	 * is present
+	 */
+	return sim_ust_is_available(sim->efust, sim->efust_length,
+				SIM_UST_SERVICE_ENABLED_SERVICE_TABLE) ||
+			sim_ust_is_available(sim->efust, sim->efust_length,
+				SIM_UST_SERVICE_FDN) ||
+			sim_ust_is_available(sim->efust, sim->efust_length,
+				SIM_UST_SERVICE_BDN);
+}
+
+static gboolean sim_need_efadn_info(struct ofono_sim *sim)
+{
+	/*
+	 * Check if Fixed Dialing is enabled in the SIM-card
+	 * (TS 11.11/TS 51.011, Section 11.5.1: FDN capability request).
+	 * If FDN is activated and ADN is invalidated,
+	 * don't continue initialization routine.
+	 */
+	return sim_sst_is_active(sim->efsst, sim->efsst_length,
+					SIM_SST_SERVICE_FDN);
+}
+
+static gboolean sim_need_efbdn_info(struct ofono_sim *sim)
+{
+	/*
+	 * Check the status of Barred Dialing in the SIM-card
+	 * (TS 11.11/TS 51.011, Section 11.5.1: BDN capability request).
+	 * If BDN is allocated, activated in EFsst and EFbdn is validated,
+	 * halt the SIM initialization.
+	 */
+	return sim_sst_is_active(sim->efsst, sim->efsst_length,
+					SIM_SST_SERVICE_BDN);
+}
+
+#define STAGE(s) (1 << SIM_INIT_ ## s)
+
+/*
+ * The EFs read between PIN verification and IMSI retrieval.  A stage is
+ * issued as soon as all the stages in deps have completed and it is
+ * needed by this card, independent stages are queued together.
+ */
+static const struct sim_init_stage_desc {
+	const char *name;
+	int fileid;
+	enum ofono_sim_file_structure structure;
+	unsigned int deps;
+	gboolean (*needed)(struct ofono_sim *sim);
+	ofono_sim_file_read_cb_t read_cb;
+	sim_fs_read_info_cb_t info_cb;
+} sim_init_stages[SIM_INIT_STAGES] = {
+	[SIM_INIT_EFPHASE] = {
+		"EFphase", SIM_EFPHASE_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, NULL,
+		sim_efphase_read_cb, NULL },
+	[SIM_INIT_EFAD] = {
+		"EFad", SIM_EFAD_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, NULL,
+		sim_ad_read_cb, NULL },
+	/*
+	 * Read CPHS-support bits, this is still part of the SIM
+	 * initialisation but no order is specified for it.
+	 */
+	[SIM_INIT_CPHS_INFORMATION] = {
+		"EFcphs_info", SIM_EF_CPHS_INFORMATION_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, NULL,
+		sim_cphs_information_read_cb, NULL },
+	[SIM_INIT_EFUST] = {
+		"EFust", SIM_EFUST_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, STAGE(EFPHASE),
+		sim_need_efust, sim_efust_read_cb, NULL },
+	[SIM_INIT_EFEST] = {
+		"EFest", SIM_EFEST_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, STAGE(EFUST),
+		sim_need_efest, sim_efest_read_cb, NULL },
+	[SIM_INIT_EFSST] = {
+		"EFsst", SIM_EFSST_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, STAGE(EFPHASE),
+		sim_need_efsst, sim_efsst_read_cb, NULL },
+	[SIM_INIT_EFADN_INFO] = {
+		"EFadn info", SIM_EFADN_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_FIXED, STAGE(EFSST),
+		sim_need_efadn_info, NULL, sim_efadn_info_read_cb },
+	[SIM_INIT_EFBDN_INFO] = {
+		"EFbdn info", SIM_EFBDN_FILEID,
+		OFONO_SIM_FILE_STRUCTURE_FIXED, STAGE(EFSST),
+		sim_need_efbdn_info, NULL, sim_efbdn_info_read_cb },
+};
+
+#undef STAGE
+
+static void sim_init_complete(struct ofono_sim *sim)
+{
+	DBG("SIM init reads done after %u ms",
+			sim_init_elapsed_ms(sim->init_start));
+
+	if (sim->snapshot_applied) {
+		GByteArray *buf = sim_snapshot_build(sim, sim->imsi);
+		gboolean match = sim_fs_snapshot_matches(sim->snapshot, buf);
+
+		g_byte_array_free(buf, TRUE);
+
+		if (!match || sim->init_halted || sim->fixed_dialing ||
+				sim->barred_dialing) {
+			sim_snapshot_reset(sim);
+			return;
+		}
+	}
+
+	if (sim->init_halted)
+		return;
+
+	/* FDN or BDN enabled, don't continue initialization routine */
+	if (sim->fixed_dialing || sim->barred_dialing)
+		return;
+
+	sim_retrieve_imsi(sim);
+}
+
+static void sim_init_issue(struct ofono_sim *sim,
+				enum sim_init_stage stage)
+{
+	const struct sim_init_stage_desc *desc = &sim_init_stages[stage];
+
+	sim->init_issued |= 1 << stage;
+	sim->init_stage_start[stage] = g_get_monotonic_time();
+
+	if (desc->needed && !desc->needed(sim)) {
+		DBG("%s not needed", desc->name);
+		sim->init_done |= 1 << stage;
 		return;
 	}
 
-	ofono_sim_read(sim->context, SIM_EFSST_FILEID,
-			OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
-			sim_efsst_read_cb, sim);
+	DBG("%s issued", desc->name);
+	sim->init_pending += 1;
+
+	if (desc->info_cb) {
+		if (sim_fs_read_info(sim->context, desc->fileid,
+					desc->structure, desc->info_cb,
+					sim) == 0)
+			return;
+	} else if (ofono_sim_read(sim->context, desc->fileid,
+					desc->structure, desc->read_cb,
+					sim) == 0)
+		return;
+
+	/*
+	 * The request could not be queued, unless the callback has
+	 * already reported the failure, treat the stage as failed
+	 */
+	if (!(sim->init_done & (1 << stage))) {
+		sim->init_pending -= 1;
+		sim->init_done |= 1 << stage;
+	}
+}
+
+static void sim_init_schedule(struct ofono_sim *sim)
+{
+	gboolean progress = TRUE;
+	int i;
+
+	sim->init_scheduling = true;
+
+	while (progress && !sim->init_halted) {
+		progress = FALSE;
+
+		for (i = 0; i < SIM_INIT_STAGES; i++) {
+			unsigned int deps = sim_init_stages[i].deps;
+
+			if (sim->init_issued & (1 << i))
+				continue;
+
+			if ((sim->init_done & deps) != deps)
+				continue;
+
+			if (sim->init_pending >= SIM_INIT_MAX_PENDING_READS)
+				break;
+
+			sim_init_issue(sim, i);
+			progress = TRUE;
+		}
+	}
+
+	sim->init_scheduling = false;
+
+	if (sim->init_done == SIM_INIT_ALL_STAGES)
+		sim_init_complete(sim);
+}
+
+static void sim_init_stage_done(struct ofono_sim *sim,
+					enum sim_init_stage stage)
+{
+	/* Ignore reads left over from an earlier initialization attempt */
+	if (!(sim->init_issued & (1 << stage)) ||
+			(sim->init_done & (1 << stage)))
+		return;
+
+	DBG("%s done after %u ms", sim_init_stages[stage].name,
+			sim_init_elapsed_ms(sim->init_stage_start[stage]));
+
+	sim->init_done |= 1 << stage;
+	sim->init_pending -= 1;
+
+	if (!sim->init_scheduling)
+		sim_init_schedule(sim);
 }
 
 static void sim_initialize_after_pin(struct ofono_sim *sim)
 {
+	char *imsi;
+
 	sim->context = ofono_sim_context_create(sim);
 
 	/*
@@ -2212,21 +2600,28 @@ static void sim_initialize_after_pin(struct ofono_sim *sim)
 	if (sim->driver->list_apps)
 		sim->driver->list_apps(sim, discover_apps_cb, sim);
 
-	ofono_sim_read(sim->context, SIM_EFPHASE_FILEID,
-			OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
-			sim_efphase_read_cb, sim);
-
-	ofono_sim_read(sim->context, SIM_EFAD_FILEID,
-			OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
-			sim_ad_read_cb, sim);
+	sim->init_issued = 0;
+	sim->init_done = 0;
+	sim->init_pending = 0;
+	sim->init_halted = false;
+	sim->init_start = g_get_monotonic_time();
 
 	/*
-	 * Read CPHS-support bits, this is still part of the SIM
-	 * initialisation but no order is specified for it.
+	 * Queue the initialization reads first, with a snapshot they run
+	 * in the background and only verify what was published from it
 	 */
-	ofono_sim_read(sim->context, SIM_EF_CPHS_INFORMATION_FILEID,
-			OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
-			sim_cphs_information_read_cb, sim);
+	sim_init_schedule(sim);
+
+	if (sim->state == OFONO_SIM_STATE_READY || sim->imsi != NULL)
+		return;
+
+	imsi = sim_snapshot_apply(sim);
+	if (imsi == NULL)
+		return;
+
+	DBG("Starting from SIM snapshot");
+	sim_set_imsi(sim, imsi);
+	l_free(imsi);
 }
 
 static void sim_efli_read_cb(int ok, int length, int record,
@@ -2384,6 +2779,9 @@ static void sim_iccid_read_cb(int ok, int length, int record,
 	iccid[20] = '\0';
 	sim->iccid = l_strdup(iccid);
 
+	sim_fs_snapshot_close(sim->snapshot);
+	sim->snapshot = sim_fs_snapshot_open(sim->iccid);
+
 	ofono_dbus_signal_property_changed(conn, path,
 						OFONO_SIM_MANAGER_INTERFACE,
 						"CardIdentifier",
@@ -2682,6 +3080,8 @@ static void sim_inserted_update(struct ofono_sim *sim)
 
 static void sim_free_early_state(struct ofono_sim *sim)
 {
+	sim_snapshot_close(sim);
+
 	if (sim->iccid) {
 		l_free(sim->iccid);
 		sim->iccid = NULL;
@@ -2829,6 +3229,7 @@ static void sim_free_main_state(struct ofono_sim *sim)
 
 	sim->initialized = false;
 	sim->wait_initialized = false;
+	sim->snapshot_applied = false;
 }
 
 static void sim_free_state(struct ofono_sim *sim)
@@ -2919,13 +3320,16 @@ void ofono_sim_inserted_notify(struct ofono_sim *sim, ofono_bool_t inserted)
 		 * EFli and EFpl are retrieved.
 		 */
 		sim->state = OFONO_SIM_STATE_INSERTED;
+		sim->inserted_time = g_get_monotonic_time();
 		__ofono_sim_recheck_pin(sim);
 		return;
 	}
 
-	if (inserted == TRUE && sim->state == OFONO_SIM_STATE_NOT_PRESENT)
+	if (inserted == TRUE && sim->state == OFONO_SIM_STATE_NOT_PRESENT) {
 		sim->state = OFONO_SIM_STATE_INSERTED;
-	else if (inserted == FALSE && sim->state != OFONO_SIM_STATE_NOT_PRESENT)
+		sim->inserted_time = g_get_monotonic_time();
+	} else if (inserted == FALSE &&
+			sim->state != OFONO_SIM_STATE_NOT_PRESENT)
 		sim->state = OFONO_SIM_STATE_NOT_PRESENT;
 	else
 		return;
@@ -3034,8 +3438,7 @@ static void spn_watch_cb(gpointer data, gpointer user_data)
 
 static inline void spn_watches_notify(struct ofono_sim *sim)
 {
-	if (sim->spn_watches->items)
-		g_slist_foreach(sim->spn_watches->items, spn_watch_cb, sim);
+	watches_foreach(sim->spn_watches, spn_watch_cb, sim);
 
 	sim->reading_spn = false;
 }
@@ -3651,6 +4054,10 @@ void __ofono_sim_refresh(struct ofono_sim *sim, struct l_queue *files,
 	}
 
 	if (reinit_naa) {
+		/* The snapshot describes the old contents */
+		sim_fs_snapshot_remove(sim->iccid);
+		sim_snapshot_close(sim);
+
 		sim->state = OFONO_SIM_STATE_RESETTING;
 		__ofono_modem_sim_reset(__ofono_atom_get_modem(sim->atom));
 
@@ -3691,7 +4098,7 @@ static void close_channel_cb(const struct ofono_error *error, void *data)
 	if (error->type != OFONO_ERROR_TYPE_NO_ERROR)
 		DBG("session %d failed to close", session->session_id);
 
-	if (g_slist_length(session->watches->items) > 0 &&
+	if (!__ofono_watchlist_is_empty(session->watches) &&
 				session->state == SESSION_STATE_OPENING) {
 		/*
 		 * An atom requested to open during a close, we can re-open
@@ -3710,7 +4117,7 @@ static void open_channel_cb(const struct ofono_error *error, int session_id,
 		void *data)
 {
 	struct ofono_sim_aid_session *session = data;
-	GSList *iter = session->watches->items;
+	struct ofono_watchlist_item *item;
 	ofono_bool_t active = TRUE;
 
 	if (error->type != OFONO_ERROR_TYPE_NO_ERROR) {
@@ -3720,7 +4127,7 @@ static void open_channel_cb(const struct ofono_error *error, int session_id,
 		goto end;
 	}
 
-	if (g_slist_length(iter) == 0) {
+	if (__ofono_watchlist_is_empty(session->watches)) {
 		/*
 		 * All watchers stopped watching before the channel could open.
 		 * Close the channel.
@@ -3738,14 +4145,16 @@ end:
 	 * Notify any watchers, after this point, all future watchers will be
 	 * immediately notified with the session ID.
 	 */
-	while (iter) {
-		struct ofono_watchlist_item *item = iter->data;
+	__ofono_watchlist_dispatch_begin(session->watches);
+
+	for (item = __ofono_watchlist_first(session->watches); item;
+					item = __ofono_watchlist_next(item)) {
 		ofono_sim_session_event_cb_t notify = item->notify;
 
 		notify(active, session->session_id, item->notify_data);
-
-		iter = g_slist_next(iter);
 	}
+
+	__ofono_watchlist_dispatch_end(session->watches);
 }
 
 unsigned int __ofono_sim_add_session_watch(
@@ -3769,7 +4178,7 @@ unsigned int __ofono_sim_add_session_watch(
 	item->destroy = destroy;
 	item->notify_data = data;
 
-	if (g_slist_length(session->watches->items) == 0 &&
+	if (__ofono_watchlist_is_empty(session->watches) &&
 			session->state == SESSION_STATE_INACTIVE) {
 		/*
 		 * If the session is inactive and there are no watchers, open
@@ -3801,7 +4210,7 @@ void __ofono_sim_remove_session_watch(struct ofono_sim_aid_session *session,
 {
 	__ofono_watchlist_remove_item(session->watches, id);
 
-	if (g_slist_length(session->watches->items) == 0 &&
+	if (__ofono_watchlist_is_empty(session->watches) &&
 			session->state == SESSION_STATE_OPEN) {
 		/* last watcher, close session */
 		session->state = SESSION_STATE_CLOSING;
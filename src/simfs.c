@@ -28,6 +28,7 @@
 
 #include <glib.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -41,17 +42,25 @@
 #include "storage.h"
 #include "missing.h"
 
+/* Unit tests keep their cache files out of the real storage directory */
+#ifndef SIM_FS_STORAGEDIR
+#define SIM_FS_STORAGEDIR STORAGEDIR
+#endif
+
 #define SIM_CACHE_MODE 0600
-#define SIM_CACHE_BASEPATH STORAGEDIR "/%s-%i"
+#define SIM_CACHE_BASEPATH SIM_FS_STORAGEDIR "/%s-%i"
 #define SIM_CACHE_VERSION SIM_CACHE_BASEPATH "/version"
 #define SIM_CACHE_PATH SIM_CACHE_BASEPATH "/%04x"
+#define SIM_CACHE_KEY "%s-%i/%04x"
 #define SIM_CACHE_HEADER_SIZE 39
 #define SIM_FILE_INFO_SIZE 7
-#define SIM_IMAGE_CACHE_BASEPATH STORAGEDIR "/%s-%i/images"
+#define SIM_IMAGE_CACHE_BASEPATH SIM_FS_STORAGEDIR "/%s-%i/images"
 #define SIM_IMAGE_CACHE_PATH SIM_IMAGE_CACHE_BASEPATH "/%d.xpm"
 
 #define SIM_FS_VERSION 2
 
+#define SIM_FS_MEM_CACHE_MAX (256 * 1024)
+
 static gboolean sim_fs_op_next(gpointer user_data);
 static gboolean sim_fs_op_read_record(gpointer user);
 static gboolean sim_fs_op_read_block(gpointer user_data);
@@ -70,8 +79,22 @@ struct sim_fs_op {
 	unsigned char path_len;
 	gconstpointer cb;
 	gboolean is_read;
+	gboolean started;
 	void *userdata;
 	struct ofono_sim_context *context;
+	GSList *waiters;
+};
+
+/*
+ * Additional requesters coalesced into a pending read.  Info-only waiters
+ * are satisfied as soon as the EF-info is known, the rest receive the same
+ * data as the owner of the operation.
+ */
+struct sim_fs_waiter {
+	gconstpointer cb;
+	void *userdata;
+	gboolean info_only;
+	struct ofono_sim_context *context;
 };
 
 struct ofono_sim_context {
@@ -82,7 +105,8 @@ struct ofono_sim_context {
 struct sim_fs {
 	GQueue *op_q;
 	gint op_source;
-	unsigned char bitmap[32];
+	struct sim_fs_cache_entry *cache;
+	gboolean bitmap_dirty;
 	int fd;
 	struct ofono_sim *sim;
 	const struct ofono_sim_driver *driver;
@@ -92,10 +116,165 @@ struct sim_fs {
 	unsigned int watch_id;
 };
 
+/*
+ * In-memory copy of a recently used EF cache file, keyed by the cache file
+ * path below the storage directory.  The file stays authoritative, blocks
+ * are only marked present here once they have been written to it.
+ */
+struct sim_fs_cache_entry {
+	char *key;
+	unsigned char header[SIM_CACHE_HEADER_SIZE];
+	unsigned char *data;
+	int length;
+	int refs;
+	GList *lru;
+};
+
+static GHashTable *mem_cache;
+static GQueue mem_cache_lru = G_QUEUE_INIT;
+static size_t mem_cache_size;
+static unsigned int mem_cache_hits;
+static unsigned int mem_cache_misses;
+
+static void cache_entry_unref(struct sim_fs_cache_entry *entry)
+{
+	if (--entry->refs > 0)
+		return;
+
+	l_free(entry->key);
+	g_free(entry->data);
+	g_free(entry);
+}
+
+static void cache_entry_unlink(struct sim_fs_cache_entry *entry)
+{
+	g_hash_table_remove(mem_cache, entry->key);
+	g_queue_delete_link(&mem_cache_lru, entry->lru);
+	entry->lru = NULL;
+	mem_cache_size -= entry->length + SIM_CACHE_HEADER_SIZE;
+
+	cache_entry_unref(entry);
+}
+
+static struct sim_fs_cache_entry *cache_entry_lookup(const char *key)
+{
+	struct sim_fs_cache_entry *entry = NULL;
+
+	if (mem_cache)
+		entry = g_hash_table_lookup(mem_cache, key);
+
+	if (entry == NULL) {
+		mem_cache_misses += 1;
+		return NULL;
+	}
+
+	mem_cache_hits += 1;
+
+	g_queue_unlink(&mem_cache_lru, entry->lru);
+	g_queue_push_head_link(&mem_cache_lru, entry->lru);
+
+	return entry;
+}
+
+/* Takes ownership of key, replaces any entry already using it */
+static struct sim_fs_cache_entry *cache_entry_new(char *key,
+						const unsigned char *header,
+						int length)
+{
+	struct sim_fs_cache_entry *entry;
+
+	if (mem_cache == NULL)
+		mem_cache = g_hash_table_new(g_str_hash, g_str_equal);
+
+	entry = g_hash_table_lookup(mem_cache, key);
+	if (entry)
+		cache_entry_unlink(entry);
+
+	entry = g_new0(struct sim_fs_cache_entry, 1);
+	entry->key = key;
+	memcpy(entry->header, header, SIM_CACHE_HEADER_SIZE);
+	entry->data = g_new0(unsigned char, length);
+	entry->length = length;
+	entry->refs = 1;
+
+	g_hash_table_insert(mem_cache, entry->key, entry);
+	g_queue_push_head(&mem_cache_lru, entry);
+	entry->lru = mem_cache_lru.head;
+	mem_cache_size += length + SIM_CACHE_HEADER_SIZE;
+
+	/* Files still in use stay alive through their own reference */
+	while (mem_cache_size > SIM_FS_MEM_CACHE_MAX &&
+			mem_cache_lru.tail != entry->lru)
+		cache_entry_unlink(g_queue_peek_tail(&mem_cache_lru));
+
+	return entry;
+}
+
+static void cache_entries_drop(const char *prefix)
+{
+	size_t len = strlen(prefix);
+	GList *next;
+	GList *l;
+
+	for (l = mem_cache_lru.head; l; l = next) {
+		struct sim_fs_cache_entry *entry = l->data;
+
+		next = l->next;
+
+		if (strncmp(entry->key, prefix, len) == 0)
+			cache_entry_unlink(entry);
+	}
+}
+
+void sim_fs_get_cache_stats(unsigned int *hits, unsigned int *misses)
+{
+	if (hits)
+		*hits = mem_cache_hits;
+
+	if (misses)
+		*misses = mem_cache_misses;
+}
+
+/* Drops all in-memory cache files, files still in use keep their reference */
+void sim_fs_cache_cleanup(void)
+{
+	DBG("cache hits: %u, misses: %u", mem_cache_hits, mem_cache_misses);
+
+	while (mem_cache_lru.head)
+		cache_entry_unlink(mem_cache_lru.head->data);
+
+	if (mem_cache) {
+		g_hash_table_destroy(mem_cache);
+		mem_cache = NULL;
+	}
+}
+
+/* Writes back the presence bitmap and lets go of the current cache file */
+static void sim_fs_cache_release(struct sim_fs *fs)
+{
+	if (fs->cache && fs->bitmap_dirty && fs->fd != -1)
+		L_TFR(pwrite(fs->fd, fs->cache->header + SIM_FILE_INFO_SIZE,
+				SIM_CACHE_HEADER_SIZE - SIM_FILE_INFO_SIZE,
+				SIM_FILE_INFO_SIZE));
+
+	if (fs->fd != -1) {
+		L_TFR(close(fs->fd));
+		fs->fd = -1;
+	}
+
+	if (fs->cache) {
+		cache_entry_unref(fs->cache);
+		fs->cache = NULL;
+	}
+
+	fs->bitmap_dirty = FALSE;
+}
+
 static void sim_fs_op_free(gpointer pointer)
 {
 	struct sim_fs_op *node = pointer;
 
+	g_slist_free_full(node->waiters, g_free);
 	g_free(node->buffer);
 	g_free(node);
 }
@@ -125,6 +304,10 @@ void sim_fs_free(struct sim_fs *fs)
 	if (fs->watch_id)
 		__ofono_sim_remove_session_watch(fs->session, fs->watch_id);
 
+	sim_fs_cache_release(fs);
+
+	DBG("cache hits: %u, misses: %u", mem_cache_hits, mem_cache_misses);
+
 	g_free(fs);
 }
 
@@ -180,6 +363,37 @@ struct ofono_sim_context *sim_fs_context_new_with_aid(struct sim_fs *fs,
 	return context;
 }
 
+static void sim_fs_op_drop_waiters(struct sim_fs_op *op,
+					struct ofono_sim_context *context,
+					gboolean in_progress)
+{
+	GSList *l = op->waiters;
+
+	while (l) {
+		struct sim_fs_waiter *w = l->data;
+		GSList *next = l->next;
+
+		if (w->context != context) {
+			l = next;
+			continue;
+		}
+
+		/*
+		 * The waiter list of the operation in progress may be walked
+		 * by our caller, so only mark the entry as gone
+		 */
+		if (in_progress) {
+			w->cb = NULL;
+			w->context = NULL;
+		} else {
+			op->waiters = g_slist_delete_link(op->waiters, l);
+			g_free(w);
+		}
+
+		l = next;
+	}
+}
+
 void sim_fs_context_free(struct ofono_sim_context *context)
 {
 	struct sim_fs *fs = context->fs;
@@ -188,12 +402,15 @@ void sim_fs_context_free(struct ofono_sim_context *context)
 
 	if (fs->op_q) {
 		while ((op = g_queue_peek_nth(fs->op_q, n)) != NULL) {
+			sim_fs_op_drop_waiters(op, context, n == 0);
+
 			if (op->context != context) {
 				n += 1;
 				continue;
 			}
 
-			if (n == 0) {
+			/* Keep the operation around for the other waiters */
+			if (n == 0 || op->waiters) {
 				op->cb = NULL;
 				op->context = NULL;
 
@@ -249,18 +466,24 @@ void sim_fs_notify_file_watches(struct sim_fs *fs, int id)
 
 	for (l = fs->contexts; l; l = l->next) {
 		struct ofono_sim_context *context = l->data;
-		GSList *k;
+		struct ofono_watchlist *watches = context->file_watches;
+		struct ofono_watchlist_item *item;
 
-		if (context->file_watches == NULL)
+		if (watches == NULL)
 			continue;
 
-		for (k = context->file_watches->items; k; k = k->next) {
-			struct file_watch *w = k->data;
+		__ofono_watchlist_dispatch_begin(watches);
+
+		for (item = __ofono_watchlist_first(watches); item;
+					item = __ofono_watchlist_next(item)) {
+			struct file_watch *w = (struct file_watch *) item;
 			ofono_sim_file_changed_cb_t notify = w->item.notify;
 
 			if (id == -1 || w->ef == id)
 				notify(w->ef, w->item.notify_data);
 		}
+
+		__ofono_watchlist_dispatch_end(watches);
 	}
 
 }
@@ -274,74 +497,137 @@ static void sim_fs_end_current(struct sim_fs *fs)
 	else if (fs->watch_id) /* release the session if no pending reads */
 		__ofono_sim_remove_session_watch(fs->session, fs->watch_id);
 
-	if (fs->fd != -1) {
-		L_TFR(close(fs->fd));
-		fs->fd = -1;
+	sim_fs_cache_release(fs);
+
+	sim_fs_op_free(op);
+}
+
+/* TRUE if neither the owner nor any waiter is still interested */
+static gboolean sim_fs_op_orphaned(struct sim_fs_op *op)
+{
+	GSList *l;
+
+	if (op->cb != NULL)
+		return FALSE;
+
+	for (l = op->waiters; l; l = l->next) {
+		struct sim_fs_waiter *w = l->data;
+
+		if (w->cb != NULL)
+			return FALSE;
 	}
 
-	memset(fs->bitmap, 0, sizeof(fs->bitmap));
+	return TRUE;
+}
 
-	sim_fs_op_free(op);
+static void sim_fs_op_info_notify(struct sim_fs_op *op, int ok,
+					unsigned char file_status,
+					int length, int record_length)
+{
+	GSList *l;
+
+	for (l = op->waiters; l; l = l->next) {
+		struct sim_fs_waiter *w = l->data;
+		sim_fs_read_info_cb_t cb = w->cb;
+
+		if (w->info_only == FALSE || cb == NULL)
+			continue;
+
+		w->cb = NULL;
+		cb(ok, file_status, length, record_length, w->userdata);
+	}
+}
+
+static void sim_fs_op_read_notify(struct sim_fs_op *op, int ok, int length,
+					int record, const unsigned char *data,
+					int record_length)
+{
+	ofono_sim_file_read_cb_t cb = op->cb;
+	GSList *l;
+
+	if (cb != NULL)
+		cb(ok, length, record, data, record_length, op->userdata);
+
+	for (l = op->waiters; l; l = l->next) {
+		struct sim_fs_waiter *w = l->data;
+
+		cb = w->cb;
+
+		if (w->info_only == TRUE || cb == NULL)
+			continue;
+
+		cb(ok, length, record, data, record_length, w->userdata);
+	}
 }
 
 static void sim_fs_op_error(struct sim_fs *fs)
 {
 	struct sim_fs_op *op = g_queue_peek_head(fs->op_q);
 
-	if (op->cb == NULL) {
+	if (sim_fs_op_orphaned(op)) {
 		sim_fs_end_current(fs);
 		return;
 	}
 
-	if (op->info_only == TRUE)
-		((sim_fs_read_info_cb_t) op->cb)
-			(0, 0, 0, 0, op->userdata);
-	else if (op->is_read == TRUE)
-		((ofono_sim_file_read_cb_t) op->cb)
-			(0, 0, 0, 0, 0, op->userdata);
-	else
+	sim_fs_op_info_notify(op, 0, 0, 0, 0);
+
+	if (op->info_only == TRUE) {
+		if (op->cb != NULL)
+			((sim_fs_read_info_cb_t) op->cb)
+				(0, 0, 0, 0, op->userdata);
+	} else if (op->is_read == TRUE)
+		sim_fs_op_read_notify(op, 0, 0, 0, NULL, 0);
+	else if (op->cb != NULL)
 		((ofono_sim_file_write_cb_t) op->cb)
 			(0, op->userdata);
 
 	sim_fs_end_current(fs);
 }
 
-static gboolean cache_block(struct sim_fs *fs, int block, int block_len,
-				const unsigned char *data, int num_bytes)
+static gboolean cache_block_present(struct sim_fs *fs, int block)
 {
-	int offset;
-	int bit;
-	ssize_t r;
-	unsigned char b;
+	const unsigned char *bitmap;
 
-	if (fs->fd == -1)
+	if (fs->cache == NULL)
 		return FALSE;
 
-	if (lseek(fs->fd, block * block_len +
-				SIM_CACHE_HEADER_SIZE, SEEK_SET) == (off_t) -1)
-		return FALSE;
+	bitmap = fs->cache->header + SIM_FILE_INFO_SIZE;
 
-	r = L_TFR(write(fs->fd, data, num_bytes));
+	return (bitmap[block / 8] & (1 << (block % 8))) != 0;
+}
 
-	if (r != num_bytes)
+static gboolean cache_block(struct sim_fs *fs, int block, int block_len,
+				const unsigned char *data, int num_bytes)
+{
+	struct sim_fs_cache_entry *entry = fs->cache;
+	int offset = block * block_len;
+	ssize_t r;
+
+	if (entry == NULL || offset + num_bytes > entry->length)
 		return FALSE;
 
-	/* update present bit for this block */
-	offset = block / 8;
-	bit = block % 8;
+	if (fs->fd == -1) {
+		char *path = l_strdup_printf(SIM_FS_STORAGEDIR "/%s",
+							entry->key);
 
-	/* lseek to correct byte (skip file info) */
-	lseek(fs->fd, offset + SIM_FILE_INFO_SIZE, SEEK_SET);
+		fs->fd = L_TFR(open(path, O_WRONLY));
+		l_free(path);
 
-	b = fs->bitmap[offset];
-	b |= 1 << bit;
+		if (fs->fd == -1)
+			return FALSE;
+	}
 
-	r = L_TFR(write(fs->fd, &b, sizeof(b)));
+	r = L_TFR(pwrite(fs->fd, data, num_bytes,
+				offset + SIM_CACHE_HEADER_SIZE));
 
-	if (r != sizeof(b))
+	if (r != num_bytes)
 		return FALSE;
 
-	fs->bitmap[offset] = b;
+	memcpy(entry->data + offset, data, num_bytes);
+
+	/* The bitmap is written back once the operation is done */
+	entry->header[SIM_FILE_INFO_SIZE + block / 8] |= 1 << (block % 8);
+	fs->bitmap_dirty = TRUE;
 
 	return TRUE;
 }
@@ -402,7 +688,7 @@ static void sim_fs_op_read_block_cb(const struct ofono_error *error,
 	memcpy(op->buffer + bufoff, data + dataoff, tocopy);
 	cache_block(fs, op->current, 256, data, len);
 
-	if (op->cb == NULL) {
+	if (sim_fs_op_orphaned(op)) {
 		sim_fs_end_current(fs);
 		return;
 	}
@@ -410,10 +696,8 @@ static void sim_fs_op_read_block_cb(const struct ofono_error *error,
 	op->current++;
 
 	if (op->current > end_block) {
-		ofono_sim_file_read_cb_t cb = op->cb;
-
-		cb(1, op->num_bytes, 0, op->buffer,
-				op->record_length, op->userdata);
+		sim_fs_op_read_notify(op, 1, op->num_bytes, 0, op->buffer,
+					op->record_length);
 
 		sim_fs_end_current(fs);
 	} else {
@@ -431,7 +715,7 @@ static gboolean sim_fs_op_read_block(gpointer user_data)
 
 	fs->op_source = 0;
 
-	if (op->cb == NULL) {
+	if (sim_fs_op_orphaned(op)) {
 		sim_fs_end_current(fs);
 		return FALSE;
 	}
@@ -448,45 +732,39 @@ static gboolean sim_fs_op_read_block(gpointer user_data)
 		}
 	}
 
-	while (fs->fd != -1 && op->current <= end_block) {
-		int offset = op->current / 8;
-		int bit = 1 << op->current % 8;
+	while (op->current <= end_block) {
 		int bufoff;
-		int seekoff;
+		int dataoff;
 		int toread;
 
-		if ((fs->bitmap[offset] & bit) == 0)
+		if (!cache_block_present(fs, op->current))
 			break;
 
 		if (op->current == start_block) {
 			bufoff = 0;
-			seekoff = SIM_CACHE_HEADER_SIZE + op->current * 256 +
-				op->offset % 256;
+			dataoff = op->current * 256 + op->offset % 256;
 			toread = MIN(256 - op->offset % 256, op->num_bytes);
 		} else {
 			bufoff = (op->current - start_block) * 256 -
 					op->offset % 256;
-			seekoff = SIM_CACHE_HEADER_SIZE + op->current * 256;
+			dataoff = op->current * 256;
 			toread = MIN(256, op->num_bytes - bufoff);
 		}
 
-		DBG("bufoff: %d, seekoff: %d, toread: %d",
-				bufoff, seekoff, toread);
+		DBG("bufoff: %d, dataoff: %d, toread: %d",
+				bufoff, dataoff, toread);
 
-		if (lseek(fs->fd, seekoff, SEEK_SET) == (off_t) -1)
+		if (dataoff + toread > fs->cache->length)
 			break;
 
-		if (L_TFR(read(fs->fd, op->buffer + bufoff, toread)) != toread)
-			break;
+		memcpy(op->buffer + bufoff, fs->cache->data + dataoff, toread);
 
 		op->current += 1;
 	}
 
 	if (op->current > end_block) {
-		ofono_sim_file_read_cb_t cb = op->cb;
-
-		cb(1, op->num_bytes, 0, op->buffer,
-				op->record_length, op->userdata);
+		sim_fs_op_read_notify(op, 1, op->num_bytes, 0, op->buffer,
+					op->record_length);
 
 		sim_fs_end_current(fs);
 
@@ -516,7 +794,6 @@ static void sim_fs_op_retrieve_cb(const struct ofono_error *error,
 	struct sim_fs *fs = user;
 	struct sim_fs_op *op = g_queue_peek_head(fs->op_q);
 	int total = op->length / op->record_length;
-	ofono_sim_file_read_cb_t cb = op->cb;
 
 	if (error->type != OFONO_ERROR_TYPE_NO_ERROR) {
 		sim_fs_op_error(fs);
@@ -526,12 +803,13 @@ static void sim_fs_op_retrieve_cb(const struct ofono_error *error,
 	cache_block(fs, op->current - 1, op->record_length,
 			data, op->record_length);
 
-	if (cb == NULL) {
+	if (sim_fs_op_orphaned(op)) {
 		sim_fs_end_current(fs);
 		return;
 	}
 
-	cb(1, op->length, op->current, data, op->record_length, op->userdata);
+	sim_fs_op_read_notify(op, 1, op->length, op->current, data,
+				op->record_length);
 
 	if (op->current < total) {
 		op->current += 1;
@@ -541,6 +819,60 @@ static void sim_fs_op_retrieve_cb(const struct ofono_error *error,
 	}
 }
 
+static void sim_fs_op_retrieve_records_cb(const struct ofono_error *error,
+						const unsigned char *data,
+						int len, void *user)
+{
+	struct sim_fs *fs = user;
+	struct sim_fs_op *op = g_queue_peek_head(fs->op_q);
+	int total = op->length / op->record_length;
+	int count = len / op->record_length;
+	int i;
+
+	if (error->type != OFONO_ERROR_TYPE_NO_ERROR || count == 0 ||
+			op->current + count - 1 > total) {
+		sim_fs_op_error(fs);
+		return;
+	}
+
+	for (i = 0; i < count; i++)
+		cache_block(fs, op->current - 1 + i, op->record_length,
+				data + i * op->record_length,
+				op->record_length);
+
+	for (i = 0; i < count; i++) {
+		/* The context may have gone away in the previous callback */
+		if (sim_fs_op_orphaned(op)) {
+			sim_fs_end_current(fs);
+			return;
+		}
+
+		sim_fs_op_read_notify(op, 1, op->length, op->current,
+					data + i * op->record_length,
+					op->record_length);
+
+		op->current += 1;
+	}
+
+	if (op->current <= total)
+		fs->op_source = g_idle_add(sim_fs_op_read_record, fs);
+	else
+		sim_fs_end_current(fs);
+}
+
+/* Counts the records from op->current on that are not in the cache */
+static int sim_fs_op_uncached_records(struct sim_fs *fs,
+					struct sim_fs_op *op, int total)
+{
+	int record;
+
+	for (record = op->current; record <= total; record++)
+		if (cache_block_present(fs, record - 1))
+			break;
+
+	return record - op->current;
+}
+
 static gboolean sim_fs_op_read_record(gpointer user)
 {
 	struct sim_fs *fs = user;
@@ -551,29 +883,24 @@ static gboolean sim_fs_op_read_record(gpointer user)
 
 	fs->op_source = 0;
 
-	if (op->cb == NULL) {
+	if (sim_fs_op_orphaned(op)) {
 		sim_fs_end_current(fs);
 		return FALSE;
 	}
 
-	while (fs->fd != -1 && op->current <= total) {
-		int offset = (op->current - 1) / 8;
-		int bit = 1 << ((op->current - 1) % 8);
-		ofono_sim_file_read_cb_t cb = op->cb;
+	while (op->current <= total) {
+		int dataoff = (op->current - 1) * op->record_length;
 
-		if ((fs->bitmap[offset] & bit) == 0)
+		if (!cache_block_present(fs, op->current - 1))
 			break;
 
-		if (lseek(fs->fd, (op->current - 1) * op->record_length +
-				SIM_CACHE_HEADER_SIZE, SEEK_SET) == (off_t) -1)
+		if (dataoff + op->record_length > fs->cache->length)
 			break;
 
-		if (L_TFR(read(fs->fd, buf, op->record_length)) !=
-				op->record_length)
-			break;
+		memcpy(buf, fs->cache->data + dataoff, op->record_length);
 
-		cb(1, op->length, op->current,
-				buf, op->record_length, op->userdata);
+		sim_fs_op_read_notify(op, 1, op->length, op->current,
+					buf, op->record_length);
 
 		op->current += 1;
 	}
@@ -586,6 +913,19 @@ static gboolean sim_fs_op_read_record(gpointer user)
 
 	switch (op->structure) {
 	case OFONO_SIM_FILE_STRUCTURE_FIXED:
+		if (driver->read_file_linear_records) {
+			int count = sim_fs_op_uncached_records(fs, op, total);
+
+			if (count > 1) {
+				driver->read_file_linear_records(fs->sim,
+						op->id, op->current, count,
+						op->record_length, NULL, 0,
+						sim_fs_op_retrieve_records_cb,
+						fs);
+				break;
+			}
+		}
+
 		if (driver->read_file_linear == NULL) {
 			sim_fs_op_error(fs);
 			return FALSE;
@@ -666,8 +1006,12 @@ static void sim_fs_op_cache_fileinfo(struct sim_fs *fs,
 		return;
 
 	if (L_TFR(write(fs->fd, fileinfo, SIM_CACHE_HEADER_SIZE)) ==
-			SIM_CACHE_HEADER_SIZE)
+			SIM_CACHE_HEADER_SIZE) {
+		path = l_strdup_printf(SIM_CACHE_KEY, imsi, phase, op->id);
+		fs->cache = cache_entry_new(path, fileinfo, length);
+		fs->cache->refs += 1;
 		return;
+	}
 
 	L_TFR(close(fs->fd));
 	fs->fd = -1;
@@ -698,11 +1042,6 @@ static void sim_fs_op_info_cb(const struct ofono_error *error, int length,
 		return;
 	}
 
-	if (op->cb == NULL) {
-		sim_fs_end_current(fs);
-		return;
-	}
-
 	op->structure = structure;
 	op->length = length;
 
@@ -712,15 +1051,17 @@ static void sim_fs_op_info_cb(const struct ofono_error *error, int length,
 
 		op->record_length = length;
 		op->current = op->offset / 256;
-
-		if (op->info_only == FALSE)
-			fs->op_source = g_idle_add(sim_fs_op_read_block, fs);
 	} else {
 		op->record_length = record_length;
 		op->current = 1;
+	}
+
+	sim_fs_op_info_notify(op, 1, file_status, op->length,
+				op->record_length);
 
-		if (op->info_only == FALSE)
-			fs->op_source = g_idle_add(sim_fs_op_read_record, fs);
+	if (sim_fs_op_orphaned(op)) {
+		sim_fs_end_current(fs);
+		return;
 	}
 
 	if (op->info_only == TRUE) {
@@ -734,7 +1075,56 @@ static void sim_fs_op_info_cb(const struct ofono_error *error, int length,
 			op->record_length, op->userdata);
 
 		sim_fs_end_current(fs);
+	} else if (structure == OFONO_SIM_FILE_STRUCTURE_TRANSPARENT)
+		fs->op_source = g_idle_add(sim_fs_op_read_block, fs);
+	else
+		fs->op_source = g_idle_add(sim_fs_op_read_record, fs);
+}
+
+/* Reads a cache file into a new in-memory entry */
+static struct sim_fs_cache_entry *sim_fs_cache_load(const char *imsi,
+						enum ofono_sim_phase phase,
+						int id)
+{
+	struct sim_fs_cache_entry *entry;
+	unsigned char fileinfo[SIM_CACHE_HEADER_SIZE];
+	char *path;
+	int fd;
+	ssize_t len;
+
+	path = l_strdup_printf(SIM_CACHE_PATH, imsi, phase, id);
+	fd = L_TFR(open(path, O_RDONLY));
+	l_free(path);
+
+	if (fd == -1) {
+		if (errno != ENOENT)
+			DBG("Error %i opening cache file for "
+					"fileid %04x, IMSI %s",
+					errno, id, imsi);
+
+		return NULL;
 	}
+
+	len = L_TFR(read(fd, fileinfo, SIM_CACHE_HEADER_SIZE));
+
+	if (len != SIM_CACHE_HEADER_SIZE) {
+		L_TFR(close(fd));
+		return NULL;
+	}
+
+	entry = cache_entry_new(l_strdup_printf(SIM_CACHE_KEY, imsi, phase, id),
+				fileinfo, (fileinfo[1] << 8) | fileinfo[2]);
+
+	/* Blocks not yet fetched from the SIM are simply missing */
+	if (entry->length > 0 &&
+			L_TFR(read(fd, entry->data, entry->length)) < 0) {
+		cache_entry_unlink(entry);
+		entry = NULL;
+	}
+
+	L_TFR(close(fd));
+
+	return entry;
 }
 
 static gboolean sim_fs_op_check_cached(struct sim_fs *fs)
@@ -742,10 +1132,9 @@ static gboolean sim_fs_op_check_cached(struct sim_fs *fs)
 	const char *imsi = ofono_sim_get_imsi(fs->sim);
 	enum ofono_sim_phase phase = ofono_sim_get_phase(fs->sim);
 	struct sim_fs_op *op = g_queue_peek_head(fs->op_q);
-	char *path;
-	int fd;
-	ssize_t len;
-	unsigned char fileinfo[SIM_CACHE_HEADER_SIZE];
+	struct sim_fs_cache_entry *entry;
+	const unsigned char *fileinfo;
+	char *key;
 	int error_type;
 	int file_length;
 	enum ofono_sim_file_structure structure;
@@ -755,24 +1144,17 @@ static gboolean sim_fs_op_check_cached(struct sim_fs *fs)
 	if (imsi == NULL || phase == OFONO_SIM_PHASE_UNKNOWN)
 		return FALSE;
 
-	path = l_strdup_printf(SIM_CACHE_PATH, imsi, phase, op->id);
-	fd = L_TFR(open(path, O_RDWR));
-	l_free(path);
+	key = l_strdup_printf(SIM_CACHE_KEY, imsi, phase, op->id);
+	entry = cache_entry_lookup(key);
+	l_free(key);
 
-	if (fd == -1) {
-		if (errno != ENOENT)
-			DBG("Error %i opening cache file for "
-					"fileid %04x, IMSI %s",
-					errno, op->id, imsi);
+	if (entry == NULL)
+		entry = sim_fs_cache_load(imsi, phase, op->id);
 
+	if (entry == NULL)
 		return FALSE;
-	}
-
-	len = L_TFR(read(fd, fileinfo, SIM_CACHE_HEADER_SIZE));
-
-	if (len != SIM_CACHE_HEADER_SIZE)
-		goto error;
 
+	fileinfo = entry->header;
 	error_type = fileinfo[0];
 	file_length = (fileinfo[1] << 8) | fileinfo[2];
 	structure = fileinfo[3];
@@ -782,14 +1164,15 @@ static gboolean sim_fs_op_check_cached(struct sim_fs *fs)
 	if (structure == OFONO_SIM_FILE_STRUCTURE_TRANSPARENT)
 		record_length = file_length;
 
-	if (record_length == 0 || file_length < record_length)
-		goto error;
+	if (record_length == 0 || file_length < record_length) {
+		cache_entry_unlink(entry);
+		return FALSE;
+	}
 
 	op->length = file_length;
 	op->record_length = record_length;
-	memcpy(fs->bitmap, fileinfo + SIM_FILE_INFO_SIZE,
-			SIM_CACHE_HEADER_SIZE - SIM_FILE_INFO_SIZE);
-	fs->fd = fd;
+	fs->cache = entry;
+	fs->cache->refs += 1;
 
 	if (error_type != OFONO_ERROR_TYPE_NO_ERROR ||
 			structure != op->structure) {
@@ -797,7 +1180,12 @@ static gboolean sim_fs_op_check_cached(struct sim_fs *fs)
 		return TRUE;
 	}
 
-	if (op->info_only == TRUE) {
+	sim_fs_op_info_notify(op, 1, file_status, op->length,
+				op->record_length);
+
+	if (sim_fs_op_orphaned(op)) {
+		sim_fs_end_current(fs);
+	} else if (op->info_only == TRUE) {
 		/*
 		 * It's an info-only request, so there is no need to request
 		 * actual contents of the EF. Just return the EF-info.
@@ -820,10 +1208,6 @@ static gboolean sim_fs_op_check_cached(struct sim_fs *fs)
 	}
 
 	return TRUE;
-
-error:
-	L_TFR(close(fd));
-	return FALSE;
 }
 
 static void sim_fs_read_session_cb(const struct ofono_error *error,
@@ -831,15 +1215,13 @@ static void sim_fs_read_session_cb(const struct ofono_error *error,
 {
 	struct sim_fs *fs = data;
 	struct sim_fs_op *op = g_queue_peek_head(fs->op_q);
-	ofono_sim_file_read_cb_t cb;
 
 	if (error->type != OFONO_ERROR_TYPE_NO_ERROR) {
 		sim_fs_op_error(fs);
 		return;
 	}
 
-	cb = op->cb;
-	cb(TRUE, length, 0, sdata, length, op->userdata);
+	sim_fs_op_read_notify(op, TRUE, length, 0, sdata, length);
 
 	sim_fs_end_current(fs);
 }
@@ -863,6 +1245,13 @@ static void session_read_info_cb(const struct ofono_error *error,
 	sim_fs_op_cache_fileinfo(fs, error, filelength, structure, recordlength,
 			access, file_status);
 
+	sim_fs_op_info_notify(op, 1, file_status, filelength, recordlength);
+
+	if (sim_fs_op_orphaned(op)) {
+		sim_fs_end_current(fs);
+		return;
+	}
+
 	if (op->info_only) {
 		sim_fs_read_info_cb_t cb = op->cb;
 
@@ -932,11 +1321,13 @@ static gboolean sim_fs_op_next(gpointer user_data)
 
 	op = g_queue_peek_head(fs->op_q);
 
-	if (op->cb == NULL) {
+	if (sim_fs_op_orphaned(op)) {
 		sim_fs_end_current(fs);
 		return FALSE;
 	}
 
+	op->started = TRUE;
+
 	if (op->is_read == TRUE) {
 		if (sim_fs_op_check_cached(fs))
 			return FALSE;
@@ -986,6 +1377,59 @@ static gboolean sim_fs_op_next(gpointer user_data)
 	return FALSE;
 }
 
+static int sim_fs_op_add_waiter(struct sim_fs_op *op, gboolean info_only,
+					gconstpointer cb, void *userdata,
+					struct ofono_sim_context *context)
+{
+	struct sim_fs_waiter *w;
+
+	w = g_try_new0(struct sim_fs_waiter, 1);
+	if (w == NULL)
+		return -ENOMEM;
+
+	w->cb = cb;
+	w->userdata = userdata;
+	w->info_only = info_only;
+	w->context = context;
+
+	op->waiters = g_slist_append(op->waiters, w);
+
+	return 0;
+}
+
+/*
+ * Finds a queued read of the same EF that has not been started yet, so a
+ * new request can share its SIM access.  Reads are never moved across a
+ * pending update of the same EF.
+ */
+static struct sim_fs_op *sim_fs_find_pending_read(struct sim_fs *fs, int id,
+				enum ofono_sim_file_structure structure,
+				const unsigned char *path,
+				unsigned int path_len)
+{
+	GList *l;
+
+	for (l = g_queue_peek_tail_link(fs->op_q); l; l = l->prev) {
+		struct sim_fs_op *op = l->data;
+
+		if (op->id != id)
+			continue;
+
+		if (op->is_read == FALSE || op->started == TRUE)
+			return NULL;
+
+		if (op->structure != structure || op->path_len != path_len)
+			continue;
+
+		if (path_len && memcmp(op->path, path, path_len))
+			continue;
+
+		return op;
+	}
+
+	return NULL;
+}
+
 int sim_fs_read_info(struct ofono_sim_context *context, int id,
 			enum ofono_sim_file_structure expected_type,
 			sim_fs_read_info_cb_t cb, void *data)
@@ -1005,6 +1449,12 @@ int sim_fs_read_info(struct ofono_sim_context *context, int id,
 	if (fs->op_q == NULL)
 		fs->op_q = g_queue_new();
 
+	op = sim_fs_find_pending_read(fs, id, expected_type, NULL, 0);
+	if (op != NULL) {
+		DBG("info of %04x coalesced with a pending read", id);
+		return sim_fs_op_add_waiter(op, TRUE, cb, data, context);
+	}
+
 	op = g_try_new0(struct sim_fs_op, 1);
 	if (op == NULL)
 		return -ENOMEM;
@@ -1056,6 +1506,31 @@ int sim_fs_read(struct ofono_sim_context *context, int id,
 	if (fs->op_q == NULL)
 		fs->op_q = g_queue_new();
 
+	op = sim_fs_find_pending_read(fs, id, expected_type, path, path_len);
+
+	if (op != NULL && op->info_only == TRUE) {
+		/* Turn the info-only request into a read, EF-info comes free */
+		DBG("upgrading pending info of %04x to a read", id);
+
+		if (op->cb != NULL && sim_fs_op_add_waiter(op, TRUE, op->cb,
+						op->userdata, op->context) < 0)
+			return -ENOMEM;
+
+		op->cb = cb;
+		op->userdata = data;
+		op->context = context;
+		op->info_only = FALSE;
+		op->offset = offset;
+		op->num_bytes = num_bytes;
+
+		return 0;
+	}
+
+	if (op != NULL && op->offset == offset && op->num_bytes == num_bytes) {
+		DBG("read of %04x coalesced with a pending read", id);
+		return sim_fs_op_add_waiter(op, FALSE, cb, data, context);
+	}
+
 	op = g_try_new0(struct sim_fs_op, 1);
 	if (op == NULL)
 		return -ENOMEM;
@@ -1270,6 +1745,10 @@ void sim_fs_cache_flush(struct sim_fs *fs)
 
 	l_free(path);
 
+	path = l_strdup_printf("%s-%i/", imsi, phase);
+	cache_entries_drop(path);
+	l_free(path);
+
 	if (len > 0) {
 		/* Remove all file ids */
 		while (len--) {
@@ -1291,6 +1770,10 @@ void sim_fs_cache_flush_file(struct sim_fs *fs, int id)
 
 	remove(path);
 	l_free(path);
+
+	path = l_strdup_printf(SIM_CACHE_KEY, imsi, phase, id);
+	cache_entries_drop(path);
+	l_free(path);
 }
 
 void sim_fs_image_cache_flush(struct sim_fs *fs)
@@ -1324,3 +1807,227 @@ void sim_fs_image_cache_flush_file(struct sim_fs *fs, int id)
 	remove(path);
 	l_free(path);
 }
+
+/*
+ * SIM snapshot, one file per ICCID holding tagged records:
+ *	magic (4) | { tag (1) | length (2, big endian) | data }*
+ * The file is replaced atomically and mapped read-only when used.
+ */
+#define SIM_SNAPSHOT_PATH SIM_FS_STORAGEDIR "/snapshot-%s"
+#define SIM_SNAPSHOT_MAGIC "OSS\x01"
+#define SIM_SNAPSHOT_MAGIC_SIZE 4
+
+struct sim_fs_snapshot {
+	unsigned char *map;
+	size_t size;
+};
+
+struct sim_fs_snapshot *sim_fs_snapshot_open(const char *iccid)
+{
+	struct sim_fs_snapshot *snap;
+	struct stat st;
+	char *path;
+	void *map;
+	int fd;
+
+	if (iccid == NULL)
+		return NULL;
+
+	path = l_strdup_printf(SIM_SNAPSHOT_PATH, iccid);
+	fd = L_TFR(open(path, O_RDONLY));
+	l_free(path);
+
+	if (fd == -1)
+		return NULL;
+
+	if (fstat(fd, &st) < 0 || st.st_size < SIM_SNAPSHOT_MAGIC_SIZE) {
+		L_TFR(close(fd));
+		return NULL;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	L_TFR(close(fd));
+
+	if (map == MAP_FAILED)
+		return NULL;
+
+	if (memcmp(map, SIM_SNAPSHOT_MAGIC, SIM_SNAPSHOT_MAGIC_SIZE)) {
+		munmap(map, st.st_size);
+		return NULL;
+	}
+
+	snap = g_new0(struct sim_fs_snapshot, 1);
+	snap->map = map;
+	snap->size = st.st_size;
+
+	return snap;
+}
+
+const unsigned char *sim_fs_snapshot_get(struct sim_fs_snapshot *snap,
+						unsigned char tag,
+						unsigned int *out_len)
+{
+	size_t pos = SIM_SNAPSHOT_MAGIC_SIZE;
+
+	while (pos + 3 <= snap->size) {
+		unsigned int len = (snap->map[pos + 1] << 8) |
+					snap->map[pos + 2];
+
+		if (pos + 3 + len > snap->size)
+			break;
+
+		if (snap->map[pos] == tag) {
+			*out_len = len;
+			return snap->map + pos + 3;
+		}
+
+		pos += 3 + len;
+	}
+
+	return NULL;
+}
+
+static gboolean snapshot_get_table(struct sim_fs_snapshot *snap,
+					unsigned char tag,
+					const unsigned char **table,
+					unsigned int *len)
+{
+	*len = 0;
+	*table = sim_fs_snapshot_get(snap, tag, len);
+
+	/* Tables are optional, but never empty */
+	return *table == NULL || (*len > 0 && *len <= 255);
+}
+
+/* Validates the records of a snapshot, anything unexpected rejects it */
+gboolean sim_fs_snapshot_parse(struct sim_fs_snapshot *snap,
+					struct sim_fs_snapshot_data *out)
+{
+	const unsigned char *imsi;
+	const unsigned char *phase;
+	const unsigned char *mnc_length;
+	const unsigned char *cphs;
+	unsigned int len;
+	unsigned int i;
+
+	imsi = sim_fs_snapshot_get(snap, SIM_SNAPSHOT_IMSI, &len);
+	if (imsi == NULL || len < 6 || len > 15)
+		return FALSE;
+
+	for (i = 0; i < len; i++)
+		if (imsi[i] < '0' || imsi[i] > '9')
+			return FALSE;
+
+	out->imsi = (const char *) imsi;
+	out->imsi_len = len;
+
+	phase = sim_fs_snapshot_get(snap, SIM_SNAPSHOT_PHASE, &len);
+	if (phase == NULL || len != 1 || phase[0] >= OFONO_SIM_PHASE_UNKNOWN)
+		return FALSE;
+
+	out->phase = phase[0];
+
+	/* The IMSI is only split into MCC and MNC with a known length */
+	mnc_length = sim_fs_snapshot_get(snap, SIM_SNAPSHOT_MNC_LENGTH, &len);
+	if (mnc_length == NULL || len != 1 ||
+			(mnc_length[0] != 2 && mnc_length[0] != 3))
+		return FALSE;
+
+	out->mnc_length = mnc_length[0];
+
+	cphs = sim_fs_snapshot_get(snap, SIM_SNAPSHOT_CPHS, &len);
+	if (cphs == NULL || len != 3 || cphs[0] > OFONO_SIM_CPHS_PHASE_2G)
+		return FALSE;
+
+	out->cphs_phase = cphs[0];
+	out->cphs_service_table = cphs + 1;
+
+	if (!snapshot_get_table(snap, SIM_SNAPSHOT_EFUST, &out->efust,
+					&out->efust_length))
+		return FALSE;
+
+	if (!snapshot_get_table(snap, SIM_SNAPSHOT_EFEST, &out->efest,
+					&out->efest_length))
+		return FALSE;
+
+	if (!snapshot_get_table(snap, SIM_SNAPSHOT_EFSST, &out->efsst,
+					&out->efsst_length))
+		return FALSE;
+
+	return TRUE;
+}
+
+void sim_fs_snapshot_close(struct sim_fs_snapshot *snap)
+{
+	if (snap == NULL)
+		return;
+
+	munmap(snap->map, snap->size);
+	g_free(snap);
+}
+
+GByteArray *sim_fs_snapshot_begin(void)
+{
+	GByteArray *buf = g_byte_array_new();
+
+	return g_byte_array_append(buf,
+			(const guint8 *) SIM_SNAPSHOT_MAGIC,
+			SIM_SNAPSHOT_MAGIC_SIZE);
+}
+
+void sim_fs_snapshot_append(GByteArray *buf, unsigned char tag,
+				const void *data, unsigned int len)
+{
+	unsigned char hdr[3];
+
+	if (len > 0xffff)
+		return;
+
+	hdr[0] = tag;
+	hdr[1] = len >> 8;
+	hdr[2] = len & 0xff;
+
+	g_byte_array_append(buf, hdr, 3);
+	g_byte_array_append(buf, data, len);
+}
+
+int sim_fs_snapshot_commit(GByteArray *buf, const char *iccid)
+{
+	ssize_t r;
+
+	r = write_file(buf->data, buf->len, SIM_SNAPSHOT_PATH, iccid);
+	g_byte_array_free(buf, TRUE);
+
+	return r < 0 ? r : 0;
+}
+
+void sim_fs_snapshot_remove(const char *iccid)
+{
+	char *path;
+
+	if (iccid == NULL)
+		return;
+
+	path = l_strdup_printf(SIM_SNAPSHOT_PATH, iccid);
+	unlink(path);
+	l_free(path);
+}
+
+gboolean sim_fs_snapshot_matches(struct sim_fs_snapshot *snap,
+					const GByteArray *buf)
+{
+	return snap->size == buf->len &&
+			memcmp(snap->map, buf->data, buf->len) == 0;
+}
+
+static int sim_fs_init(void)
+{
+	return 0;
+}
+
+static void sim_fs_exit(void)
+{
+	sim_fs_cache_cleanup();
+}
+
+OFONO_MODULE(simfs, sim_fs_init, sim_fs_exit)
@@ -68,5 +68,52 @@ void sim_fs_cache_flush_file(struct sim_fs *fs, int id);
 void sim_fs_image_cache_flush(struct sim_fs *fs);
 void sim_fs_image_cache_flush_file(struct sim_fs *fs, int id);
 
+void sim_fs_get_cache_stats(unsigned int *hits, unsigned int *misses);
+void sim_fs_cache_cleanup(void);
+
+struct sim_fs_snapshot;
+
+enum sim_fs_snapshot_tag {
+	SIM_SNAPSHOT_IMSI = 1,
+	SIM_SNAPSHOT_PHASE,
+	SIM_SNAPSHOT_MNC_LENGTH,
+	SIM_SNAPSHOT_CPHS,
+	SIM_SNAPSHOT_EFUST,
+	SIM_SNAPSHOT_EFEST,
+	SIM_SNAPSHOT_EFSST,
+};
+
+/* Points into the mapped snapshot, valid until it is closed */
+struct sim_fs_snapshot_data {
+	const char *imsi;
+	unsigned int imsi_len;
+	enum ofono_sim_phase phase;
+	unsigned char mnc_length;
+	enum ofono_sim_cphs_phase cphs_phase;
+	const unsigned char *cphs_service_table;
+	const unsigned char *efust;
+	unsigned int efust_length;
+	const unsigned char *efest;
+	unsigned int efest_length;
+	const unsigned char *efsst;
+	unsigned int efsst_length;
+};
+
+struct sim_fs_snapshot *sim_fs_snapshot_open(const char *iccid);
+const unsigned char *sim_fs_snapshot_get(struct sim_fs_snapshot *snap,
+						unsigned char tag,
+						unsigned int *out_len);
+gboolean sim_fs_snapshot_parse(struct sim_fs_snapshot *snap,
+					struct sim_fs_snapshot_data *out);
+void sim_fs_snapshot_close(struct sim_fs_snapshot *snap);
+gboolean sim_fs_snapshot_matches(struct sim_fs_snapshot *snap,
+					const GByteArray *buf);
+
+GByteArray *sim_fs_snapshot_begin(void);
+void sim_fs_snapshot_append(GByteArray *buf, unsigned char tag,
+				const void *data, unsigned int len);
+int sim_fs_snapshot_commit(GByteArray *buf, const char *iccid);
+void sim_fs_snapshot_remove(const char *iccid);
+
 void sim_fs_free(struct sim_fs *fs);
 void sim_fs_context_free(struct ofono_sim_context *context);
@@ -25,6 +25,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
 
 #include <glib.h>
 #include <ell/ell.h>
@@ -35,11 +36,37 @@
 #include "smsutil.h"
 #include "missing.h"
 
+/* MCC and MNC digits, NUL padded, so an exact PLMN compares with memcmp */
+#define OPL_PLMN_KEY_LEN (OFONO_MAX_MCC_LENGTH + OFONO_MAX_MNC_LENGTH)
+
+struct opl_segment {
+	guint16 low;
+	guint16 high;
+	unsigned int order;
+	const struct opl_operator *opl;
+};
+
+/* All the OPL records for one exact PLMN, see sim_eons_optimize */
+struct opl_plmn {
+	char key[OPL_PLMN_KEY_LEN];
+	unsigned int whole_order;
+	const struct opl_operator *whole;
+	unsigned int first_segment;
+	unsigned int n_segments;
+};
+
 struct sim_eons {
 	struct sim_eons_operator_info *pnn_list;
 	GSList *opl_list;
 	gboolean pnn_valid;
 	int pnn_max;
+	gboolean opl_indexed;
+	struct opl_plmn *opl_plmns;
+	unsigned int n_opl_plmns;
+	struct opl_segment *opl_segments;
+	const struct opl_operator **opl_wildcards;
+	unsigned int *opl_wildcard_orders;
+	unsigned int n_opl_wildcards;
 };
 
 struct spdi_operator {
@@ -475,6 +502,148 @@ void ber_tlv_iter_recurse_comprehension(struct ber_tlv_iter *iter,
 	comprehension_tlv_iter_init(recurse, iter->data, iter->len);
 }
 
+unsigned int ber_tlv_index(const unsigned char *pdu, unsigned int len,
+				struct tlv_index_entry *entries,
+				unsigned int max_entries)
+{
+	struct ber_tlv_iter iter;
+	unsigned int pos = 0;
+	unsigned int n = 0;
+
+	ber_tlv_iter_init(&iter, pdu, len);
+
+	while (n < max_entries && pos < len) {
+		unsigned char tag = pdu[pos];
+
+		/*
+		 * Short tag and short length, which is all the SIM files
+		 * and toolkit use in practice.  Anything else is left to
+		 * the iterator.
+		 */
+		if (tag != 0x00 && tag != 0xff && (tag & 0x1f) != 0x1f &&
+				pos + 2 <= len && pdu[pos + 1] < 0x80 &&
+				pos + 2 + pdu[pos + 1] <= len) {
+			entries[n].tag = tag;
+			entries[n].cr = 0;
+			entries[n].offset = pos + 2;
+			entries[n].len = pdu[pos + 1];
+			pos += 2 + pdu[pos + 1];
+			n += 1;
+			continue;
+		}
+
+		iter.pos = pos;
+
+		if (!ber_tlv_iter_next(&iter))
+			break;
+
+		entries[n].tag = ber_tlv_iter_get_short_tag(&iter);
+		entries[n].cr = 0;
+		entries[n].offset = iter.data - pdu;
+		entries[n].len = iter.len;
+		pos = iter.pos;
+		n += 1;
+	}
+
+	return n;
+}
+
+unsigned int comprehension_tlv_index(const unsigned char *pdu,
+					unsigned int len,
+					struct tlv_index_entry *entries,
+					unsigned int max_entries)
+{
+	struct comprehension_tlv_iter iter;
+	unsigned int pos = 0;
+	unsigned int n = 0;
+
+	comprehension_tlv_iter_init(&iter, pdu, len);
+
+	while (n < max_entries && pos < len) {
+		unsigned char tag = pdu[pos];
+
+		/* Single byte tag and length, the iterator does the rest */
+		if (tag != 0x00 && tag != 0x80 && (tag & 0x7f) != 0x7f &&
+				pos + 2 <= len && pdu[pos + 1] < 0x80 &&
+				pos + 2 + pdu[pos + 1] <= len) {
+			entries[n].tag = tag & 0x7f;
+			entries[n].cr = tag >> 7;
+			entries[n].offset = pos + 2;
+			entries[n].len = pdu[pos + 1];
+			pos += 2 + pdu[pos + 1];
+			n += 1;
+			continue;
+		}
+
+		iter.pos = pos;
+
+		if (!comprehension_tlv_iter_next(&iter))
+			break;
+
+		entries[n].tag = iter.tag;
+		entries[n].cr = iter.cr;
+		entries[n].offset = iter.data - pdu;
+		entries[n].len = iter.len;
+		pos = iter.pos;
+		n += 1;
+	}
+
+	return n;
+}
+
+unsigned int simple_tlv_index(const unsigned char *pdu, unsigned int len,
+				struct tlv_index_entry *entries,
+				unsigned int max_entries)
+{
+	struct simple_tlv_iter iter;
+	unsigned int pos = 0;
+	unsigned int n = 0;
+
+	simple_tlv_iter_init(&iter, pdu, len);
+
+	while (n < max_entries && pos < len) {
+		/* Single byte length, the iterator handles the 3 byte form */
+		if (pos + 2 <= len && pdu[pos + 1] != 0xff &&
+				pos + 2 + pdu[pos + 1] <= len) {
+			entries[n].tag = pdu[pos];
+			entries[n].cr = 0;
+			entries[n].offset = pos + 2;
+			entries[n].len = pdu[pos + 1];
+			pos += 2 + pdu[pos + 1];
+			n += 1;
+			continue;
+		}
+
+		iter.pos = pos;
+
+		if (!simple_tlv_iter_next(&iter))
+			break;
+
+		entries[n].tag = iter.tag;
+		entries[n].cr = 0;
+		entries[n].offset = iter.data - pdu;
+		entries[n].len = iter.len;
+		pos = iter.pos;
+		n += 1;
+	}
+
+	return n;
+}
+
+const struct tlv_index_entry *tlv_index_find(
+					const struct tlv_index_entry *entries,
+					unsigned int n_entries,
+					unsigned short tag)
+{
+	unsigned int i;
+
+	for (i = 0; i < n_entries; i++)
+		if (entries[i].tag == tag)
+			return &entries[i];
+
+	return NULL;
+}
+
 static const guint8 *ber_tlv_find_by_tag(const guint8 *pdu, guint8 in_tag,
 						int in_len, int *out_len)
 {
@@ -495,6 +664,32 @@ static const guint8 *ber_tlv_find_by_tag(const guint8 *pdu, guint8 in_tag,
 	return NULL;
 }
 
+/*
+ * Looks a short tag up in an index made by ber_tlv_index.  If the index
+ * was filled up the rest of the buffer is scanned as well.
+ */
+static const guint8 *ber_tlv_index_lookup(const guint8 *pdu, int len,
+					const struct tlv_index_entry *entries,
+					unsigned int n_entries,
+					unsigned int max_entries,
+					guint8 tag, int *out_len)
+{
+	const struct tlv_index_entry *entry;
+
+	entry = tlv_index_find(entries, n_entries, tag);
+	if (entry) {
+		if (out_len)
+			*out_len = entry->len;
+
+		return pdu + entry->offset;
+	}
+
+	if (n_entries < max_entries)
+		return NULL;
+
+	return ber_tlv_find_by_tag(pdu, tag, len, out_len);
+}
+
 #define MAX_BER_TLV_HEADER 8
 
 gboolean ber_tlv_builder_init(struct ber_tlv_builder *builder,
@@ -1030,8 +1225,14 @@ void sim_eons_add_pnn_record(struct sim_eons *eons, int record,
 	const unsigned char *name;
 	int namelength;
 	struct sim_eons_operator_info *oper = &eons->pnn_list[record-1];
+	struct tlv_index_entry entries[8];
+	unsigned int n;
+
+	n = ber_tlv_index(tlv, length, entries, L_ARRAY_SIZE(entries));
 
-	name = ber_tlv_find_by_tag(tlv, 0x43, length, &namelength);
+	name = ber_tlv_index_lookup(tlv, length, entries, n,
+					L_ARRAY_SIZE(entries), 0x43,
+					&namelength);
 
 	if (name == NULL || !namelength)
 		return;
@@ -1039,13 +1240,17 @@ void sim_eons_add_pnn_record(struct sim_eons *eons, int record,
 	oper->longname = sim_network_name_parse(name, namelength,
 						&oper->long_ci);
 
-	name = ber_tlv_find_by_tag(tlv, 0x45, length, &namelength);
+	name = ber_tlv_index_lookup(tlv, length, entries, n,
+					L_ARRAY_SIZE(entries), 0x45,
+					&namelength);
 
 	if (name && namelength)
 		oper->shortname = sim_network_name_parse(name, namelength,
 							&oper->short_ci);
 
-	name = ber_tlv_find_by_tag(tlv, 0x80, length, &namelength);
+	name = ber_tlv_index_lookup(tlv, length, entries, n,
+					L_ARRAY_SIZE(entries), 0x80,
+					&namelength);
 
 	if (name && namelength)
 		oper->info = sim_string_to_utf8(name, namelength);
@@ -1070,6 +1275,27 @@ static struct opl_operator *opl_operator_alloc(const guint8 *record)
 	return oper;
 }
 
+static void sim_eons_drop_index(struct sim_eons *eons)
+{
+	g_free(eons->opl_plmns);
+	eons->opl_plmns = NULL;
+	eons->n_opl_plmns = 0;
+
+	g_free(eons->opl_segments);
+	eons->opl_segments = NULL;
+
+	g_free(eons->opl_wildcards);
+	eons->opl_wildcards = NULL;
+
+	g_free(eons->opl_wildcard_orders);
+	eons->opl_wildcard_orders = NULL;
+	eons->n_opl_wildcards = 0;
+
+	/* Back to the newest first order records are added in */
+	eons->opl_list = g_slist_reverse(eons->opl_list);
+	eons->opl_indexed = FALSE;
+}
+
 void sim_eons_add_opl_record(struct sim_eons *eons,
 				const guint8 *contents, int length)
 {
@@ -1082,12 +1308,243 @@ void sim_eons_add_opl_record(struct sim_eons *eons,
 		return;
 	}
 
+	if (eons->opl_indexed)
+		sim_eons_drop_index(eons);
+
 	eons->opl_list = g_slist_prepend(eons->opl_list, oper);
 }
 
+static void opl_plmn_key(char *key, const char *mcc, const char *mnc)
+{
+	int i;
+
+	memset(key, 0, OPL_PLMN_KEY_LEN);
+
+	for (i = 0; i < OFONO_MAX_MCC_LENGTH && mcc[i]; i++)
+		key[i] = mcc[i];
+
+	for (i = 0; i < OFONO_MAX_MNC_LENGTH && mnc[i]; i++)
+		key[OFONO_MAX_MCC_LENGTH + i] = mnc[i];
+}
+
+static gboolean opl_is_wildcard(const struct opl_operator *opl)
+{
+	return strchr(opl->mcc, 'b') != NULL || strchr(opl->mnc, 'b') != NULL;
+}
+
+static gboolean opl_is_whole_plmn(const struct opl_operator *opl)
+{
+	return opl->lac_tac_low == 0 && opl->lac_tac_high == 0xfffe;
+}
+
+static gboolean opl_matches(const struct opl_operator *opl,
+				const char *mcc, const char *mnc,
+				gboolean have_lac, guint16 lac)
+{
+	int i;
+
+	for (i = 0; i < OFONO_MAX_MCC_LENGTH; i++)
+		if (mcc[i] != opl->mcc[i] &&
+				!(opl->mcc[i] == 'b' && mcc[i]))
+			return FALSE;
+
+	for (i = 0; i < OFONO_MAX_MNC_LENGTH; i++)
+		if (mnc[i] != opl->mnc[i] &&
+				!(opl->mnc[i] == 'b' && mnc[i]))
+			return FALSE;
+
+	if (opl_is_whole_plmn(opl))
+		return TRUE;
+
+	if (have_lac == FALSE)
+		return FALSE;
+
+	return lac >= opl->lac_tac_low && lac <= opl->lac_tac_high;
+}
+
+struct opl_sort_entry {
+	char key[OPL_PLMN_KEY_LEN];
+	unsigned int order;
+	const struct opl_operator *opl;
+};
+
+static int opl_sort_entry_compare(const void *a, const void *b)
+{
+	const struct opl_sort_entry *ea = a;
+	const struct opl_sort_entry *eb = b;
+	int r = memcmp(ea->key, eb->key, OPL_PLMN_KEY_LEN);
+
+	if (r)
+		return r;
+
+	return ea->order < eb->order ? -1 : ea->order > eb->order;
+}
+
+static int guint32_compare(const void *a, const void *b)
+{
+	guint32 ua = *(const guint32 *) a;
+	guint32 ub = *(const guint32 *) b;
+
+	return ua < ub ? -1 : ua > ub;
+}
+
+/*
+ * Splits the LAC ranges of one PLMN, given in record order, into sorted
+ * disjoint segments owned by the first record covering them.  Records
+ * match in file order, so that is the one a linear walk would find.
+ */
+static unsigned int opl_build_segments(const struct opl_sort_entry *entries,
+					unsigned int n,
+					struct opl_segment *out)
+{
+	guint32 *bounds;
+	unsigned int n_bounds = 0;
+	unsigned int n_out = 0;
+	unsigned int i;
+	unsigned int j;
+
+	if (n == 0)
+		return 0;
+
+	bounds = g_new(guint32, n * 2);
+
+	for (i = 0; i < n; i++) {
+		const struct opl_operator *opl = entries[i].opl;
+
+		bounds[n_bounds++] = opl->lac_tac_low;
+		bounds[n_bounds++] = (guint32) opl->lac_tac_high + 1;
+	}
+
+	qsort(bounds, n_bounds, sizeof(guint32), guint32_compare);
+
+	for (i = 0; i + 1 < n_bounds; i++) {
+		guint32 start = bounds[i];
+		guint32 end = bounds[i + 1];
+		const struct opl_sort_entry *owner = NULL;
+
+		if (start == end)
+			continue;
+
+		/* Entries are sorted by record order, first cover wins */
+		for (j = 0; j < n; j++) {
+			const struct opl_operator *opl = entries[j].opl;
+
+			if (opl->lac_tac_low <= start &&
+					opl->lac_tac_high >= start) {
+				owner = &entries[j];
+				break;
+			}
+		}
+
+		if (owner == NULL)
+			continue;
+
+		if (n_out > 0 && out[n_out - 1].opl == owner->opl &&
+				out[n_out - 1].high + 1 == start) {
+			out[n_out - 1].high = end - 1;
+			continue;
+		}
+
+		out[n_out].low = start;
+		out[n_out].high = end - 1;
+		out[n_out].order = owner->order;
+		out[n_out].opl = owner->opl;
+		n_out += 1;
+	}
+
+	g_free(bounds);
+
+	return n_out;
+}
+
+/*
+ * Indexes the OPL records for lookups: records for an exact PLMN are
+ * grouped and sorted by PLMN, each group has its LAC/TAC ranges flattened
+ * into disjoint segments for binary search.  Records using wildcard
+ * digits are kept aside in record order, there are normally very few.
+ */
 void sim_eons_optimize(struct sim_eons *eons)
 {
+	struct opl_sort_entry *entries;
+	unsigned int n_entries = 0;
+	unsigned int n_records;
+	unsigned int order = 0;
+	unsigned int n_segments = 0;
+	unsigned int i;
+	unsigned int j;
+	GSList *l;
+
+	if (eons->opl_indexed)
+		return;
+
+	eons->opl_indexed = TRUE;
 	eons->opl_list = g_slist_reverse(eons->opl_list);
+
+	n_records = g_slist_length(eons->opl_list);
+	if (n_records == 0)
+		return;
+
+	entries = g_new0(struct opl_sort_entry, n_records);
+	eons->opl_wildcards = g_new(const struct opl_operator *, n_records);
+	eons->opl_wildcard_orders = g_new(unsigned int, n_records);
+	eons->opl_plmns = g_new0(struct opl_plmn, n_records);
+	eons->opl_segments = g_new(struct opl_segment, n_records * 2);
+
+	for (l = eons->opl_list; l; l = l->next, order++) {
+		const struct opl_operator *opl = l->data;
+
+		if (opl_is_wildcard(opl)) {
+			eons->opl_wildcards[eons->n_opl_wildcards] = opl;
+			eons->opl_wildcard_orders[eons->n_opl_wildcards] =
+									order;
+			eons->n_opl_wildcards += 1;
+			continue;
+		}
+
+		opl_plmn_key(entries[n_entries].key, opl->mcc, opl->mnc);
+		entries[n_entries].order = order;
+		entries[n_entries].opl = opl;
+		n_entries += 1;
+	}
+
+	qsort(entries, n_entries, sizeof(*entries), opl_sort_entry_compare);
+
+	for (i = 0; i < n_entries; i = j) {
+		struct opl_plmn *plmn = &eons->opl_plmns[eons->n_opl_plmns++];
+		unsigned int n_ranges = 0;
+
+		memcpy(plmn->key, entries[i].key, OPL_PLMN_KEY_LEN);
+		plmn->whole_order = UINT_MAX;
+
+		/* Move the LAC/TAC ranges to the front of the group */
+		for (j = i; j < n_entries; j++) {
+			const struct opl_operator *opl = entries[j].opl;
+
+			if (memcmp(entries[j].key, plmn->key, OPL_PLMN_KEY_LEN))
+				break;
+
+			if (opl_is_whole_plmn(opl)) {
+				if (plmn->whole == NULL) {
+					plmn->whole = opl;
+					plmn->whole_order = entries[j].order;
+				}
+
+				continue;
+			}
+
+			if (opl->lac_tac_low > opl->lac_tac_high)
+				continue;
+
+			entries[i + n_ranges++] = entries[j];
+		}
+
+		plmn->first_segment = n_segments;
+		plmn->n_segments = opl_build_segments(entries + i, n_ranges,
+					eons->opl_segments + n_segments);
+		n_segments += plmn->n_segments;
+	}
+
+	g_free(entries);
 }
 
 void sim_eons_free(struct sim_eons *eons)
@@ -1104,50 +1561,106 @@ void sim_eons_free(struct sim_eons *eons)
 
 	g_slist_free_full(eons->opl_list, g_free);
 
+	g_free(eons->opl_plmns);
+	g_free(eons->opl_segments);
+	g_free(eons->opl_wildcards);
+	g_free(eons->opl_wildcard_orders);
+
 	g_free(eons);
 }
 
+static int opl_plmn_compare(const void *key, const void *elem)
+{
+	const struct opl_plmn *plmn = elem;
+
+	return memcmp(key, plmn->key, OPL_PLMN_KEY_LEN);
+}
+
+static const struct opl_segment *opl_segment_find(
+					const struct opl_segment *segments,
+					unsigned int n, guint16 lac)
+{
+	unsigned int lo = 0;
+	unsigned int hi = n;
+
+	/* Find the first segment ending at or after lac */
+	while (lo < hi) {
+		unsigned int mid = (lo + hi) / 2;
+
+		if (segments[mid].high < lac)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo == n || segments[lo].low > lac)
+		return NULL;
+
+	return &segments[lo];
+}
+
 static const struct sim_eons_operator_info *
 	sim_eons_lookup_common(struct sim_eons *eons,
 				const char *mcc, const char *mnc,
 				gboolean have_lac, guint16 lac)
 {
+	const struct opl_operator *opl = NULL;
+	unsigned int order = UINT_MAX;
+	const struct opl_plmn *plmn;
+	char key[OPL_PLMN_KEY_LEN];
+	unsigned int i;
 	GSList *l;
-	const struct opl_operator *opl;
-	int i;
 
-	for (l = eons->opl_list; l; l = l->next) {
-		opl = l->data;
+	/*
+	 * Until sim_eons_optimize is called, e.g. while EFopl is still
+	 * being read, walk the records.  They are kept newest first, so
+	 * the last match is the first one in record order.
+	 */
+	if (eons->opl_indexed == FALSE) {
+		for (l = eons->opl_list; l; l = l->next)
+			if (opl_matches(l->data, mcc, mnc, have_lac, lac))
+				opl = l->data;
 
-		for (i = 0; i < OFONO_MAX_MCC_LENGTH; i++)
-			if (mcc[i] != opl->mcc[i] &&
-					!(opl->mcc[i] == 'b' && mcc[i]))
-				break;
-		if (i < OFONO_MAX_MCC_LENGTH)
-			continue;
+		goto out;
+	}
 
-		for (i = 0; i < OFONO_MAX_MNC_LENGTH; i++)
-			if (mnc[i] != opl->mnc[i] &&
-					!(opl->mnc[i] == 'b' && mnc[i]))
-				break;
-		if (i < OFONO_MAX_MNC_LENGTH)
-			continue;
+	opl_plmn_key(key, mcc, mnc);
+	plmn = bsearch(key, eons->opl_plmns, eons->n_opl_plmns,
+				sizeof(struct opl_plmn), opl_plmn_compare);
 
-		if (opl->lac_tac_low == 0 && opl->lac_tac_high == 0xfffe)
-			break;
+	if (plmn) {
+		opl = plmn->whole;
+		order = plmn->whole_order;
+	}
 
-		if (have_lac == FALSE)
-			continue;
+	if (plmn && have_lac) {
+		const struct opl_segment *seg;
 
-		if ((lac >= opl->lac_tac_low) && (lac <= opl->lac_tac_high))
+		seg = opl_segment_find(eons->opl_segments +
+					plmn->first_segment,
+					plmn->n_segments, lac);
+
+		if (seg && seg->order < order) {
+			opl = seg->opl;
+			order = seg->order;
+		}
+	}
+
+	for (i = 0; i < eons->n_opl_wildcards; i++) {
+		if (eons->opl_wildcard_orders[i] > order)
+			break;
+
+		if (opl_matches(eons->opl_wildcards[i], mcc, mnc,
+							have_lac, lac)) {
+			opl = eons->opl_wildcards[i];
 			break;
+		}
 	}
 
-	if (l == NULL)
+out:
+	if (opl == NULL)
 		return NULL;
 
-	opl = l->data;
-
 	/* 0 is not a valid record id */
 	if (opl->id == 0)
 		return NULL;
@@ -1392,17 +1905,23 @@ gboolean sim_parse_3g_get_response(const unsigned char *data, int len,
 	unsigned short id;
 	unsigned char acc[3];
 	struct sim_ef_info *info;
+	struct tlv_index_entry entries[16];
+	unsigned int n;
 
 	fcp = ber_tlv_find_by_tag(data, 0x62, len, &fcp_length);
 
 	if (fcp == NULL)
 		return FALSE;
 
+	n = ber_tlv_index(fcp, fcp_length, entries, L_ARRAY_SIZE(entries));
+
 	/*
 	 * Find the file size tag 0x80 according to
 	 * ETSI 102.221 Section 11.1.1.3.2
 	 */
-	tlv = ber_tlv_find_by_tag(fcp, 0x80, fcp_length, &tlv_length);
+	tlv = ber_tlv_index_lookup(fcp, fcp_length, entries, n,
+					L_ARRAY_SIZE(entries), 0x80,
+					&tlv_length);
 
 	if (tlv == NULL || tlv_length < 2)
 		return FALSE;
@@ -1411,14 +1930,18 @@ gboolean sim_parse_3g_get_response(const unsigned char *data, int len,
 	for (i = 1; i < tlv_length; i++)
 		flen = (flen << 8) | tlv[i];
 
-	tlv = ber_tlv_find_by_tag(fcp, 0x83, fcp_length, &tlv_length);
+	tlv = ber_tlv_index_lookup(fcp, fcp_length, entries, n,
+					L_ARRAY_SIZE(entries), 0x83,
+					&tlv_length);
 
 	if (tlv == NULL || tlv_length != 2)
 		return FALSE;
 
 	id = (tlv[0] << 8) | tlv[1];
 
-	tlv = ber_tlv_find_by_tag(fcp, 0x82, fcp_length, &tlv_length);
+	tlv = ber_tlv_index_lookup(fcp, fcp_length, entries, n,
+					L_ARRAY_SIZE(entries), 0x82,
+					&tlv_length);
 
 	if (tlv == NULL || (tlv_length != 2 && tlv_length != 5))
 		return FALSE;
@@ -378,6 +378,19 @@ struct data_block {
 	unsigned int len;
 };
 
+/*
+ * One TLV found by ber_tlv_index, comprehension_tlv_index or
+ * simple_tlv_index.  For BER TLVs the tag is the short tag as returned by
+ * ber_tlv_iter_get_short_tag, for COMPREHENSION-TLVs it is the tag without
+ * the CR flag.
+ */
+struct tlv_index_entry {
+	unsigned short tag;
+	unsigned char cr;
+	unsigned int offset;
+	unsigned int len;
+};
+
 void simple_tlv_iter_init(struct simple_tlv_iter *iter,
 				const unsigned char *pdu, unsigned int len);
 gboolean simple_tlv_iter_next(struct simple_tlv_iter *iter);
@@ -444,6 +457,27 @@ void ber_tlv_iter_recurse_simple(struct ber_tlv_iter *iter,
 void ber_tlv_iter_recurse_comprehension(struct ber_tlv_iter *iter,
 					struct comprehension_tlv_iter *recurse);
 
+/*
+ * Decode the TLVs of a buffer in one pass into the entries array, so that
+ * they can be looked up without walking the buffer again.  Stops at the
+ * first malformed TLV, like the iterators, or once max_entries have been
+ * filled.  Returns the number of entries used.
+ */
+unsigned int ber_tlv_index(const unsigned char *pdu, unsigned int len,
+				struct tlv_index_entry *entries,
+				unsigned int max_entries);
+unsigned int comprehension_tlv_index(const unsigned char *pdu,
+					unsigned int len,
+					struct tlv_index_entry *entries,
+					unsigned int max_entries);
+unsigned int simple_tlv_index(const unsigned char *pdu, unsigned int len,
+				struct tlv_index_entry *entries,
+				unsigned int max_entries);
+const struct tlv_index_entry *tlv_index_find(
+					const struct tlv_index_entry *entries,
+					unsigned int n_entries,
+					unsigned short tag);
+
 gboolean ber_tlv_builder_init(struct ber_tlv_builder *builder,
 				unsigned char *pdu, unsigned int size);
 gboolean ber_tlv_builder_next(struct ber_tlv_builder *builder,
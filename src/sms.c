@@ -29,7 +29,6 @@
 #include <glib.h>
 #include <ell/ell.h>
 #include <gdbus.h>
-#include <sys/time.h>
 
 #include "ofono.h"
 
@@ -68,6 +67,8 @@ struct ofono_sms {
 	GQueue *txq;
 	unsigned long tx_counter;
 	guint tx_source;
+	GQueue *tx_inflight;
+	unsigned int tx_max_inflight;
 	struct ofono_message_waiting *mw;
 	unsigned int mw_watch;
 	ofono_bool_t registered;
@@ -83,21 +84,31 @@ struct ofono_sms {
 	struct ofono_atom *atom;
 	ofono_bool_t use_delivery_reports;
 	struct status_report_assembly *sr_assembly;
+	guint sr_sync_source;
 	GHashTable *messages;
 	struct ofono_watchlist *text_handlers;
 	struct ofono_watchlist *datagram_handlers;
 };
 
+enum pending_pdu_state {
+	PENDING_PDU_QUEUED = 0,
+	PENDING_PDU_SUBMITTED,
+	PENDING_PDU_SENT,
+};
+
 struct pending_pdu {
 	unsigned char pdu[176];
 	int tpdu_len;
 	int pdu_len;
+	enum pending_pdu_state state;
 };
 
 struct tx_queue_entry {
 	struct pending_pdu *pdus;
 	unsigned char num_pdus;
 	unsigned char cur_pdu;
+	unsigned char inflight;
+	gboolean failed;
 	struct sms_address receiver;
 	struct ofono_uuid uuid;
 	unsigned int retry;
@@ -108,6 +119,12 @@ struct tx_queue_entry {
 	unsigned long id;
 };
 
+/* A PDU handed to the driver, completions arrive in submission order */
+struct tx_submit {
+	struct tx_queue_entry *entry;
+	unsigned char pdu;
+};
+
 static gboolean uuid_equal(gconstpointer v1, gconstpointer v2)
 {
 	return memcmp(v1, v2, OFONO_SHA1_UUID_LEN) == 0;
@@ -706,104 +723,209 @@ done:
 	tx_queue_entry_destroy(entry);
 }
 
+static gboolean sr_assembly_sync_cb(gpointer user_data)
+{
+	struct ofono_sms *sms = user_data;
+
+	sms->sr_sync_source = 0;
+	status_report_assembly_sync(sms->sr_assembly);
+
+	return FALSE;
+}
+
+/* Batch status report backup writes to one per main loop iteration */
+static void sr_assembly_schedule_sync(struct ofono_sms *sms)
+{
+	if (sms->sr_sync_source)
+		return;
+
+	if (!status_report_assembly_needs_sync(sms->sr_assembly))
+		return;
+
+	sms->sr_sync_source = g_idle_add(sr_assembly_sync_cb, sms);
+}
+
+/* Runs tx_next() from the main loop unless it is already scheduled */
+static void tx_schedule_next(struct ofono_sms *sms)
+{
+	if (sms->tx_source)
+		return;
+
+	sms->tx_source = g_timeout_add(0, tx_next, sms);
+}
+
 static void tx_finished(const struct ofono_error *error, int mr, void *data)
 {
 	struct ofono_sms *sms = data;
-	struct tx_queue_entry *entry = g_queue_peek_head(sms->txq);
+	struct tx_submit *submit = g_queue_pop_head(sms->tx_inflight);
+	struct tx_queue_entry *entry = submit->entry;
+	unsigned char index = submit->pdu;
 	gboolean ok = error->type == OFONO_ERROR_TYPE_NO_ERROR;
 	enum message_state tx_state;
 
-	DBG("tx_finished %p", entry);
+	DBG("tx_finished %p pdu %u", entry, index);
 
-	sms->flags &= ~MESSAGE_MANAGER_FLAG_TXQ_ACTIVE;
+	g_free(submit);
+	entry->inflight -= 1;
+
+	if (g_queue_is_empty(sms->tx_inflight))
+		sms->flags &= ~MESSAGE_MANAGER_FLAG_TXQ_ACTIVE;
 
 	if (ok == FALSE) {
+		entry->pdus[index].state = PENDING_PDU_QUEUED;
+
+		if (entry->failed)
+			goto next_q;
+
 		/* Retry again when back in online mode */
 		/* Note this does not increment retry count */
 		if (sms->registered == FALSE)
 			return;
 
-		tx_state = MESSAGE_STATE_FAILED;
-
 		/* Retry done only for Network Timeout failure */
 		if (error->type == OFONO_ERROR_TYPE_CMS &&
 				error->error != NETWORK_TIMEOUT)
-			goto next_q;
+			goto failed;
 
 		if (!(entry->flags & OFONO_SMS_SUBMIT_FLAG_RETRY))
-			goto next_q;
+			goto failed;
 
 		entry->retry += 1;
 
 		if (entry->retry < TXQ_MAX_RETRIES) {
 			DBG("Sending failed, retry in %d secs",
 					entry->retry * 5);
+
+			/* Hold back further submissions until the retry */
+			if (sms->tx_source)
+				g_source_remove(sms->tx_source);
+
 			sms->tx_source = g_timeout_add_seconds(entry->retry * 5,
 								tx_next, sms);
 			return;
 		}
 
 		DBG("Max retries reached, giving up");
+
+failed:
+		entry->failed = TRUE;
 		goto next_q;
 	}
 
 	if (entry->flags & OFONO_SMS_SUBMIT_FLAG_EXPOSE_DBUS)
 		sms_tx_backup_remove(sms->imsi, entry->id, entry->flags,
 						ofono_uuid_to_str(&entry->uuid),
-						entry->cur_pdu);
+						index);
 
+	entry->pdus[index].state = PENDING_PDU_SENT;
 	entry->cur_pdu += 1;
 	entry->retry = 0;
 
-	if (entry->flags & OFONO_SMS_SUBMIT_FLAG_REQUEST_SR)
+	if (entry->flags & OFONO_SMS_SUBMIT_FLAG_REQUEST_SR) {
 		status_report_assembly_add_fragment(sms->sr_assembly,
 							entry->uuid.uuid,
 							&entry->receiver,
 							mr, time(NULL),
 							entry->num_pdus);
-
-	if (entry->cur_pdu < entry->num_pdus) {
-		sms->tx_source = g_timeout_add(0, tx_next, sms);
-		return;
+		sr_assembly_schedule_sync(sms);
 	}
 
-	tx_state = MESSAGE_STATE_SENT;
-
 next_q:
-	sms_tx_queue_remove_entry(sms, g_queue_peek_head_link(sms->txq),
-					tx_state);
+	/* Other parts of this message may still be with the driver */
+	if (entry->inflight == 0 &&
+			(entry->failed || entry->cur_pdu == entry->num_pdus)) {
+		tx_state = entry->failed ? MESSAGE_STATE_FAILED :
+							MESSAGE_STATE_SENT;
+
+		sms_tx_queue_remove_entry(sms, g_queue_find(sms->txq, entry),
+						tx_state);
+	}
 
 	if (sms->registered == FALSE)
 		return;
 
 	if (g_queue_peek_head(sms->txq)) {
 		DBG("Scheduling next");
-		sms->tx_source = g_timeout_add(0, tx_next, sms);
+		tx_schedule_next(sms);
 	}
 }
 
+/*
+ * Finds the first PDU that still has to be handed to the driver.  Entries
+ * are served in queue order, so only the entries at the head of the queue
+ * that are already fully submitted are skipped.
+ */
+static struct tx_queue_entry *tx_find_next(struct ofono_sms *sms,
+						unsigned char *out_pdu,
+						gboolean *out_more)
+{
+	GList *l;
+	struct tx_queue_entry *entry;
+	unsigned char i;
+
+	for (l = g_queue_peek_head_link(sms->txq); l; l = l->next) {
+		entry = l->data;
+
+		if (entry->failed)
+			continue;
+
+		for (i = 0; i < entry->num_pdus; i++)
+			if (entry->pdus[i].state == PENDING_PDU_QUEUED)
+				break;
+
+		if (i == entry->num_pdus)
+			continue;
+
+		*out_pdu = i;
+		*out_more = l->next != NULL ||
+				entry->num_pdus - entry->cur_pdu -
+							entry->inflight > 1;
+
+		return entry;
+	}
+
+	return NULL;
+}
+
 static gboolean tx_next(gpointer user_data)
 {
 	struct ofono_sms *sms = user_data;
-	int send_mms = 0;
-	struct tx_queue_entry *entry = g_queue_peek_head(sms->txq);
-	struct pending_pdu *pdu = &entry->pdus[entry->cur_pdu];
-
-	DBG("tx_next: %p", entry);
+	struct tx_queue_entry *entry;
+	struct tx_submit *submit;
+	struct pending_pdu *pdu;
+	unsigned char index;
+	gboolean more;
 
 	sms->tx_source = 0;
 
 	if (sms->registered == FALSE)
 		return FALSE;
 
-	if (g_queue_get_length(sms->txq) > 1
-			|| (entry->num_pdus - entry->cur_pdu) > 1)
-		send_mms = 1;
+	while (g_queue_get_length(sms->tx_inflight) < sms->tx_max_inflight) {
+		entry = tx_find_next(sms, &index, &more);
+		if (entry == NULL)
+			break;
+
+		DBG("tx_next: %p pdu %u", entry, index);
+
+		pdu = &entry->pdus[index];
+		pdu->state = PENDING_PDU_SUBMITTED;
+		entry->inflight += 1;
+
+		submit = g_new0(struct tx_submit, 1);
+		submit->entry = entry;
+		submit->pdu = index;
+		g_queue_push_tail(sms->tx_inflight, submit);
 
-	sms->flags |= MESSAGE_MANAGER_FLAG_TXQ_ACTIVE;
+		sms->flags |= MESSAGE_MANAGER_FLAG_TXQ_ACTIVE;
 
-	sms->driver->submit(sms, pdu->pdu, pdu->pdu_len, pdu->tpdu_len,
-				send_mms, tx_finished, sms);
+		/* The driver may complete the submission synchronously */
+		sms->driver->submit(sms, pdu->pdu, pdu->pdu_len, pdu->tpdu_len,
+					more ? 1 : 0, tx_finished, sms);
+
+		if (sms->tx_source)
+			break;
+	}
 
 	return FALSE;
 }
@@ -832,7 +954,7 @@ static void netreg_status_watch(int status, int lac, int ci, int tech,
 	if (sms->tx_source > 0)
 		return;
 
-	if (sms->flags & MESSAGE_MANAGER_FLAG_TXQ_ACTIVE)
+	if (g_queue_get_length(sms->tx_inflight) >= sms->tx_max_inflight)
 		return;
 
 	if (g_queue_get_length(sms->txq))
@@ -862,49 +984,9 @@ static void netreg_watch(struct ofono_atom *atom,
 }
 
 
-/**
- * Generate a UUID from an SMS PDU List
- *
- * @param pdu Pointer to array of PDUs data to generate the ID from
- * @param pdus Number of entries in the \e pdu array
- * @return 0 in error (no memory or serious code inconsistency in the
- *     input data structures), otherwise the SMS UUID.
- *
- * @internal
- *
- * The current time is added to avoid the UUID being the same when the
- * same message is sent to the same destination repeatedly. Note we
- * need a high resolution time (not just seconds), otherwise resending
- * in the same second (not that rare) could yield the same UUID.
- */
-static gboolean sms_uuid_from_pdus(const struct pending_pdu *pdu,
-					unsigned char pdus,
-					struct ofono_uuid *uuid)
-
-{
-	GChecksum *checksum;
-	gsize uuid_size = sizeof(uuid->uuid);
-	unsigned int cnt;
-	struct timeval now;
-
-	checksum = g_checksum_new(G_CHECKSUM_SHA1);
-	if (checksum == NULL)
-		return FALSE;
-
-	for (cnt = 0; cnt < pdus; cnt++)
-		g_checksum_update(checksum, pdu[cnt].pdu, pdu[cnt].pdu_len);
-
-	gettimeofday(&now, NULL);
-	g_checksum_update(checksum, (void *) &now, sizeof(now));
-
-	g_checksum_get_digest(checksum, uuid->uuid, &uuid_size);
-	g_checksum_free(checksum);
-
-	return TRUE;
-}
-
 static struct tx_queue_entry *tx_queue_entry_new(GSList *msg_list,
-							unsigned int flags)
+							unsigned int flags,
+							unsigned long seq)
 {
 	struct tx_queue_entry *entry;
 	int i = 0;
@@ -939,11 +1021,11 @@ static struct tx_queue_entry *tx_queue_entry_new(GSList *msg_list,
 				pdu->pdu_len, pdu->tpdu_len);
 	}
 
-	if (flags & OFONO_SMS_SUBMIT_FLAG_REUSE_UUID)
-		return entry;
+	if (!(flags & OFONO_SMS_SUBMIT_FLAG_REUSE_UUID))
+		sms_tx_msgid(msg_list, seq, g_get_real_time(),
+							entry->uuid.uuid);
 
-	if (sms_uuid_from_pdus(entry->pdus, entry->num_pdus, &entry->uuid))
-		return entry;
+	return entry;
 
 error:
 	g_free(entry->pdus);
@@ -1036,6 +1118,149 @@ static DBusMessage *sms_send_message(DBusConnection *conn, DBusMessage *msg,
 	return NULL;
 }
 
+static guint sms_next_ref(guint ref)
+{
+	if (ref == 65536)
+		return 1;
+
+	return ref + 1;
+}
+
+struct send_messages_item {
+	const char *to;
+	const char *text;
+	GSList *msg_list;
+	struct ofono_uuid uuid;
+	gboolean queued;
+};
+
+static void send_messages_item_free(gpointer data)
+{
+	struct send_messages_item *item = data;
+
+	g_slist_free_full(item->msg_list, g_free);
+	g_free(item);
+}
+
+/*
+ * Queue a batch of text messages [D-Bus SendMessages()]
+ *
+ * Every message is validated and segmented before any of them is queued,
+ * so that either the whole batch is queued or none of it.  The concat
+ * references are assigned the same way __ofono_sms_txq_submit() does.
+ */
+static DBusMessage *sms_send_messages(DBusConnection *conn, DBusMessage *msg,
+					void *data)
+{
+	struct ofono_sms *sms = data;
+	struct ofono_modem *modem = __ofono_atom_get_modem(sms->atom);
+	struct send_messages_item *item;
+	DBusMessageIter iter, array, entry, paths;
+	DBusMessage *reply;
+	GSList *items = NULL;
+	GSList *l;
+	guint ref = sms->ref;
+	unsigned int flags;
+	const char *path;
+
+	if (!dbus_message_iter_init(msg, &iter))
+		return __ofono_error_invalid_args(msg);
+
+	dbus_message_iter_recurse(&iter, &array);
+
+	while (dbus_message_iter_get_arg_type(&array) == DBUS_TYPE_STRUCT) {
+		const char *to;
+		const char *text;
+		GSList *msg_list;
+
+		dbus_message_iter_recurse(&array, &entry);
+		dbus_message_iter_get_basic(&entry, &to);
+		dbus_message_iter_next(&entry);
+		dbus_message_iter_get_basic(&entry, &text);
+
+		if (valid_phone_number_format(to) == FALSE)
+			goto invalid_format;
+
+		msg_list = sms_text_prepare_with_alphabet(to, text, ref, FALSE,
+						sms->use_delivery_reports,
+						sms->alphabet);
+		if (msg_list == NULL)
+			goto invalid_format;
+
+		if (msg_list->next != NULL)
+			ref = sms_next_ref(ref);
+
+		item = g_new0(struct send_messages_item, 1);
+		item->to = to;
+		item->text = text;
+		item->msg_list = msg_list;
+		items = g_slist_prepend(items, item);
+
+		dbus_message_iter_next(&array);
+	}
+
+	if (items == NULL)
+		return __ofono_error_invalid_args(msg);
+
+	items = g_slist_reverse(items);
+
+	flags = OFONO_SMS_SUBMIT_FLAG_RECORD_HISTORY;
+	flags |= OFONO_SMS_SUBMIT_FLAG_RETRY;
+	flags |= OFONO_SMS_SUBMIT_FLAG_EXPOSE_DBUS;
+	if (sms->use_delivery_reports)
+		flags |= OFONO_SMS_SUBMIT_FLAG_REQUEST_SR;
+
+	for (l = items; l; l = l->next) {
+		item = l->data;
+
+		if (__ofono_sms_txq_submit(sms, item->msg_list, flags,
+						&item->uuid, NULL, NULL) < 0)
+			goto failed;
+
+		item->queued = TRUE;
+	}
+
+	reply = dbus_message_new_method_return(msg);
+	dbus_message_iter_init_append(reply, &iter);
+	dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+					DBUS_TYPE_OBJECT_PATH_AS_STRING,
+					&paths);
+
+	for (l = items; l; l = l->next) {
+		item = l->data;
+
+		path = __ofono_sms_message_path_from_uuid(sms, &item->uuid);
+		dbus_message_iter_append_basic(&paths, DBUS_TYPE_OBJECT_PATH,
+						&path);
+
+		__ofono_history_sms_send_pending(modem, &item->uuid, item->to,
+						time(NULL), item->text);
+	}
+
+	dbus_message_iter_close_container(&iter, &paths);
+	g_slist_free_full(items, send_messages_item_free);
+
+	return reply;
+
+failed:
+	/* Nothing has been handed to the driver yet, drop the whole batch */
+	for (l = items; l; l = l->next) {
+		item = l->data;
+
+		if (item->queued)
+			__ofono_sms_txq_cancel(sms, &item->uuid);
+	}
+
+	g_slist_free_full(items, send_messages_item_free);
+
+	return __ofono_error_failed(msg);
+
+invalid_format:
+	g_slist_free_full(items, send_messages_item_free);
+
+	return __ofono_error_invalid_format(msg);
+}
+
 static DBusMessage *sms_get_messages(DBusConnection *conn, DBusMessage *msg,
 					void *data)
 {
@@ -1113,16 +1338,14 @@ int __ofono_sms_txq_cancel(struct ofono_sms *sms, const struct ofono_uuid *uuid)
 
 	entry = l->data;
 
-	if (entry == g_queue_peek_head(sms->txq)) {
-		/*
-		 * Fail if any pdu was already transmitted or if we are
-		 * waiting the answer from driver.
-		 */
-		if (entry->cur_pdu > 0)
-			return -EPERM;
+	/*
+	 * Fail if any pdu was already transmitted or if we are
+	 * waiting the answer from driver.
+	 */
+	if (entry->cur_pdu > 0 || entry->inflight > 0)
+		return -EPERM;
 
-		if (sms->flags & MESSAGE_MANAGER_FLAG_TXQ_ACTIVE)
-			return -EPERM;
+	if (entry == g_queue_peek_head(sms->txq)) {
 		/*
 		 * Make sure we don't call tx_next() if there are no entries
 		 * and that next entry doesn't have to wait a 'retry time'
@@ -1153,6 +1376,10 @@ static const GDBusMethodTable sms_manager_methods[] = {
 			GDBUS_ARGS({ "to", "s" }, { "text", "s" }),
 			GDBUS_ARGS({ "path", "o" }),
 			sms_send_message) },
+	{ GDBUS_METHOD("SendMessages",
+			GDBUS_ARGS({ "messages", "a(ss)" }),
+			GDBUS_ARGS({ "paths", "ao" }),
+			sms_send_messages) },
 	{ GDBUS_METHOD("GetMessages",
 			NULL, GDBUS_ARGS({ "messages", "a(oa{sv})" }),
 			sms_get_messages) },
@@ -1219,15 +1446,18 @@ static void dispatch_app_datagram(struct ofono_sms *sms,
 	struct tm local;
 
 	ofono_sms_datagram_notify_cb_t notify;
+	struct ofono_watchlist_item *item;
 	struct sms_handler *h;
-	GSList *l;
 	gboolean dispatched = FALSE;
 
 	ts = sms_scts_to_time(scts, &remote);
 	localtime_r(&ts, &local);
 
-	for (l = sms->datagram_handlers->items; l; l = l->next) {
-		h = l->data;
+	__ofono_watchlist_dispatch_begin(sms->datagram_handlers);
+
+	for (item = __ofono_watchlist_first(sms->datagram_handlers); item;
+					item = __ofono_watchlist_next(item)) {
+		h = (struct sms_handler *) item;
 		notify = h->item.notify;
 
 		if (!port_equal(dst, h->dst) || !port_equal(src, h->src))
@@ -1239,6 +1469,8 @@ static void dispatch_app_datagram(struct ofono_sms *sms,
 			h->item.notify_data);
 	}
 
+	__ofono_watchlist_dispatch_end(sms->datagram_handlers);
+
 	if (!dispatched)
 		ofono_info("Datagram with ports [%d,%d] not delivered",
 								dst, src);
@@ -1264,8 +1496,8 @@ static void dispatch_text_message(struct ofono_sms *sms,
 	struct tm local;
 	const char *str = buf;
 	ofono_sms_text_notify_cb_t notify;
+	struct ofono_watchlist_item *item;
 	struct sms_handler *h;
-	GSList *l;
 
 	if (message == NULL)
 		return;
@@ -1310,13 +1542,18 @@ static void dispatch_text_message(struct ofono_sms *sms,
 	if (cls == SMS_CLASS_0)
 		return;
 
-	for (l = sms->text_handlers->items; l; l = l->next) {
-		h = l->data;
+	__ofono_watchlist_dispatch_begin(sms->text_handlers);
+
+	for (item = __ofono_watchlist_first(sms->text_handlers); item;
+					item = __ofono_watchlist_next(item)) {
+		h = (struct sms_handler *) item;
 		notify = h->item.notify;
 
 		notify(str, &remote, &local, message, h->item.notify_data);
 	}
 
+	__ofono_watchlist_dispatch_end(sms->text_handlers);
+
 	__ofono_history_sms_received(modem, uuid, str, &remote, &local,
 					message);
 }
@@ -1477,12 +1714,16 @@ static void handle_sms_status_report(struct ofono_sms *sms,
 {
 	struct ofono_modem *modem = __ofono_atom_get_modem(sms->atom);
 	gboolean delivered;
+	gboolean reported;
 	struct ofono_uuid uuid;
 
 	DBG("");
 
-	if (status_report_assembly_report(sms->sr_assembly, incoming, uuid.uuid,
-						&delivered) == FALSE)
+	reported = status_report_assembly_report(sms->sr_assembly, incoming,
+							uuid.uuid, &delivered);
+	sr_assembly_schedule_sync(sms);
+
+	if (reported == FALSE)
 		return;
 
 	__ofono_history_sms_send_status(modem, &uuid, time(NULL),
@@ -1758,6 +1999,11 @@ static void sms_remove(struct ofono_atom *atom)
 		sms->assembly = NULL;
 	}
 
+	if (sms->tx_inflight) {
+		g_queue_free_full(sms->tx_inflight, g_free);
+		sms->tx_inflight = NULL;
+	}
+
 	if (sms->txq) {
 		g_queue_foreach(sms->txq, tx_queue_entry_destroy_foreach, NULL);
 		g_queue_free(sms->txq);
@@ -1782,6 +2028,11 @@ static void sms_remove(struct ofono_atom *atom)
 		sms->settings = NULL;
 	}
 
+	if (sms->sr_sync_source) {
+		g_source_remove(sms->sr_sync_source);
+		sms->sr_sync_source = 0;
+	}
+
 	if (sms->sr_assembly) {
 		status_report_assembly_free(sms->sr_assembly);
 		sms->sr_assembly = NULL;
@@ -1794,6 +2045,8 @@ OFONO_DEFINE_ATOM_CREATE(sms, OFONO_ATOM_TYPE_SMS, {
 	atom->sca.type = 129;
 	atom->ref = 1;
 	atom->txq = g_queue_new();
+	atom->tx_inflight = g_queue_new();
+	atom->tx_max_inflight = 1;
 	atom->messages = g_hash_table_new(uuid_hash, uuid_equal);
 })
 
@@ -1891,7 +2144,8 @@ static void sms_restore_tx_queue(struct ofono_sms *sms)
 
 		backup_entry->flags |= OFONO_SMS_SUBMIT_FLAG_REUSE_UUID;
 		txq_entry = tx_queue_entry_new(backup_entry->msg_list,
-							backup_entry->flags);
+							backup_entry->flags,
+							sms->tx_counter);
 		if (txq_entry == NULL)
 			goto loop_out;
 
@@ -1977,6 +2231,7 @@ void ofono_sms_register(struct ofono_sms *sms)
 		sms->assembly = sms_assembly_new(imsi);
 
 		sms->sr_assembly = status_report_assembly_new(imsi);
+		sr_assembly_schedule_sync(sms);
 
 		sms_load_settings(sms, imsi);
 	} else {
@@ -2012,6 +2267,17 @@ void *ofono_sms_get_data(struct ofono_sms *sms)
 	return sms->driver_data;
 }
 
+void ofono_sms_set_max_pending_submits(struct ofono_sms *sms,
+					unsigned int max)
+{
+	if (max == 0)
+		max = 1;
+
+	DBG("%u", max);
+
+	sms->tx_max_inflight = max;
+}
+
 unsigned short __ofono_sms_get_next_ref(struct ofono_sms *sms)
 {
 	return sms->ref;
@@ -2025,7 +2291,7 @@ int __ofono_sms_txq_submit(struct ofono_sms *sms, GSList *list,
 	struct message *m = NULL;
 	struct tx_queue_entry *entry;
 
-	entry = tx_queue_entry_new(list, flags);
+	entry = tx_queue_entry_new(list, flags, sms->tx_counter);
 	if (entry == NULL)
 		return -ENOMEM;
 
@@ -2042,19 +2308,17 @@ int __ofono_sms_txq_submit(struct ofono_sms *sms, GSList *list,
 		g_hash_table_insert(sms->messages, &entry->uuid, m);
 	}
 
-	if (list->next != NULL) {
-		if (sms->ref == 65536)
-			sms->ref = 1;
-		else
-			sms->ref = sms->ref + 1;
-	}
+	if (list->next != NULL)
+		sms->ref = sms_next_ref(sms->ref);
 
 	entry->id = sms->tx_counter++;
 
 	g_queue_push_tail(sms->txq, entry);
 
-	if (sms->registered && g_queue_get_length(sms->txq) == 1)
-		sms->tx_source = g_timeout_add(0, tx_next, sms);
+	if (sms->registered &&
+			g_queue_get_length(sms->tx_inflight) <
+						sms->tx_max_inflight)
+		tx_schedule_next(sms);
 
 	if (uuid)
 		memcpy(uuid, &entry->uuid, sizeof(*uuid));
@@ -47,7 +47,10 @@
 #define SMS_BACKUP_PATH_FILE SMS_BACKUP_PATH_DIR "/%03i"
 
 #define SMS_SR_BACKUP_PATH STORAGEDIR "/%s/sms_sr"
-#define SMS_SR_BACKUP_PATH_FILE SMS_SR_BACKUP_PATH "/%s-%s"
+#define SMS_SR_LOG_PATH STORAGEDIR "/%s/sms_sr.log"
+#define SMS_SR_LOG_MAGIC 0x4c52534f
+#define SMS_SR_LOG_VERSION 1
+#define SMS_SR_LOG_COMPACT_MIN 64
 
 #define SMS_TX_BACKUP_PATH STORAGEDIR "/%s/tx_queue"
 #define SMS_TX_BACKUP_PATH_DIR SMS_TX_BACKUP_PATH "/%lu-%lu-%s"
@@ -1472,6 +1475,9 @@ static gboolean decode_command(const unsigned char *pdu, int len,
 	if (!next_octet(pdu, len, &offset, &out->command.cdl))
 		return FALSE;
 
+	if (out->command.cdl > sizeof(out->command.cd))
+		return FALSE;
+
 	if ((len - offset) < out->command.cdl)
 		return FALSE;
 
@@ -2218,31 +2224,60 @@ static inline int sms_text_capacity_gsm(int max, int offset)
 	return max - (offset * 8 + 6) / 7;
 }
 
+/* Returns true if the septets end in an escape with nothing to follow it */
+static gboolean gsm_dangling_escape(const unsigned char *buf, long len)
+{
+	long i;
+
+	for (i = 0; i < len; i++)
+		if (buf[i] == 0x1b)
+			i++;
+
+	return i > len;
+}
+
+static char *sms_text_append(char *text, char *converted)
+{
+	char *ret;
+
+	if (converted == NULL)
+		return text;
+
+	if (text == NULL)
+		return converted;
+
+	ret = l_strdup_printf("%s%s", text, converted);
+	l_free(text);
+	l_free(converted);
+
+	return ret;
+}
+
 /*!
  * Decodes a list of SMSes that contain a text in either 7bit or UCS2 encoding.
  * The list must be sorted in order of the sequence number.  This function
  * assumes that all fragments have a proper DCS.
  *
+ * The user data of all fragments is unpacked into buffers sized for the
+ * whole list up front, and consecutive fragments using the same alphabet
+ * are converted to UTF-8 in one go.
+ *
  * Returns a pointer to a newly allocated string or NULL if the conversion
  * failed.
  */
 char *sms_decode_text(GSList *sms_list)
 {
 	GSList *l;
-	struct l_string *str;
 	const struct sms *sms;
-	int guess_size = g_slist_length(sms_list);
-	char *utf8;
-	void *utf16 = NULL;
+	unsigned int count = g_slist_length(sms_list);
+	char *text = NULL;
+	unsigned char *gsm = NULL;
+	long gsm_len = 0;
+	guint8 gsm_locking_shift = 0;
+	guint8 gsm_single_shift = 0;
+	guint8 *utf16 = NULL;
 	size_t utf16_size = 0;
 
-	if (guess_size == 1)
-		guess_size = 160;
-	else
-		guess_size = (guess_size - 1) * 160;
-
-	str = l_string_new(guess_size);
-
 	for (l = sms_list; l; l = l->next) {
 		guint8 taken = 0;
 		guint8 dcs;
@@ -2251,7 +2286,6 @@ char *sms_decode_text(GSList *sms_list)
 		int udl_in_bytes;
 		const guint8 *ud;
 		struct sms_udh_iter iter;
-		char *converted;
 
 		sms = l->data;
 
@@ -2273,22 +2307,12 @@ char *sms_decode_text(GSList *sms_list)
 			continue;
 
 		if (charset == SMS_CHARSET_7BIT) {
-			unsigned char buf[160];
+			unsigned char *buf;
 			long written;
 			guint8 locking_shift = 0;
 			guint8 single_shift = 0;
 			int max_chars = sms_text_capacity_gsm(udl, taken);
 
-			if (unpack_7bit_own_buf(ud + taken,
-						udl_in_bytes - taken,
-						taken, false, max_chars,
-						&written, 0, buf) == NULL)
-				continue;
-
-			/* Take care of improperly split fragments */
-			if (buf[written-1] == 0x1b)
-				written = written - 1;
-
 			sms_extract_language_variant(sms, &locking_shift,
 								&single_shift);
 
@@ -2302,14 +2326,43 @@ char *sms_decode_text(GSList *sms_list)
 			if (single_shift > SMS_ALPHABET_URDU)
 				single_shift = GSM_DIALECT_DEFAULT;
 
-			converted = convert_gsm_to_utf8_with_lang(buf, written,
-								NULL, NULL, 0,
-								locking_shift,
-								single_shift);
-			if (converted) {
-				l_string_append(str, converted);
-				l_free(converted);
+			if (gsm == NULL)
+				gsm = l_malloc(count * 160);
+
+			/* Convert what we have if the alphabet changes */
+			if (gsm_len > 0 &&
+					(locking_shift != gsm_locking_shift ||
+					single_shift != gsm_single_shift)) {
+				text = sms_text_append(text,
+					convert_gsm_to_utf8_with_lang(gsm,
+							gsm_len, NULL, NULL, 0,
+							gsm_locking_shift,
+							gsm_single_shift));
+				gsm_len = 0;
 			}
+
+			buf = gsm + gsm_len;
+
+			if (unpack_7bit_own_buf(ud + taken,
+						udl_in_bytes - taken,
+						taken, false, max_chars,
+						&written, 0, buf) == NULL)
+				continue;
+
+			/* Take care of improperly split fragments */
+			if (written > 0 && buf[written-1] == 0x1b)
+				written = written - 1;
+
+			/*
+			 * A fragment that would fail to convert on its own must
+			 * not swallow the first character of the next one
+			 */
+			if (gsm_dangling_escape(buf, written))
+				continue;
+
+			gsm_len += written;
+			gsm_locking_shift = locking_shift;
+			gsm_single_shift = single_shift;
 		} else {
 			const guint8 *from = ud + taken;
 			/*
@@ -2329,37 +2382,43 @@ char *sms_decode_text(GSList *sms_list)
 			 * character in the middle. So accumulate the
 			 * entire message before converting to UTF-8.
 			 */
-			utf16 = l_realloc(utf16, utf16_size + num_ucs2_chars);
+			if (utf16 == NULL)
+				utf16 = l_malloc(count * 140);
+
 			memcpy(utf16 + utf16_size, from, num_ucs2_chars);
 			utf16_size += num_ucs2_chars;
 		}
-
 	}
 
-	if (utf16) {
-		char *converted;
+	if (gsm_len > 0)
+		text = sms_text_append(text,
+				convert_gsm_to_utf8_with_lang(gsm, gsm_len,
+							NULL, NULL, 0,
+							gsm_locking_shift,
+							gsm_single_shift));
+
+	l_free(gsm);
 
+	if (utf16_size > 0) {
 		/* Strings are in UTF16-BE, so convert if needed */
 		if (L_CPU_TO_BE16(0x8000) != 0x8000) {
 			size_t i;
-			uint16_t *p = utf16;
+			uint16_t *p = (uint16_t *) utf16;
 
 			for (i = 0; i < utf16_size / 2; i++)
 				p[i] = __builtin_bswap16(p[i]);
 		}
 
-		converted = l_utf8_from_utf16(utf16, utf16_size);
-		if (converted) {
-			l_string_append(str, converted);
-			l_free(converted);
-		}
-
-		l_free(utf16);
+		text = sms_text_append(text,
+				l_utf8_from_utf16(utf16, utf16_size));
 	}
 
-	utf8 = l_string_unwrap(str);
+	l_free(utf16);
 
-	return utf8;
+	if (text == NULL)
+		return l_strdup("");
+
+	return text;
 }
 
 static int sms_serialize(unsigned char *buf, const struct sms *sms)
@@ -2764,17 +2823,250 @@ static guint sha1_hash(gconstpointer v)
 	return h;
 }
 
-static void sr_assembly_load_backup(GHashTable *assembly_table,
-					const char *imsi,
+/*
+ * Status report assembly state is kept in a binary log under
+ * storagedir/<imsi>/sms_sr.log: a header followed by fixed size records,
+ * each holding either the latest state of a message or its removal.
+ * Changes are collected in memory and appended with a single write by
+ * status_report_assembly_sync().  Once the log holds more than twice the
+ * number of live messages it is rewritten from the current state.
+ */
+enum sr_log_op {
+	SR_LOG_OP_PUT = 1,
+	SR_LOG_OP_DEL = 2,
+};
+
+struct sr_log_header {
+	guint32 magic;
+	guint32 version;
+} __attribute__((packed));
+
+struct sr_log_record {
+	guint8 op;
+	DECLARE_SMS_ADDR_STR(addr);
+	unsigned char msgid[SMS_MSGID_LEN];
+	struct id_table_node node;
+} __attribute__((packed));
+
+struct sr_log_key {
+	DECLARE_SMS_ADDR_STR(addr);
+	unsigned char msgid[SMS_MSGID_LEN];
+};
+
+/* Index of outstanding message references by (address, TP-MR) */
+struct sr_mr_entry {
+	DECLARE_SMS_ADDR_STR(addr);
+	unsigned char mr;
+	GSList *msgids;
+};
+
+static guint sr_mr_entry_hash(gconstpointer v)
+{
+	const struct sr_mr_entry *entry = v;
+
+	return g_str_hash(entry->addr) * 33 + entry->mr;
+}
+
+static gboolean sr_mr_entry_equal(gconstpointer v1, gconstpointer v2)
+{
+	const struct sr_mr_entry *e1 = v1;
+	const struct sr_mr_entry *e2 = v2;
+
+	return e1->mr == e2->mr && !strcmp(e1->addr, e2->addr);
+}
+
+static void sr_mr_entry_free(gpointer data)
+{
+	struct sr_mr_entry *entry = data;
+
+	g_slist_free(entry->msgids);
+	g_free(entry);
+}
+
+static guint sr_log_key_hash(gconstpointer v)
+{
+	const struct sr_log_key *key = v;
+
+	return g_str_hash(key->addr) ^ sha1_hash(key->msgid);
+}
+
+static gboolean sr_log_key_equal(gconstpointer v1, gconstpointer v2)
+{
+	const struct sr_log_key *k1 = v1;
+	const struct sr_log_key *k2 = v2;
+
+	return !strcmp(k1->addr, k2->addr) &&
+			sha1_equal(k1->msgid, k2->msgid);
+}
+
+static struct sr_mr_entry *sr_mr_index_lookup(
+				struct status_report_assembly *assembly,
+				const char *straddr, unsigned char mr)
+{
+	struct sr_mr_entry lookup;
+
+	l_strlcpy(lookup.addr, straddr, sizeof(lookup.addr));
+	lookup.mr = mr;
+
+	return g_hash_table_lookup(assembly->mr_table, &lookup);
+}
+
+/*
+ * The same message reference can be in use by several messages sent to the
+ * same address, e.g. when the 8-bit MR wraps around.  Keep the message ids
+ * in submission order, status reports are matched against the oldest one.
+ */
+static void sr_mr_index_add(struct status_report_assembly *assembly,
+				const char *straddr, unsigned char mr,
+				unsigned char *msgid)
+{
+	struct sr_mr_entry *entry;
+
+	entry = sr_mr_index_lookup(assembly, straddr, mr);
+	if (entry == NULL) {
+		entry = g_new0(struct sr_mr_entry, 1);
+		l_strlcpy(entry->addr, straddr, sizeof(entry->addr));
+		entry->mr = mr;
+		g_hash_table_insert(assembly->mr_table, entry, entry);
+	} else if (g_slist_find(entry->msgids, msgid))
+		return;
+
+	entry->msgids = g_slist_append(entry->msgids, msgid);
+}
+
+static void sr_mr_index_remove(struct status_report_assembly *assembly,
+				struct sr_mr_entry *entry,
+				const unsigned char *msgid)
+{
+	entry->msgids = g_slist_remove(entry->msgids, msgid);
+
+	if (entry->msgids == NULL)
+		g_hash_table_remove(assembly->mr_table, entry);
+}
+
+static void sr_mr_index_add_node(struct status_report_assembly *assembly,
+					const char *straddr,
+					const struct id_table_node *node,
+					unsigned char *msgid)
+{
+	unsigned int i;
+
+	for (i = 0; i < 256; i++)
+		if (node->mrs[i / 32] & (1U << (i % 32)))
+			sr_mr_index_add(assembly, straddr, i, msgid);
+}
+
+static void sr_mr_index_remove_node(struct status_report_assembly *assembly,
+					const char *straddr,
+					const struct id_table_node *node,
+					const unsigned char *msgid)
+{
+	struct sr_mr_entry *entry;
+	unsigned int i;
+
+	for (i = 0; i < 256; i++) {
+		if (!(node->mrs[i / 32] & (1U << (i % 32))))
+			continue;
+
+		entry = sr_mr_index_lookup(assembly, straddr, i);
+		if (entry)
+			sr_mr_index_remove(assembly, entry, msgid);
+	}
+}
+
+/*
+ * Records the latest state of a message for the next log write.  A NULL
+ * node means the message has been removed.  Several changes to the same
+ * message before the next status_report_assembly_sync() are coalesced.
+ */
+static void sr_assembly_log(struct status_report_assembly *assembly,
+				const char *straddr,
+				const unsigned char *msgid,
+				const struct id_table_node *node)
+{
+	struct sr_log_key *key;
+
+	if (assembly->imsi == NULL)
+		return;
+
+	key = g_new0(struct sr_log_key, 1);
+	l_strlcpy(key->addr, straddr, sizeof(key->addr));
+	memcpy(key->msgid, msgid, SMS_MSGID_LEN);
+
+	g_hash_table_replace(assembly->log_pending, key, (gpointer) node);
+}
+
+static GHashTable *sr_assembly_get_id_table(
+				struct status_report_assembly *assembly,
+				const char *straddr)
+{
+	GHashTable *id_table;
+
+	id_table = g_hash_table_lookup(assembly->assembly_table, straddr);
+
+	/* Create hashtable keyed by the to address if required */
+	if (id_table == NULL) {
+		id_table = g_hash_table_new_full(sha1_hash, sha1_equal,
+							g_free, g_free);
+		g_hash_table_insert(assembly->assembly_table,
+					g_strdup(straddr), id_table);
+	}
+
+	return id_table;
+}
+
+/* Takes ownership of the node, replacing any previous state */
+static void sr_assembly_restore_node(struct status_report_assembly *assembly,
+					const char *straddr,
+					const unsigned char *msgid,
+					struct id_table_node *node)
+{
+	GHashTable *id_table = sr_assembly_get_id_table(assembly, straddr);
+	gpointer key;
+	gpointer old;
+
+	if (g_hash_table_lookup_extended(id_table, msgid, &key, &old)) {
+		sr_mr_index_remove_node(assembly, straddr, old, key);
+		g_hash_table_insert(id_table, g_memdup2(msgid, SMS_MSGID_LEN),
+					node);
+		g_hash_table_lookup_extended(id_table, msgid, &key, NULL);
+	} else {
+		key = g_memdup2(msgid, SMS_MSGID_LEN);
+		g_hash_table_insert(id_table, key, node);
+	}
+
+	sr_mr_index_add_node(assembly, straddr, node, key);
+}
+
+/*
+ * Removes the message from the id table.  The caller is responsible for
+ * dropping the address from the assembly table once its id table is empty.
+ */
+static void sr_assembly_remove_node(struct status_report_assembly *assembly,
+					const char *straddr,
+					GHashTable *id_table,
+					const unsigned char *msgid)
+{
+	unsigned char id[SMS_MSGID_LEN];
+	gpointer key;
+	gpointer node;
+
+	if (!g_hash_table_lookup_extended(id_table, msgid, &key, &node))
+		return;
+
+	memcpy(id, msgid, SMS_MSGID_LEN);
+	sr_mr_index_remove_node(assembly, straddr, node, key);
+	sr_assembly_log(assembly, straddr, id, NULL);
+	g_hash_table_remove(id_table, id);
+}
+
+static void sr_assembly_load_backup(struct status_report_assembly *assembly,
 					const struct dirent *addr_dir)
 {
 	struct sms_address addr;
 	DECLARE_SMS_ADDR_STR(straddr);
 	struct id_table_node *node;
-	GHashTable *id_table;
 	int r;
-	char *assembly_table_key;
-	unsigned int *id_table_key;
 	char msgid_str[SMS_MSGID_LEN * 2 + 1];
 	unsigned char msgid[SMS_MSGID_LEN];
 	char endc;
@@ -2808,125 +3100,342 @@ static void sr_assembly_load_backup(GHashTable *assembly_table,
 	r = read_file((unsigned char *) node,
 			sizeof(struct id_table_node),
 			SMS_SR_BACKUP_PATH "/%s",
-			imsi, addr_dir->d_name);
+			assembly->imsi, addr_dir->d_name);
 
 	if (r < 0) {
 		g_free(node);
 		return;
 	}
 
-	id_table = g_hash_table_lookup(assembly_table,
-					sms_address_to_string(&addr));
+	sr_assembly_restore_node(assembly, sms_address_to_string(&addr),
+					msgid, node);
+}
 
-	/* Create hashtable keyed by the to address if required */
-	if (id_table == NULL) {
-		id_table = g_hash_table_new_full(sha1_hash, sha1_equal,
-							g_free, g_free);
+/*
+ * Older versions kept one backup file per message under sms_sr.  Load
+ * them, they are removed once their state has been written to the log.
+ */
+static void sr_assembly_load_legacy(struct status_report_assembly *assembly)
+{
+	char *path;
+	int len;
+	struct dirent **addresses;
 
-		assembly_table_key = g_strdup(sms_address_to_string(&addr));
-		g_hash_table_insert(assembly_table, assembly_table_key,
-					id_table);
-	}
+	path = l_strdup_printf(SMS_SR_BACKUP_PATH, assembly->imsi);
+	len = scandir(path, &addresses, NULL, alphasort);
+	l_free(path);
+
+	if (len < 0)
+		return;
 
-	/* Node ready, create key and add them to the table */
-	id_table_key = g_memdup2(msgid, SMS_MSGID_LEN);
+	assembly->legacy_backup = TRUE;
 
-	g_hash_table_insert(id_table, id_table_key, node);
+	/*
+	 * Go through different addresses. Each address can relate to
+	 * 1-n msg_ids.
+	 */
+	while (len--) {
+		sr_assembly_load_backup(assembly, addresses[len]);
+		g_free(addresses[len]);
+	}
+
+	g_free(addresses);
 }
 
-struct status_report_assembly *status_report_assembly_new(const char *imsi)
+static void sr_assembly_remove_legacy(struct status_report_assembly *assembly)
 {
 	char *path;
 	int len;
-	struct dirent **addresses;
+	struct dirent **entries;
+
+	path = l_strdup_printf(SMS_SR_BACKUP_PATH, assembly->imsi);
+	len = scandir(path, &entries, NULL, NULL);
+
+	if (len < 0)
+		goto done;
+
+	while (len--) {
+		char *file;
+
+		if (entries[len]->d_type == DT_REG) {
+			file = l_strdup_printf("%s/%s", path,
+						entries[len]->d_name);
+			unlink(file);
+			l_free(file);
+		}
+
+		g_free(entries[len]);
+	}
+
+	g_free(entries);
+	rmdir(path);
+
+done:
+	l_free(path);
+	assembly->legacy_backup = FALSE;
+}
+
+static void sr_assembly_load_log(struct status_report_assembly *assembly)
+{
+	const struct sr_log_header *header;
+	const struct sr_log_record *record;
+	char *path;
+	char *contents;
+	gsize len;
+	gsize offset;
+	GHashTable *id_table;
+
+	path = l_strdup_printf(SMS_SR_LOG_PATH, assembly->imsi);
+
+	if (!g_file_get_contents(path, &contents, &len, NULL)) {
+		l_free(path);
+		return;
+	}
+
+	l_free(path);
+	header = (const struct sr_log_header *) contents;
+
+	if (len < sizeof(*header) || header->magic != SMS_SR_LOG_MAGIC ||
+			header->version != SMS_SR_LOG_VERSION) {
+		assembly->log_compact = TRUE;
+		goto done;
+	}
+
+	/* A truncated trailing record is a write that never completed */
+	for (offset = sizeof(*header); offset + sizeof(*record) <= len;
+						offset += sizeof(*record)) {
+		char straddr[sizeof(record->addr)];
+
+		record = (const struct sr_log_record *) (contents + offset);
+
+		memcpy(straddr, record->addr, sizeof(straddr));
+		straddr[sizeof(straddr) - 1] = '\0';
+
+		switch (record->op) {
+		case SR_LOG_OP_PUT:
+			sr_assembly_restore_node(assembly, straddr,
+					record->msgid,
+					g_memdup2(&record->node,
+						sizeof(struct id_table_node)));
+			break;
+		case SR_LOG_OP_DEL:
+			id_table = g_hash_table_lookup(assembly->assembly_table,
+							straddr);
+			if (id_table == NULL)
+				break;
+
+			sr_assembly_remove_node(assembly, straddr, id_table,
+							record->msgid);
+
+			if (g_hash_table_size(id_table) == 0)
+				g_hash_table_remove(assembly->assembly_table,
+							straddr);
+			break;
+		}
+
+		assembly->log_records++;
+	}
+
+	/* Replaying deletions must not generate new log records */
+	g_hash_table_remove_all(assembly->log_pending);
+	assembly->log_compact = offset != len;
+
+done:
+	g_free(contents);
+}
+
+struct status_report_assembly *status_report_assembly_new(const char *imsi)
+{
 	struct status_report_assembly *ret =
 				g_new0(struct status_report_assembly, 1);
 
 	ret->assembly_table = g_hash_table_new_full(g_str_hash, g_str_equal,
 				g_free, (GDestroyNotify) g_hash_table_destroy);
+	ret->mr_table = g_hash_table_new_full(sr_mr_entry_hash,
+						sr_mr_entry_equal,
+						NULL, sr_mr_entry_free);
+	ret->log_pending = g_hash_table_new_full(sr_log_key_hash,
+							sr_log_key_equal,
+							g_free, NULL);
 
 	if (imsi) {
 		ret->imsi = imsi;
 
 		/* Restore state from backup */
-		path = l_strdup_printf(SMS_SR_BACKUP_PATH, imsi);
-		len = scandir(path, &addresses, NULL, alphasort);
-		l_free(path);
+		sr_assembly_load_legacy(ret);
+		sr_assembly_load_log(ret);
 
-		if (len < 0)
-			return ret;
+		if (ret->legacy_backup)
+			ret->log_compact = TRUE;
+	}
 
-		/*
-		 * Go through different addresses. Each address can relate to
-		 * 1-n msg_ids.
-		 */
+	return ret;
+}
 
-		while (len--) {
-			sr_assembly_load_backup(ret->assembly_table, imsi,
-								addresses[len]);
-			g_free(addresses[len]);
-		}
+static void sr_log_record_fill(struct sr_log_record *record,
+				const char *straddr,
+				const unsigned char *msgid,
+				const struct id_table_node *node)
+{
+	memset(record, 0, sizeof(*record));
+	l_strlcpy(record->addr, straddr, sizeof(record->addr));
+	memcpy(record->msgid, msgid, SMS_MSGID_LEN);
 
-		g_free(addresses);
+	if (node == NULL) {
+		record->op = SR_LOG_OP_DEL;
+		return;
 	}
 
-	return ret;
+	record->op = SR_LOG_OP_PUT;
+	memcpy(&record->node, node, sizeof(struct id_table_node));
 }
 
-static gboolean sr_assembly_add_fragment_backup(const char *imsi,
-					const struct id_table_node *node,
-					const struct sms_address *addr,
-					const unsigned char *msgid)
+static unsigned int sr_assembly_count(struct status_report_assembly *assembly)
 {
-	int len = sizeof(struct id_table_node);
-	DECLARE_SMS_ADDR_STR(straddr);
-	char msgid_str[SMS_MSGID_LEN * 2 + 1];
+	GHashTableIter iter;
+	gpointer value;
+	unsigned int count = 0;
 
-	if (imsi == NULL)
-		return FALSE;
+	g_hash_table_iter_init(&iter, assembly->assembly_table);
 
-	if (sms_address_to_hex_string(addr, straddr) == FALSE)
-		return FALSE;
+	while (g_hash_table_iter_next(&iter, NULL, &value))
+		count += g_hash_table_size(value);
 
-	if (encode_hex_own_buf(msgid, SMS_MSGID_LEN, 0, msgid_str) == NULL)
-		return FALSE;
+	return count;
+}
+
+/* Rewrites the log so that it only holds the live state */
+static gboolean sr_log_compact(struct status_report_assembly *assembly)
+{
+	unsigned int count = sr_assembly_count(assembly);
+	size_t len = sizeof(struct sr_log_header) +
+				count * sizeof(struct sr_log_record);
+	unsigned char *buf = g_malloc0(len);
+	struct sr_log_header *header = (struct sr_log_header *) buf;
+	struct sr_log_record *record = (struct sr_log_record *) (header + 1);
+	GHashTableIter iter_addr;
+	GHashTableIter iter_node;
+	gpointer straddr, id_table, msgid, node;
 
-	/* storagedir/%s/sms_sr/%s-%s */
-	if (write_file((unsigned char *) node, len,
-			SMS_SR_BACKUP_PATH_FILE, imsi,
-			straddr, msgid_str) != len)
+	header->magic = SMS_SR_LOG_MAGIC;
+	header->version = SMS_SR_LOG_VERSION;
+
+	g_hash_table_iter_init(&iter_addr, assembly->assembly_table);
+
+	while (g_hash_table_iter_next(&iter_addr, &straddr, &id_table)) {
+		g_hash_table_iter_init(&iter_node, id_table);
+
+		while (g_hash_table_iter_next(&iter_node, &msgid, &node))
+			sr_log_record_fill(record++, straddr, msgid, node);
+	}
+
+	if (write_file(buf, len, SMS_SR_LOG_PATH, assembly->imsi) < 0) {
+		g_free(buf);
 		return FALSE;
+	}
+
+	g_free(buf);
+
+	assembly->log_records = count;
+	assembly->log_compact = FALSE;
+
+	if (assembly->legacy_backup)
+		sr_assembly_remove_legacy(assembly);
 
 	return TRUE;
 }
 
-static gboolean sr_assembly_remove_fragment_backup(const char *imsi,
-					const struct sms_address *addr,
-					const unsigned char *sha1)
+static gboolean sr_log_append(struct status_report_assembly *assembly)
 {
+	unsigned int count = g_hash_table_size(assembly->log_pending);
+	size_t len = count * sizeof(struct sr_log_record);
+	struct sr_log_record *records = g_malloc0(len);
+	struct sr_log_record *record = records;
+	GHashTableIter iter;
+	gpointer key, node;
 	char *path;
-	DECLARE_SMS_ADDR_STR(straddr);
-	char msgid_str[SMS_MSGID_LEN * 2 + 1];
+	ssize_t written;
+	int fd;
 
-	if (imsi == NULL)
-		return FALSE;
+	g_hash_table_iter_init(&iter, assembly->log_pending);
+
+	while (g_hash_table_iter_next(&iter, &key, &node)) {
+		const struct sr_log_key *log_key = key;
 
-	if (sms_address_to_hex_string(addr, straddr) == FALSE)
+		sr_log_record_fill(record++, log_key->addr, log_key->msgid,
+					node);
+	}
+
+	path = l_strdup_printf(SMS_SR_LOG_PATH, assembly->imsi);
+	fd = L_TFR(open(path, O_WRONLY | O_APPEND));
+	l_free(path);
+
+	if (fd < 0) {
+		g_free(records);
 		return FALSE;
+	}
 
-	if (encode_hex_own_buf(sha1, SMS_MSGID_LEN, 0, msgid_str) == FALSE)
+	written = L_TFR(write(fd, records, len));
+	L_TFR(close(fd));
+	g_free(records);
+
+	if (written != (ssize_t) len)
 		return FALSE;
 
-	path = l_strdup_printf(SMS_SR_BACKUP_PATH_FILE,
-					imsi, straddr, msgid_str);
-	unlink(path);
-	l_free(path);
+	assembly->log_records += count;
 
 	return TRUE;
 }
 
+/*!
+ * Writes all state changes since the previous call to the backup log with
+ * a single write.  Meant to be called once per main loop iteration, see
+ * status_report_assembly_needs_sync().
+ */
+void status_report_assembly_sync(struct status_report_assembly *assembly)
+{
+	unsigned int pending;
+	unsigned int limit;
+
+	if (assembly->imsi == NULL)
+		return;
+
+	pending = g_hash_table_size(assembly->log_pending);
+
+	if (!pending && !assembly->log_compact)
+		return;
+
+	if (!assembly->log_compact && assembly->log_records + pending >
+						SMS_SR_LOG_COMPACT_MIN) {
+		limit = 2 * sr_assembly_count(assembly);
+
+		if (assembly->log_records + pending > limit)
+			assembly->log_compact = TRUE;
+	}
+
+	/* On a failed or partial append rewrite the whole log */
+	if (assembly->log_compact || !sr_log_append(assembly))
+		sr_log_compact(assembly);
+
+	g_hash_table_remove_all(assembly->log_pending);
+}
+
+gboolean status_report_assembly_needs_sync(
+				struct status_report_assembly *assembly)
+{
+	if (assembly->imsi == NULL)
+		return FALSE;
+
+	return assembly->log_compact ||
+			g_hash_table_size(assembly->log_pending) > 0;
+}
+
 void status_report_assembly_free(struct status_report_assembly *assembly)
 {
+	status_report_assembly_sync(assembly);
+
+	g_hash_table_destroy(assembly->log_pending);
+	g_hash_table_destroy(assembly->mr_table);
 	g_hash_table_destroy(assembly->assembly_table);
 	g_free(assembly);
 }
@@ -2952,30 +3461,33 @@ static gboolean sr_st_to_delivered(enum sms_st st, gboolean *delivered)
 	return FALSE;
 }
 
-static struct id_table_node *find_by_mr_and_mark(GHashTable *id_table,
-						unsigned char mr,
-						GHashTableIter *out_iter,
-						unsigned char **out_id)
+static struct id_table_node *find_by_mr_and_mark(
+					struct status_report_assembly *assy,
+					const char *straddr,
+					unsigned char mr,
+					unsigned char **out_id)
 {
 	unsigned int offset = mr / 32;
 	unsigned int bit = 1 << (mr % 32);
-	gpointer key, value;
+	struct sr_mr_entry *entry;
+	GHashTable *id_table;
 	struct id_table_node *node;
+	unsigned char *msgid;
 
-	g_hash_table_iter_init(out_iter, id_table);
-	while (g_hash_table_iter_next(out_iter, &key, &value)) {
-		node = value;
+	entry = sr_mr_index_lookup(assy, straddr, mr);
+	if (entry == NULL)
+		return NULL;
 
-		/* Address and MR matched */
-		if (node->mrs[offset] & bit) {
-			node->mrs[offset] ^= bit;
-			*out_id = key;
+	id_table = g_hash_table_lookup(assy->assembly_table, straddr);
+	msgid = entry->msgids->data;
+	node = g_hash_table_lookup(id_table, msgid);
 
-			return node;
-		}
-	}
+	/* Address and MR matched */
+	node->mrs[offset] &= ~bit;
+	sr_mr_index_remove(assy, entry, msgid);
+	*out_id = msgid;
 
-	return NULL;
+	return node;
 }
 
 /*
@@ -2989,19 +3501,17 @@ static struct id_table_node *find_by_mr_and_mark(GHashTable *id_table,
 static struct id_table_node *fuzzy_lookup(struct status_report_assembly *assy,
 						const struct sms *sr,
 						const char **out_addr,
-						GHashTableIter *out_iter,
 						unsigned char **out_msgid)
 {
 	GHashTableIter iter_addr;
-	gpointer key, value;
+	gpointer key;
 	const char *r_addr;
 
 	r_addr = sms_address_to_string(&sr->status_report.raddr);
 	g_hash_table_iter_init(&iter_addr, assy->assembly_table);
 
-	while (g_hash_table_iter_next(&iter_addr, &key, &value)) {
+	while (g_hash_table_iter_next(&iter_addr, &key, NULL)) {
 		const char *s_addr = key;
-		GHashTable *id_table = value;
 		unsigned int len, r_len, s_len;
 		unsigned int i;
 		struct id_table_node *node;
@@ -3026,8 +3536,8 @@ static struct id_table_node *fuzzy_lookup(struct status_report_assembly *assy,
 			continue;
 
 		/* Address matched. Check message reference. */
-		node = find_by_mr_and_mark(id_table, sr->status_report.mr,
-						out_iter, out_msgid);
+		node = find_by_mr_and_mark(assy, s_addr, sr->status_report.mr,
+						out_msgid);
 		if (node != NULL) {
 			*out_addr = s_addr;
 			return node;
@@ -3044,8 +3554,6 @@ gboolean status_report_assembly_report(struct status_report_assembly *assembly,
 {
 	const char *straddr;
 	GHashTable *id_table;
-	GHashTableIter iter;
-	struct sms_address addr;
 	struct id_table_node *node;
 	gboolean delivered;
 	gboolean pending;
@@ -3060,10 +3568,10 @@ gboolean status_report_assembly_report(struct status_report_assembly *assembly,
 	id_table = g_hash_table_lookup(assembly->assembly_table, straddr);
 
 	if (id_table != NULL)
-		node = find_by_mr_and_mark(id_table, sr->status_report.mr,
-						&iter, &msgid);
+		node = find_by_mr_and_mark(assembly, straddr,
+						sr->status_report.mr, &msgid);
 	else
-		node = fuzzy_lookup(assembly, sr, &straddr, &iter, &msgid);
+		node = fuzzy_lookup(assembly, sr, &straddr, &msgid);
 
 	/* Unable to find a message reference belonging to this address */
 	if (node == NULL)
@@ -3072,8 +3580,10 @@ gboolean status_report_assembly_report(struct status_report_assembly *assembly,
 	node->deliverable = node->deliverable && delivered;
 
 	/* If we haven't sent the entire message yet, wait until sent */
-	if (node->sent_mrs < node->total_mrs)
+	if (node->sent_mrs < node->total_mrs) {
+		sr_assembly_log(assembly, straddr, msgid, node);
 		return FALSE;
+	}
 
 	/* Figure out if we are expecting more status reports */
 	for (i = 0, pending = FALSE; i < 8; i++) {
@@ -3084,15 +3594,12 @@ gboolean status_report_assembly_report(struct status_report_assembly *assembly,
 		}
 	}
 
-	__sms_address_from_string(&addr, straddr);
-
 	if (pending == TRUE && node->deliverable == TRUE) {
 		/*
 		 * More status reports expected, and already received
-		 * reports completed. Update backup file.
+		 * reports completed. Update backup log.
 		 */
-		sr_assembly_add_fragment_backup(assembly->imsi, node,
-						&addr, msgid);
+		sr_assembly_log(assembly, straddr, msgid, node);
 
 		return FALSE;
 	}
@@ -3103,9 +3610,8 @@ gboolean status_report_assembly_report(struct status_report_assembly *assembly,
 	if (out_msgid)
 		memcpy(out_msgid, msgid, SMS_MSGID_LEN);
 
-	sr_assembly_remove_fragment_backup(assembly->imsi, &addr, msgid);
-	id_table = g_hash_table_iter_get_hash_table(&iter);
-	g_hash_table_iter_remove(&iter);
+	id_table = g_hash_table_lookup(assembly->assembly_table, straddr);
+	sr_assembly_remove_node(assembly, straddr, id_table, msgid);
 
 	if (g_hash_table_size(id_table) == 0)
 		g_hash_table_remove(assembly->assembly_table, straddr);
@@ -3122,26 +3628,19 @@ void status_report_assembly_add_fragment(
 {
 	unsigned int offset = mr / 32;
 	unsigned int bit = 1 << (mr % 32);
+	const char *straddr = sms_address_to_string(to);
 	GHashTable *id_table;
+	gpointer id_table_key;
+	gpointer value;
 	struct id_table_node *node;
-	unsigned char *id_table_key;
 
-	id_table = g_hash_table_lookup(assembly->assembly_table,
-					sms_address_to_string(to));
-
-	/* Create hashtable keyed by the to address if required */
-	if (id_table == NULL) {
-		id_table = g_hash_table_new_full(sha1_hash, sha1_equal,
-								g_free, g_free);
-		g_hash_table_insert(assembly->assembly_table,
-					g_strdup(sms_address_to_string(to)),
-					id_table);
-	}
-
-	node = g_hash_table_lookup(id_table, msgid);
+	id_table = sr_assembly_get_id_table(assembly, straddr);
 
 	/* Create node in the message id hashtable if required */
-	if (node == NULL) {
+	if (g_hash_table_lookup_extended(id_table, msgid,
+						&id_table_key, &value)) {
+		node = value;
+	} else {
 		id_table_key = g_memdup2(msgid, SMS_MSGID_LEN);
 
 		node = g_new0(struct id_table_node, 1);
@@ -3155,7 +3654,9 @@ void status_report_assembly_add_fragment(
 	node->mrs[offset] |= bit;
 	node->expiration = expiration;
 	node->sent_mrs++;
-	sr_assembly_add_fragment_backup(assembly->imsi, node, to, msgid);
+
+	sr_mr_index_add(assembly, straddr, mr, id_table_key);
+	sr_assembly_log(assembly, straddr, id_table_key, node);
 }
 
 void status_report_assembly_expire(struct status_report_assembly *assembly,
@@ -3163,7 +3664,6 @@ void status_report_assembly_expire(struct status_report_assembly *assembly,
 {
 	GHashTable *id_table;
 	GHashTableIter iter_addr, iter_node;
-	struct sms_address addr;
 	char *straddr;
 	gpointer key;
 	struct id_table_node *node;
@@ -3176,8 +3676,6 @@ void status_report_assembly_expire(struct status_report_assembly *assembly,
 	 */
 	while (g_hash_table_iter_next(&iter_addr, (gpointer) &straddr,
 					(gpointer) &id_table)) {
-
-		__sms_address_from_string(&addr, straddr);
 		g_hash_table_iter_init(&iter_node, id_table);
 
 		/* Go through different messages. */
@@ -3185,15 +3683,13 @@ void status_report_assembly_expire(struct status_report_assembly *assembly,
 						(gpointer) &node)) {
 			/*
 			 * If message is expired, removed it from the
-			 * hash-table and remove the backup-file
+			 * hash-table and from the backup log
 			 */
 			if (node->expiration <= before) {
+				sr_mr_index_remove_node(assembly, straddr,
+								node, key);
+				sr_assembly_log(assembly, straddr, key, NULL);
 				g_hash_table_iter_remove(&iter_node);
-
-				sr_assembly_remove_fragment_backup(
-								assembly->imsi,
-								&addr,
-								key);
 			}
 		}
 
@@ -3354,6 +3850,36 @@ nodir_exit:
 	return retq;
 }
 
+/*
+ * Derives the id of an outgoing message from its PDUs.  The time alone
+ * doesn't keep ids apart when the same text is queued for the same
+ * destination more than once in a row (e.g. within one SendMessages
+ * batch), so the caller also passes a sequence number unique within
+ * the transmit queue.
+ */
+void sms_tx_msgid(GSList *sms_list, unsigned long seq, gint64 time_us,
+				unsigned char msgid[SMS_MSGID_LEN])
+{
+	GChecksum *checksum;
+	gsize msgid_size = SMS_MSGID_LEN;
+	unsigned char pdu[176];
+	int pdu_len;
+	GSList *l;
+
+	checksum = g_checksum_new(G_CHECKSUM_SHA1);
+
+	for (l = sms_list; l; l = l->next) {
+		if (sms_encode(l->data, &pdu_len, NULL, pdu))
+			g_checksum_update(checksum, pdu, pdu_len);
+	}
+
+	g_checksum_update(checksum, (void *) &time_us, sizeof(time_us));
+	g_checksum_update(checksum, (void *) &seq, sizeof(seq));
+
+	g_checksum_get_digest(checksum, msgid, &msgid_size);
+	g_checksum_free(checksum);
+}
+
 gboolean sms_tx_backup_store(const char *imsi, unsigned long id,
 				unsigned long flags, const char *uuid,
 				guint8 seq, const unsigned char *pdu,
@@ -3991,7 +4517,7 @@ char *cbs_decode_text(GSList *cbs_list, char *iso639_lang)
 		} else {
 			bufsize += cbs->udlen;
 
-			if (iso639)
+			if (iso639 && cbs->udlen >= 2)
 				bufsize -= 2;
 		}
 	}
@@ -4039,9 +4565,10 @@ char *cbs_decode_text(GSList *cbs_list, char *iso639_lang)
 			max_chars =
 				sms_text_capacity_gsm(CBS_MAX_GSM_CHARS, taken);
 
-			unpack_7bit_own_buf(ud + taken, cbs->udlen - taken,
+			if (unpack_7bit_own_buf(ud + taken, cbs->udlen - taken,
 						taken, false, max_chars,
-						&written, 0, unpacked);
+						&written, 0, unpacked) == NULL)
+				continue;
 
 			i = iso639 ? 3 : 0;
 
@@ -4138,103 +4665,60 @@ static inline gboolean cbs_is_update_newer(unsigned int n, unsigned int o)
 	return FALSE;
 }
 
-struct cbs_assembly *cbs_assembly_new(void)
-{
-	return g_new0(struct cbs_assembly, 1);
-}
-
-void cbs_assembly_free(struct cbs_assembly *assembly)
+static void cbs_assembly_node_free(gpointer data)
 {
-	GSList *l;
+	struct cbs_assembly_node *node = data;
 
-	for (l = assembly->assembly_list; l; l = l->next) {
-		struct cbs_assembly_node *node = l->data;
-
-		g_slist_free_full(node->pages, g_free);
-		g_free(node);
-	}
-
-	g_slist_free(assembly->assembly_list);
-	g_slist_free(assembly->recv_plmn);
-	g_slist_free(assembly->recv_loc);
-	g_slist_free(assembly->recv_cell);
-
-	g_free(assembly);
+	g_slist_free_full(node->pages, g_free);
+	g_free(node);
 }
 
-static gint cbs_compare_node_by_gs(gconstpointer a, gconstpointer b)
+struct cbs_assembly *cbs_assembly_new(void)
 {
-	const struct cbs_assembly_node *node = a;
-	unsigned int gs = GPOINTER_TO_UINT(b);
+	struct cbs_assembly *ret = g_new0(struct cbs_assembly, 1);
 
-	if (((node->serial >> 14) & 0x3) == gs)
-		return 0;
+	ret->assembly_table = g_hash_table_new_full(g_direct_hash,
+						g_direct_equal, NULL,
+						cbs_assembly_node_free);
+	ret->recv_plmn = g_hash_table_new(g_direct_hash, g_direct_equal);
+	ret->recv_loc = g_hash_table_new(g_direct_hash, g_direct_equal);
+	ret->recv_cell = g_hash_table_new(g_direct_hash, g_direct_equal);
 
-	return 1;
+	return ret;
 }
 
-static gint cbs_compare_node_by_update(gconstpointer a, gconstpointer b)
+void cbs_assembly_free(struct cbs_assembly *assembly)
 {
-	const struct cbs_assembly_node *node = a;
-	unsigned int serial = GPOINTER_TO_UINT(b);
-
-	if ((serial & (~0xf)) != (node->serial & (~0xf)))
-		return 1;
-
-	if (cbs_is_update_newer(node->serial, serial))
-		return 1;
+	g_hash_table_destroy(assembly->assembly_table);
+	g_hash_table_destroy(assembly->recv_plmn);
+	g_hash_table_destroy(assembly->recv_loc);
+	g_hash_table_destroy(assembly->recv_cell);
 
-	return 0;
+	g_free(assembly);
 }
 
-static gint cbs_compare_recv_by_serial(gconstpointer a, gconstpointer b)
+static gboolean cbs_node_in_gs(gpointer key, gpointer value,
+				gpointer user_data)
 {
-	unsigned int old_serial = GPOINTER_TO_UINT(a);
-	unsigned int new_serial = GPOINTER_TO_UINT(b);
+	const struct cbs_assembly_node *node = value;
+	unsigned int gs = GPOINTER_TO_UINT(user_data);
 
-	if ((old_serial & (~0xf)) == (new_serial & (~0xf)))
-		return 0;
-
-	return 1;
+	return ((node->serial >> 14) & 0x3) == gs;
 }
 
-static void cbs_assembly_expire(struct cbs_assembly *assembly,
-				GCompareFunc func, gconstpointer *userdata)
+static gboolean cbs_node_is_outdated(gpointer key, gpointer value,
+					gpointer user_data)
 {
-	GSList *l;
-	GSList *prev;
-	GSList *tmp;
+	const struct cbs_assembly_node *node = value;
+	unsigned int serial = GPOINTER_TO_UINT(user_data);
 
-	/*
-	 * Take care of the case where several updates are being
-	 * reassembled at the same time. If the newer one is assembled
-	 * first, then the subsequent old update is discarded, make
-	 * sure that we're also discarding the assembly node for the
-	 * partially assembled ones
-	 */
-	prev = NULL;
-	l = assembly->assembly_list;
-
-	while (l) {
-		struct cbs_assembly_node *node = l->data;
-
-		if (func(node, userdata) != 0) {
-			prev = l;
-			l = l->next;
-			continue;
-		}
+	if ((serial & (~0xf)) != (node->serial & (~0xf)))
+		return FALSE;
 
-		if (prev)
-			prev->next = l->next;
-		else
-			assembly->assembly_list = l->next;
+	if (cbs_is_update_newer(node->serial, serial))
+		return FALSE;
 
-		g_slist_free_full(node->pages, g_free);
-		g_free(node->pages);
-		tmp = l;
-		l = l->next;
-		g_slist_free_1(tmp);
-	}
+	return TRUE;
 }
 
 void cbs_assembly_location_changed(struct cbs_assembly *assembly, gboolean plmn,
@@ -4257,29 +4741,31 @@ void cbs_assembly_location_changed(struct cbs_assembly *assembly, gboolean plmn,
 
 	if (plmn) {
 		lac = TRUE;
-		g_slist_free(assembly->recv_plmn);
-		assembly->recv_plmn = NULL;
+		g_hash_table_remove_all(assembly->recv_plmn);
 
-		cbs_assembly_expire(assembly, cbs_compare_node_by_gs,
+		g_hash_table_foreach_remove(assembly->assembly_table,
+				cbs_node_in_gs,
 				GUINT_TO_POINTER(CBS_GEO_SCOPE_PLMN));
 	}
 
 	if (lac) {
 		/* If LAC changed, then cell id has changed */
 		ci = TRUE;
-		g_slist_free(assembly->recv_loc);
-		assembly->recv_loc = NULL;
+		g_hash_table_remove_all(assembly->recv_loc);
 
-		cbs_assembly_expire(assembly, cbs_compare_node_by_gs,
+		g_hash_table_foreach_remove(assembly->assembly_table,
+				cbs_node_in_gs,
 				GUINT_TO_POINTER(CBS_GEO_SCOPE_SERVICE_AREA));
 	}
 
 	if (ci) {
-		g_slist_free(assembly->recv_cell);
-		assembly->recv_cell = NULL;
-		cbs_assembly_expire(assembly, cbs_compare_node_by_gs,
+		g_hash_table_remove_all(assembly->recv_cell);
+
+		g_hash_table_foreach_remove(assembly->assembly_table,
+				cbs_node_in_gs,
 				GUINT_TO_POINTER(CBS_GEO_SCOPE_CELL_IMMEDIATE));
-		cbs_assembly_expire(assembly, cbs_compare_node_by_gs,
+		g_hash_table_foreach_remove(assembly->assembly_table,
+				cbs_node_in_gs,
 				GUINT_TO_POINTER(CBS_GEO_SCOPE_CELL_NORMAL));
 	}
 }
@@ -4291,38 +4777,38 @@ GSList *cbs_assembly_add_page(struct cbs_assembly *assembly,
 	struct cbs_assembly_node *node;
 	GSList *completed;
 	unsigned int new_serial;
-	GSList **recv;
-	GSList *l;
-	GSList *prev;
+	unsigned int msg_key;
+	GHashTable *recv;
+	gpointer old_serial;
 	int position;
+	int j;
 
 	new_serial = cbs->gs << 14;
 	new_serial |= cbs->message_code << 4;
 	new_serial |= cbs->update_number;
 	new_serial |= cbs->message_identifier << 16;
 
+	/* The same message regardless of its update number */
+	msg_key = new_serial & (~0xf);
+
 	if (cbs->gs == CBS_GEO_SCOPE_PLMN)
-		recv = &assembly->recv_plmn;
+		recv = assembly->recv_plmn;
 	else if (cbs->gs == CBS_GEO_SCOPE_SERVICE_AREA)
-		recv = &assembly->recv_loc;
+		recv = assembly->recv_loc;
 	else
-		recv = &assembly->recv_cell;
-
-	/* Have we seen this message before? */
-	l = g_slist_find_custom(*recv, GUINT_TO_POINTER(new_serial),
-				cbs_compare_recv_by_serial);
+		recv = assembly->recv_cell;
 
-	/* If we have, is the message newer? */
-	if (l && !cbs_is_update_newer(new_serial, GPOINTER_TO_UINT(l->data)))
+	/* Have we seen this message before?  If we have, is it newer? */
+	if (g_hash_table_lookup_extended(recv, GUINT_TO_POINTER(msg_key),
+						NULL, &old_serial) &&
+			!cbs_is_update_newer(new_serial,
+						GPOINTER_TO_UINT(old_serial)))
 		return NULL;
 
 	/* Easy case first, page 1 of 1 */
 	if (cbs->max_pages == 1 && cbs->page == 1) {
-		if (l)
-			l->data = GUINT_TO_POINTER(new_serial);
-		else
-			*recv = g_slist_prepend(*recv,
-						GUINT_TO_POINTER(new_serial));
+		g_hash_table_insert(recv, GUINT_TO_POINTER(msg_key),
+					GUINT_TO_POINTER(new_serial));
 
 		newcbs = g_new(struct cbs, 1);
 		memcpy(newcbs, cbs, sizeof(struct cbs));
@@ -4331,37 +4817,24 @@ GSList *cbs_assembly_add_page(struct cbs_assembly *assembly,
 		return completed;
 	}
 
-	prev = NULL;
-	position = 0;
-
-	for (l = assembly->assembly_list; l; prev = l, l = l->next) {
-		int j;
-		node = l->data;
-
-		if (new_serial != node->serial)
-			continue;
+	node = g_hash_table_lookup(assembly->assembly_table,
+					GUINT_TO_POINTER(new_serial));
 
-		if (node->bitmap & (1 << cbs->page))
-			return NULL;
-
-		for (j = 1; j < cbs->page; j++)
-			if (node->bitmap & (1 << j))
-				position += 1;
-
-		goto out;
-	}
-
-	node = g_new0(struct cbs_assembly_node, 1);
-	node->serial = new_serial;
+	if (node == NULL) {
+		node = g_new0(struct cbs_assembly_node, 1);
+		node->serial = new_serial;
 
-	assembly->assembly_list = g_slist_prepend(assembly->assembly_list,
-							node);
+		g_hash_table_insert(assembly->assembly_table,
+					GUINT_TO_POINTER(new_serial), node);
+	} else if (node->bitmap & (1 << cbs->page))
+		return NULL;
 
-	prev = NULL;
-	l = assembly->assembly_list;
 	position = 0;
 
-out:
+	for (j = 1; j < cbs->page; j++)
+		if (node->bitmap & (1 << j))
+			position += 1;
+
 	newcbs = g_new(struct cbs, 1);
 	memcpy(newcbs, cbs, sizeof(struct cbs));
 	node->pages = g_slist_insert(node->pages, newcbs, position);
@@ -4371,18 +4844,24 @@ out:
 		return NULL;
 
 	completed = node->pages;
+	node->pages = NULL;
 
-	if (prev)
-		prev->next = l->next;
-	else
-		assembly->assembly_list = l->next;
+	g_hash_table_remove(assembly->assembly_table,
+				GUINT_TO_POINTER(new_serial));
 
-	g_free(node);
-	g_slist_free_1(l);
+	/*
+	 * Take care of the case where several updates are being
+	 * reassembled at the same time. If the newer one is assembled
+	 * first, then the subsequent old update is discarded, make
+	 * sure that we're also discarding the assembly node for the
+	 * partially assembled ones
+	 */
+	g_hash_table_foreach_remove(assembly->assembly_table,
+					cbs_node_is_outdated,
+					GUINT_TO_POINTER(new_serial));
 
-	cbs_assembly_expire(assembly, cbs_compare_node_by_update,
+	g_hash_table_insert(recv, GUINT_TO_POINTER(msg_key),
 				GUINT_TO_POINTER(new_serial));
-	*recv = g_slist_prepend(*recv, GUINT_TO_POINTER(new_serial));
 
 	return completed;
 }
@@ -4627,6 +5106,85 @@ gboolean cbs_topic_in_range(unsigned int topic, GSList *ranges)
 					cbs_topic_compare) != NULL;
 }
 
+static int cbs_topic_range_compare_min(const void *a, const void *b)
+{
+	const struct cbs_topic_range *ra = a;
+	const struct cbs_topic_range *rb = b;
+
+	return ra->min - rb->min;
+}
+
+struct cbs_topic_index *cbs_topic_index_new(GSList *ranges)
+{
+	struct cbs_topic_index *index;
+	struct cbs_topic_range *last;
+	unsigned int len = g_slist_length(ranges);
+	unsigned int i;
+	unsigned int n;
+	GSList *l;
+
+	index = g_malloc0(sizeof(struct cbs_topic_index) +
+				len * sizeof(struct cbs_topic_range));
+
+	for (l = ranges, i = 0; l; l = l->next, i++)
+		memcpy(&index->ranges[i], l->data,
+				sizeof(struct cbs_topic_range));
+
+	qsort(index->ranges, len, sizeof(struct cbs_topic_range),
+		cbs_topic_range_compare_min);
+
+	/* Merge overlapping and adjacent ranges */
+	for (i = 0, n = 0; i < len; i++) {
+		struct cbs_topic_range *range = &index->ranges[i];
+
+		last = n > 0 ? &index->ranges[n - 1] : NULL;
+
+		if (last && range->min <= last->max + 1) {
+			if (range->max > last->max)
+				last->max = range->max;
+
+			continue;
+		}
+
+		index->ranges[n++] = *range;
+	}
+
+	index->len = n;
+
+	return index;
+}
+
+void cbs_topic_index_free(struct cbs_topic_index *index)
+{
+	g_free(index);
+}
+
+gboolean cbs_topic_index_contains(const struct cbs_topic_index *index,
+					unsigned int topic)
+{
+	unsigned int lo = 0;
+	unsigned int hi;
+
+	if (index == NULL)
+		return FALSE;
+
+	hi = index->len;
+
+	while (lo < hi) {
+		unsigned int mid = lo + (hi - lo) / 2;
+		const struct cbs_topic_range *range = &index->ranges[mid];
+
+		if (topic < range->min)
+			hi = mid;
+		else if (topic > range->max)
+			lo = mid + 1;
+		else
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
 char *ussd_decode(int dcs, int len, const unsigned char *data)
 {
 	gboolean udhi;
@@ -376,6 +376,11 @@ struct id_table_node {
 struct status_report_assembly {
 	const char *imsi;
 	GHashTable *assembly_table;
+	GHashTable *mr_table;
+	GHashTable *log_pending;
+	unsigned int log_records;
+	gboolean log_compact;
+	gboolean legacy_backup;
 };
 
 struct cbs {
@@ -396,11 +401,15 @@ struct cbs_assembly_node {
 	GSList *pages;
 };
 
+/*
+ * Nodes being reassembled are keyed by their full serial, the received
+ * tables map the serial without the update number to the last one seen
+ */
 struct cbs_assembly {
-	GSList *assembly_list;
-	GSList *recv_plmn;
-	GSList *recv_loc;
-	GSList *recv_cell;
+	GHashTable *assembly_table;
+	GHashTable *recv_plmn;
+	GHashTable *recv_loc;
+	GHashTable *recv_cell;
 };
 
 struct cbs_topic_range {
@@ -408,6 +417,12 @@ struct cbs_topic_range {
 	unsigned short max;
 };
 
+/* Sorted, non-overlapping topic ranges for binary searching */
+struct cbs_topic_index {
+	unsigned int len;
+	struct cbs_topic_range ranges[];
+};
+
 struct txq_backup_entry {
 	GSList *msg_list;
 	unsigned char uuid[SMS_MSGID_LEN];
@@ -522,7 +537,12 @@ void status_report_assembly_add_fragment(struct status_report_assembly
 					unsigned char total_mrs);
 void status_report_assembly_expire(struct status_report_assembly *assembly,
 					time_t before);
+gboolean status_report_assembly_needs_sync(
+				struct status_report_assembly *assembly);
+void status_report_assembly_sync(struct status_report_assembly *assembly);
 
+void sms_tx_msgid(GSList *sms_list, unsigned long seq, gint64 time_us,
+				unsigned char msgid[SMS_MSGID_LEN]);
 gboolean sms_tx_backup_store(const char *imsi, unsigned long id,
 				unsigned long flags, const char *uuid,
 				guint8 seq, const unsigned char *pdu,
@@ -573,5 +593,10 @@ GSList *cbs_extract_topic_ranges(const char *ranges);
 GSList *cbs_optimize_ranges(GSList *ranges);
 gboolean cbs_topic_in_range(unsigned int topic, GSList *ranges);
 
+struct cbs_topic_index *cbs_topic_index_new(GSList *ranges);
+void cbs_topic_index_free(struct cbs_topic_index *index);
+gboolean cbs_topic_index_contains(const struct cbs_topic_index *index,
+					unsigned int topic);
+
 char *ussd_decode(int dcs, int len, const unsigned char *data);
 gboolean ussd_encode(const char *str, long *items_written, unsigned char *pdu);
@@ -2020,192 +2020,133 @@ static bool parse_dataobj_broadcast_network_info(
 	return true;
 }
 
+/* Indexed by the comprehension tag, without the CR bit */
+static const dataobj_handler dataobj_handlers[0x80] = {
+	[STK_DATA_OBJECT_TYPE_ADDRESS] = parse_dataobj_address,
+	[STK_DATA_OBJECT_TYPE_ALPHA_ID] = parse_dataobj_alpha_id,
+	[STK_DATA_OBJECT_TYPE_SUBADDRESS] = parse_dataobj_subaddress,
+	[STK_DATA_OBJECT_TYPE_CCP] = parse_dataobj_ccp,
+	[STK_DATA_OBJECT_TYPE_CBS_PAGE] = parse_dataobj_cbs_page,
+	[STK_DATA_OBJECT_TYPE_DURATION] = parse_dataobj_duration,
+	[STK_DATA_OBJECT_TYPE_ITEM] = parse_dataobj_item,
+	[STK_DATA_OBJECT_TYPE_ITEM_ID] = parse_dataobj_item_id,
+	[STK_DATA_OBJECT_TYPE_RESPONSE_LENGTH] = parse_dataobj_response_len,
+	[STK_DATA_OBJECT_TYPE_RESULT] = parse_dataobj_result,
+	[STK_DATA_OBJECT_TYPE_GSM_SMS_TPDU] = parse_dataobj_gsm_sms_tpdu,
+	[STK_DATA_OBJECT_TYPE_SS_STRING] = parse_dataobj_ss,
+	[STK_DATA_OBJECT_TYPE_TEXT] = parse_dataobj_text,
+	[STK_DATA_OBJECT_TYPE_TONE] = parse_dataobj_tone,
+	[STK_DATA_OBJECT_TYPE_USSD_STRING] = parse_dataobj_ussd,
+	[STK_DATA_OBJECT_TYPE_FILE_LIST] = parse_dataobj_file_list,
+	[STK_DATA_OBJECT_TYPE_LOCATION_INFO] = parse_dataobj_location_info,
+	[STK_DATA_OBJECT_TYPE_IMEI] = parse_dataobj_imei,
+	[STK_DATA_OBJECT_TYPE_HELP_REQUEST] = parse_dataobj_help_request,
+	[STK_DATA_OBJECT_TYPE_NETWORK_MEASUREMENT_RESULTS] =
+		parse_dataobj_network_measurement_results,
+	[STK_DATA_OBJECT_TYPE_DEFAULT_TEXT] = parse_dataobj_default_text,
+	[STK_DATA_OBJECT_TYPE_ITEMS_NEXT_ACTION_INDICATOR] =
+		parse_dataobj_items_next_action_indicator,
+	[STK_DATA_OBJECT_TYPE_EVENT_LIST] = parse_dataobj_event_list,
+	[STK_DATA_OBJECT_TYPE_CAUSE] = parse_dataobj_cause,
+	[STK_DATA_OBJECT_TYPE_LOCATION_STATUS] = parse_dataobj_location_status,
+	[STK_DATA_OBJECT_TYPE_TRANSACTION_ID] = parse_dataobj_transaction_id,
+	[STK_DATA_OBJECT_TYPE_BCCH_CHANNEL_LIST] =
+		parse_dataobj_bcch_channel_list,
+	[STK_DATA_OBJECT_TYPE_CALL_CONTROL_REQUESTED_ACTION] =
+		parse_dataobj_call_control_requested_action,
+	[STK_DATA_OBJECT_TYPE_ICON_ID] = parse_dataobj_icon_id,
+	[STK_DATA_OBJECT_TYPE_ITEM_ICON_ID_LIST] =
+		parse_dataobj_item_icon_id_list,
+	[STK_DATA_OBJECT_TYPE_CARD_READER_STATUS] =
+		parse_dataobj_card_reader_status,
+	[STK_DATA_OBJECT_TYPE_CARD_ATR] = parse_dataobj_card_atr,
+	[STK_DATA_OBJECT_TYPE_C_APDU] = parse_dataobj_c_apdu,
+	[STK_DATA_OBJECT_TYPE_R_APDU] = parse_dataobj_r_apdu,
+	[STK_DATA_OBJECT_TYPE_TIMER_ID] = parse_dataobj_timer_id,
+	[STK_DATA_OBJECT_TYPE_TIMER_VALUE] = parse_dataobj_timer_value,
+	[STK_DATA_OBJECT_TYPE_DATETIME_TIMEZONE] =
+		parse_dataobj_datetime_timezone,
+	[STK_DATA_OBJECT_TYPE_AT_COMMAND] = parse_dataobj_at_command,
+	[STK_DATA_OBJECT_TYPE_AT_RESPONSE] = parse_dataobj_at_response,
+	[STK_DATA_OBJECT_TYPE_BC_REPEAT_INDICATOR] =
+		parse_dataobj_bc_repeat_indicator,
+	[STK_DATA_OBJECT_TYPE_IMMEDIATE_RESPONSE] = parse_dataobj_imm_resp,
+	[STK_DATA_OBJECT_TYPE_DTMF_STRING] = parse_dataobj_dtmf_string,
+	[STK_DATA_OBJECT_TYPE_LANGUAGE] = parse_dataobj_language,
+	[STK_DATA_OBJECT_TYPE_BROWSER_ID] = parse_dataobj_browser_id,
+	[STK_DATA_OBJECT_TYPE_TIMING_ADVANCE] = parse_dataobj_timing_advance,
+	[STK_DATA_OBJECT_TYPE_URL] = parse_dataobj_url,
+	[STK_DATA_OBJECT_TYPE_BEARER] = parse_dataobj_bearer,
+	[STK_DATA_OBJECT_TYPE_PROVISIONING_FILE_REF] =
+		parse_dataobj_provisioning_file_reference,
+	[STK_DATA_OBJECT_TYPE_BROWSER_TERMINATION_CAUSE] =
+		parse_dataobj_browser_termination_cause,
+	[STK_DATA_OBJECT_TYPE_BEARER_DESCRIPTION] =
+		parse_dataobj_bearer_description,
+	[STK_DATA_OBJECT_TYPE_CHANNEL_DATA] = parse_dataobj_channel_data,
+	[STK_DATA_OBJECT_TYPE_CHANNEL_DATA_LENGTH] =
+		parse_dataobj_channel_data_length,
+	[STK_DATA_OBJECT_TYPE_BUFFER_SIZE] = parse_dataobj_buffer_size,
+	[STK_DATA_OBJECT_TYPE_CHANNEL_STATUS] = parse_dataobj_channel_status,
+	[STK_DATA_OBJECT_TYPE_CARD_READER_ID] = parse_dataobj_card_reader_id,
+	[STK_DATA_OBJECT_TYPE_OTHER_ADDRESS] = parse_dataobj_other_address,
+	[STK_DATA_OBJECT_TYPE_UICC_TE_INTERFACE] =
+		parse_dataobj_uicc_te_interface,
+	[STK_DATA_OBJECT_TYPE_AID] = parse_dataobj_aid,
+	[STK_DATA_OBJECT_TYPE_ACCESS_TECHNOLOGY] =
+		parse_dataobj_access_technology,
+	[STK_DATA_OBJECT_TYPE_DISPLAY_PARAMETERS] =
+		parse_dataobj_display_parameters,
+	[STK_DATA_OBJECT_TYPE_SERVICE_RECORD] = parse_dataobj_service_record,
+	[STK_DATA_OBJECT_TYPE_DEVICE_FILTER] = parse_dataobj_device_filter,
+	[STK_DATA_OBJECT_TYPE_SERVICE_SEARCH] = parse_dataobj_service_search,
+	[STK_DATA_OBJECT_TYPE_ATTRIBUTE_INFO] = parse_dataobj_attribute_info,
+	[STK_DATA_OBJECT_TYPE_SERVICE_AVAILABILITY] =
+		parse_dataobj_service_availability,
+	[STK_DATA_OBJECT_TYPE_REMOTE_ENTITY_ADDRESS] =
+		parse_dataobj_remote_entity_address,
+	[STK_DATA_OBJECT_TYPE_ESN] = parse_dataobj_esn,
+	[STK_DATA_OBJECT_TYPE_NETWORK_ACCESS_NAME] =
+		parse_dataobj_network_access_name,
+	[STK_DATA_OBJECT_TYPE_CDMA_SMS_TPDU] = parse_dataobj_cdma_sms_tpdu,
+	[STK_DATA_OBJECT_TYPE_TEXT_ATTRIBUTE] = parse_dataobj_text_attr,
+	[STK_DATA_OBJECT_TYPE_PDP_ACTIVATION_PARAMETER] =
+		parse_dataobj_pdp_act_par,
+	[STK_DATA_OBJECT_TYPE_ITEM_TEXT_ATTRIBUTE_LIST] =
+		parse_dataobj_item_text_attribute_list,
+	[STK_DATA_OBJECT_TYPE_UTRAN_MEASUREMENT_QUALIFIER] =
+		parse_dataobj_utran_meas_qualifier,
+	[STK_DATA_OBJECT_TYPE_IMEISV] = parse_dataobj_imeisv,
+	[STK_DATA_OBJECT_TYPE_NETWORK_SEARCH_MODE] =
+		parse_dataobj_network_search_mode,
+	[STK_DATA_OBJECT_TYPE_BATTERY_STATE] = parse_dataobj_battery_state,
+	[STK_DATA_OBJECT_TYPE_BROWSING_STATUS] = parse_dataobj_browsing_status,
+	[STK_DATA_OBJECT_TYPE_FRAME_LAYOUT] = parse_dataobj_frame_layout,
+	[STK_DATA_OBJECT_TYPE_FRAMES_INFO] = parse_dataobj_frames_info,
+	[STK_DATA_OBJECT_TYPE_FRAME_ID] = parse_dataobj_frame_id,
+	[STK_DATA_OBJECT_TYPE_MEID] = parse_dataobj_meid,
+	[STK_DATA_OBJECT_TYPE_MMS_REFERENCE] = parse_dataobj_mms_reference,
+	[STK_DATA_OBJECT_TYPE_MMS_ID] = parse_dataobj_mms_id,
+	[STK_DATA_OBJECT_TYPE_MMS_TRANSFER_STATUS] =
+		parse_dataobj_mms_transfer_status,
+	[STK_DATA_OBJECT_TYPE_MMS_CONTENT_ID] = parse_dataobj_mms_content_id,
+	[STK_DATA_OBJECT_TYPE_MMS_NOTIFICATION] =
+		parse_dataobj_mms_notification,
+	[STK_DATA_OBJECT_TYPE_LAST_ENVELOPE] = parse_dataobj_last_envelope,
+	[STK_DATA_OBJECT_TYPE_REGISTRY_APPLICATION_DATA] =
+		parse_dataobj_registry_application_data,
+	[STK_DATA_OBJECT_TYPE_ACTIVATE_DESCRIPTOR] =
+		parse_dataobj_activate_descriptor,
+	[STK_DATA_OBJECT_TYPE_BROADCAST_NETWORK_INFO] =
+		parse_dataobj_broadcast_network_info,
+};
+
 static dataobj_handler handler_for_type(enum stk_data_object_type type)
 {
-	switch (type) {
-	case STK_DATA_OBJECT_TYPE_ADDRESS:
-		return parse_dataobj_address;
-	case STK_DATA_OBJECT_TYPE_ALPHA_ID:
-		return parse_dataobj_alpha_id;
-	case STK_DATA_OBJECT_TYPE_SUBADDRESS:
-		return parse_dataobj_subaddress;
-	case STK_DATA_OBJECT_TYPE_CCP:
-		return parse_dataobj_ccp;
-	case STK_DATA_OBJECT_TYPE_CBS_PAGE:
-		return parse_dataobj_cbs_page;
-	case STK_DATA_OBJECT_TYPE_DURATION:
-		return parse_dataobj_duration;
-	case STK_DATA_OBJECT_TYPE_ITEM:
-		return parse_dataobj_item;
-	case STK_DATA_OBJECT_TYPE_ITEM_ID:
-		return parse_dataobj_item_id;
-	case STK_DATA_OBJECT_TYPE_RESPONSE_LENGTH:
-		return parse_dataobj_response_len;
-	case STK_DATA_OBJECT_TYPE_RESULT:
-		return parse_dataobj_result;
-	case STK_DATA_OBJECT_TYPE_GSM_SMS_TPDU:
-		return parse_dataobj_gsm_sms_tpdu;
-	case STK_DATA_OBJECT_TYPE_SS_STRING:
-		return parse_dataobj_ss;
-	case STK_DATA_OBJECT_TYPE_TEXT:
-		return parse_dataobj_text;
-	case STK_DATA_OBJECT_TYPE_TONE:
-		return parse_dataobj_tone;
-	case STK_DATA_OBJECT_TYPE_USSD_STRING:
-		return parse_dataobj_ussd;
-	case STK_DATA_OBJECT_TYPE_FILE_LIST:
-		return parse_dataobj_file_list;
-	case STK_DATA_OBJECT_TYPE_LOCATION_INFO:
-		return parse_dataobj_location_info;
-	case STK_DATA_OBJECT_TYPE_IMEI:
-		return parse_dataobj_imei;
-	case STK_DATA_OBJECT_TYPE_HELP_REQUEST:
-		return parse_dataobj_help_request;
-	case STK_DATA_OBJECT_TYPE_NETWORK_MEASUREMENT_RESULTS:
-		return parse_dataobj_network_measurement_results;
-	case STK_DATA_OBJECT_TYPE_DEFAULT_TEXT:
-		return parse_dataobj_default_text;
-	case STK_DATA_OBJECT_TYPE_ITEMS_NEXT_ACTION_INDICATOR:
-		return parse_dataobj_items_next_action_indicator;
-	case STK_DATA_OBJECT_TYPE_EVENT_LIST:
-		return parse_dataobj_event_list;
-	case STK_DATA_OBJECT_TYPE_CAUSE:
-		return parse_dataobj_cause;
-	case STK_DATA_OBJECT_TYPE_LOCATION_STATUS:
-		return parse_dataobj_location_status;
-	case STK_DATA_OBJECT_TYPE_TRANSACTION_ID:
-		return parse_dataobj_transaction_id;
-	case STK_DATA_OBJECT_TYPE_BCCH_CHANNEL_LIST:
-		return parse_dataobj_bcch_channel_list;
-	case STK_DATA_OBJECT_TYPE_CALL_CONTROL_REQUESTED_ACTION:
-		return parse_dataobj_call_control_requested_action;
-	case STK_DATA_OBJECT_TYPE_ICON_ID:
-		return parse_dataobj_icon_id;
-	case STK_DATA_OBJECT_TYPE_ITEM_ICON_ID_LIST:
-		return parse_dataobj_item_icon_id_list;
-	case STK_DATA_OBJECT_TYPE_CARD_READER_STATUS:
-		return parse_dataobj_card_reader_status;
-	case STK_DATA_OBJECT_TYPE_CARD_ATR:
-		return parse_dataobj_card_atr;
-	case STK_DATA_OBJECT_TYPE_C_APDU:
-		return parse_dataobj_c_apdu;
-	case STK_DATA_OBJECT_TYPE_R_APDU:
-		return parse_dataobj_r_apdu;
-	case STK_DATA_OBJECT_TYPE_TIMER_ID:
-		return parse_dataobj_timer_id;
-	case STK_DATA_OBJECT_TYPE_TIMER_VALUE:
-		return parse_dataobj_timer_value;
-	case STK_DATA_OBJECT_TYPE_DATETIME_TIMEZONE:
-		return parse_dataobj_datetime_timezone;
-	case STK_DATA_OBJECT_TYPE_AT_COMMAND:
-		return parse_dataobj_at_command;
-	case STK_DATA_OBJECT_TYPE_AT_RESPONSE:
-		return parse_dataobj_at_response;
-	case STK_DATA_OBJECT_TYPE_BC_REPEAT_INDICATOR:
-		return parse_dataobj_bc_repeat_indicator;
-	case STK_DATA_OBJECT_TYPE_IMMEDIATE_RESPONSE:
-		return parse_dataobj_imm_resp;
-	case STK_DATA_OBJECT_TYPE_DTMF_STRING:
-		return parse_dataobj_dtmf_string;
-	case STK_DATA_OBJECT_TYPE_LANGUAGE:
-		return parse_dataobj_language;
-	case STK_DATA_OBJECT_TYPE_BROWSER_ID:
-		return parse_dataobj_browser_id;
-	case STK_DATA_OBJECT_TYPE_TIMING_ADVANCE:
-		return parse_dataobj_timing_advance;
-	case STK_DATA_OBJECT_TYPE_URL:
-		return parse_dataobj_url;
-	case STK_DATA_OBJECT_TYPE_BEARER:
-		return parse_dataobj_bearer;
-	case STK_DATA_OBJECT_TYPE_PROVISIONING_FILE_REF:
-		return parse_dataobj_provisioning_file_reference;
-	case STK_DATA_OBJECT_TYPE_BROWSER_TERMINATION_CAUSE:
-		return parse_dataobj_browser_termination_cause;
-	case STK_DATA_OBJECT_TYPE_BEARER_DESCRIPTION:
-		return parse_dataobj_bearer_description;
-	case STK_DATA_OBJECT_TYPE_CHANNEL_DATA:
-		return parse_dataobj_channel_data;
-	case STK_DATA_OBJECT_TYPE_CHANNEL_DATA_LENGTH:
-		return parse_dataobj_channel_data_length;
-	case STK_DATA_OBJECT_TYPE_BUFFER_SIZE:
-		return parse_dataobj_buffer_size;
-	case STK_DATA_OBJECT_TYPE_CHANNEL_STATUS:
-		return parse_dataobj_channel_status;
-	case STK_DATA_OBJECT_TYPE_CARD_READER_ID:
-		return parse_dataobj_card_reader_id;
-	case STK_DATA_OBJECT_TYPE_OTHER_ADDRESS:
-		return parse_dataobj_other_address;
-	case STK_DATA_OBJECT_TYPE_UICC_TE_INTERFACE:
-		return parse_dataobj_uicc_te_interface;
-	case STK_DATA_OBJECT_TYPE_AID:
-		return parse_dataobj_aid;
-	case STK_DATA_OBJECT_TYPE_ACCESS_TECHNOLOGY:
-		return parse_dataobj_access_technology;
-	case STK_DATA_OBJECT_TYPE_DISPLAY_PARAMETERS:
-		return parse_dataobj_display_parameters;
-	case STK_DATA_OBJECT_TYPE_SERVICE_RECORD:
-		return parse_dataobj_service_record;
-	case STK_DATA_OBJECT_TYPE_DEVICE_FILTER:
-		return parse_dataobj_device_filter;
-	case STK_DATA_OBJECT_TYPE_SERVICE_SEARCH:
-		return parse_dataobj_service_search;
-	case STK_DATA_OBJECT_TYPE_ATTRIBUTE_INFO:
-		return parse_dataobj_attribute_info;
-	case STK_DATA_OBJECT_TYPE_SERVICE_AVAILABILITY:
-		return parse_dataobj_service_availability;
-	case STK_DATA_OBJECT_TYPE_REMOTE_ENTITY_ADDRESS:
-		return parse_dataobj_remote_entity_address;
-	case STK_DATA_OBJECT_TYPE_ESN:
-		return parse_dataobj_esn;
-	case STK_DATA_OBJECT_TYPE_NETWORK_ACCESS_NAME:
-		return parse_dataobj_network_access_name;
-	case STK_DATA_OBJECT_TYPE_CDMA_SMS_TPDU:
-		return parse_dataobj_cdma_sms_tpdu;
-	case STK_DATA_OBJECT_TYPE_TEXT_ATTRIBUTE:
-		return parse_dataobj_text_attr;
-	case STK_DATA_OBJECT_TYPE_PDP_ACTIVATION_PARAMETER:
-		return parse_dataobj_pdp_act_par;
-	case STK_DATA_OBJECT_TYPE_ITEM_TEXT_ATTRIBUTE_LIST:
-		return parse_dataobj_item_text_attribute_list;
-	case STK_DATA_OBJECT_TYPE_UTRAN_MEASUREMENT_QUALIFIER:
-		return parse_dataobj_utran_meas_qualifier;
-	case STK_DATA_OBJECT_TYPE_IMEISV:
-		return parse_dataobj_imeisv;
-	case STK_DATA_OBJECT_TYPE_NETWORK_SEARCH_MODE:
-		return parse_dataobj_network_search_mode;
-	case STK_DATA_OBJECT_TYPE_BATTERY_STATE:
-		return parse_dataobj_battery_state;
-	case STK_DATA_OBJECT_TYPE_BROWSING_STATUS:
-		return parse_dataobj_browsing_status;
-	case STK_DATA_OBJECT_TYPE_FRAME_LAYOUT:
-		return parse_dataobj_frame_layout;
-	case STK_DATA_OBJECT_TYPE_FRAMES_INFO:
-		return parse_dataobj_frames_info;
-	case STK_DATA_OBJECT_TYPE_FRAME_ID:
-		return parse_dataobj_frame_id;
-	case STK_DATA_OBJECT_TYPE_MEID:
-		return parse_dataobj_meid;
-	case STK_DATA_OBJECT_TYPE_MMS_REFERENCE:
-		return parse_dataobj_mms_reference;
-	case STK_DATA_OBJECT_TYPE_MMS_ID:
-		return parse_dataobj_mms_id;
-	case STK_DATA_OBJECT_TYPE_MMS_TRANSFER_STATUS:
-		return parse_dataobj_mms_transfer_status;
-	case STK_DATA_OBJECT_TYPE_MMS_CONTENT_ID:
-		return parse_dataobj_mms_content_id;
-	case STK_DATA_OBJECT_TYPE_MMS_NOTIFICATION:
-		return parse_dataobj_mms_notification;
-	case STK_DATA_OBJECT_TYPE_LAST_ENVELOPE:
-		return parse_dataobj_last_envelope;
-	case STK_DATA_OBJECT_TYPE_REGISTRY_APPLICATION_DATA:
-		return parse_dataobj_registry_application_data;
-	case STK_DATA_OBJECT_TYPE_ACTIVATE_DESCRIPTOR:
-		return parse_dataobj_activate_descriptor;
-	case STK_DATA_OBJECT_TYPE_BROADCAST_NETWORK_INFO:
-		return parse_dataobj_broadcast_network_info;
-	default:
+	if (type >= L_ARRAY_SIZE(dataobj_handlers))
 		return NULL;
-	}
+
+	return dataobj_handlers[type];
 }
 
 static void destroy_stk_item(gpointer pointer)
@@ -2291,9 +2232,13 @@ static dataobj_handler list_handler_for_type(enum stk_data_object_type type)
 	}
 }
 
+/* The most data objects any single command or envelope looks for */
+#define DATAOBJ_MAX_ENTRIES 16
+
 struct dataobj_handler_entry {
 	enum stk_data_object_type type;
 	int flags;
+	dataobj_handler handler;
 	void *data;
 };
 
@@ -2301,8 +2246,10 @@ static enum stk_command_parse_result parse_dataobj(
 					struct comprehension_tlv_iter *iter,
 					enum stk_data_object_type type, ...)
 {
-	GSList *entries = NULL;
-	GSList *l;
+	struct dataobj_handler_entry entries[DATAOBJ_MAX_ENTRIES];
+	unsigned int n_entries = 0;
+	unsigned int next = 0;
+	unsigned int i;
 	va_list args;
 	bool minimum_set = true;
 	bool parse_error = false;
@@ -2312,65 +2259,56 @@ static enum stk_command_parse_result parse_dataobj(
 	while (type != STK_DATA_OBJECT_TYPE_INVALID) {
 		struct dataobj_handler_entry *entry;
 
-		entry = g_new0(struct dataobj_handler_entry, 1);
+		if (n_entries == DATAOBJ_MAX_ENTRIES) {
+			va_end(args);
+			return STK_PARSE_RESULT_DATA_NOT_UNDERSTOOD;
+		}
 
+		entry = &entries[n_entries++];
 		entry->type = type;
 		entry->flags = va_arg(args, int);
 		entry->data = va_arg(args, void *);
 
+		if (entry->flags & DATAOBJ_FLAG_LIST)
+			entry->handler = list_handler_for_type(type);
+		else
+			entry->handler = handler_for_type(type);
+
 		type = va_arg(args, enum stk_data_object_type);
-		entries = g_slist_prepend(entries, entry);
 	}
 
 	va_end(args);
 
-	entries = g_slist_reverse(entries);
-
-	l = entries;
 	while (comprehension_tlv_iter_next(iter) == TRUE) {
-		dataobj_handler handler;
-		struct dataobj_handler_entry *entry;
-		GSList *l2;
-
-		for (l2 = l; l2; l2 = l2->next) {
-			entry = l2->data;
+		unsigned short tag = comprehension_tlv_iter_get_tag(iter);
 
-			if (comprehension_tlv_iter_get_tag(iter) == entry->type)
+		for (i = next; i < n_entries; i++) {
+			if (tag == entries[i].type)
 				break;
 
 			/* Can't skip over mandatory objects */
-			if (entry->flags & DATAOBJ_FLAG_MANDATORY) {
-				l2 = NULL;
+			if (entries[i].flags & DATAOBJ_FLAG_MANDATORY) {
+				i = n_entries;
 				break;
 			}
 		}
 
-		if (l2 == NULL) {
+		if (i == n_entries) {
 			if (comprehension_tlv_get_cr(iter) == TRUE)
 				parse_error = true;
 
 			continue;
 		}
 
-		if (entry->flags & DATAOBJ_FLAG_LIST)
-			handler = list_handler_for_type(entry->type);
-		else
-			handler = handler_for_type(entry->type);
-
-		if (!handler(iter, entry->data))
+		if (!entries[i].handler(iter, entries[i].data))
 			parse_error = true;
 
-		l = l2->next;
+		next = i + 1;
 	}
 
-	for (; l; l = l->next) {
-		struct dataobj_handler_entry *entry = l->data;
-
-		if (entry->flags & DATAOBJ_FLAG_MANDATORY)
+	for (i = next; i < n_entries; i++)
+		if (entries[i].flags & DATAOBJ_FLAG_MANDATORY)
 			minimum_set = false;
-	}
-
-	g_slist_free_full(entries, g_free);
 
 	if (!minimum_set)
 		return STK_PARSE_RESULT_MISSING_VALUE;
@@ -470,27 +470,18 @@ static void append_voicecall_properties(struct voicecall *v,
 
 }
 
+static void voicecall_append_properties(DBusMessageIter *dict, void *data)
+{
+	append_voicecall_properties(data, dict);
+}
+
 static DBusMessage *voicecall_get_properties(DBusConnection *conn,
 						DBusMessage *msg, void *data)
 {
-	struct voicecall *v = data;
-	DBusMessage *reply;
-	DBusMessageIter iter;
-	DBusMessageIter dict;
-
-	reply = dbus_message_new_method_return(msg);
-	if (reply == NULL)
-		return NULL;
-
-	dbus_message_iter_init_append(reply, &iter);
-
-	dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-					OFONO_PROPERTIES_ARRAY_SIGNATURE,
-					&dict);
-	append_voicecall_properties(v, &dict);
-	dbus_message_iter_close_container(&iter, &dict);
-
-	return reply;
+	return __ofono_dbus_cached_properties_reply(msg,
+						OFONO_VOICECALL_INTERFACE,
+						voicecall_append_properties,
+						data);
 }
 
 static DBusMessage *voicecall_deflect(DBusConnection *conn,
@@ -1072,6 +1063,10 @@ static gboolean voicecall_dbus_unregister(struct ofono_voicecall *vc,
 	DBusConnection *conn = ofono_dbus_get_connection();
 	const char *path = voicecall_build_path(vc, v->call);
 
+	/* Call paths get reused, don't let the next call see stale data */
+	__ofono_dbus_cached_properties_invalidate(path,
+						OFONO_VOICECALL_INTERFACE);
+
 	return g_dbus_unregister_interface(conn, path,
 						OFONO_VOICECALL_INTERFACE);
 }
@@ -2575,6 +2570,7 @@ static void emit_en_list_changed(struct ofono_voicecall *vc)
 	int i;
 	GHashTableIter iter;
 	gpointer key, value;
+	GSList *l;
 
 	list = g_new0(char *, g_hash_table_size(vc->en_list) + 1);
 	g_hash_table_iter_init(&iter, vc->en_list);
@@ -2587,6 +2583,15 @@ static void emit_en_list_changed(struct ofono_voicecall *vc)
 				"EmergencyNumbers", DBUS_TYPE_STRING, &list);
 
 	g_free(list);
+
+	/* The Emergency property of the calls depends on the list */
+	for (l = vc->call_list; l; l = l->next) {
+		struct voicecall *v = l->data;
+
+		__ofono_dbus_cached_properties_invalidate(
+					voicecall_build_path(vc, v->call),
+					OFONO_VOICECALL_INTERFACE);
+	}
 }
 
 static void set_new_ecc(struct ofono_voicecall *vc)
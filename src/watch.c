@@ -26,11 +26,20 @@
 #include <glib.h>
 #include "ofono.h"
 
+/*
+ * Items are kept in an intrusive doubly linked list, most recently added
+ * first, and indexed by id so that removal does not need to walk the
+ * list.  An item removed while a dispatch is in progress is marked by
+ * clearing its id and is only unlinked and freed once the outermost
+ * dispatch has finished.
+ */
+
 struct ofono_watchlist *__ofono_watchlist_new(ofono_destroy_func destroy)
 {
 	struct ofono_watchlist *watchlist;
 
 	watchlist = g_new0(struct ofono_watchlist, 1);
+	watchlist->index = g_hash_table_new(g_direct_hash, g_direct_equal);
 	watchlist->destroy = destroy;
 
 	return watchlist;
@@ -41,64 +50,127 @@ unsigned int __ofono_watchlist_add_item(struct ofono_watchlist *watchlist,
 {
 	item->id = ++watchlist->next_id;
 
-	watchlist->items = g_slist_prepend(watchlist->items, item);
+	item->prev = NULL;
+	item->next = watchlist->items;
+
+	if (watchlist->items)
+		watchlist->items->prev = item;
+
+	watchlist->items = item;
+	watchlist->n_items++;
+
+	g_hash_table_insert(watchlist->index, GUINT_TO_POINTER(item->id),
+				item);
 
 	return item->id;
 }
 
+static void watchlist_item_free(struct ofono_watchlist *watchlist,
+					struct ofono_watchlist_item *item)
+{
+	if (item->prev)
+		item->prev->next = item->next;
+	else
+		watchlist->items = item->next;
+
+	if (item->next)
+		item->next->prev = item->prev;
+
+	item->prev = NULL;
+	item->next = NULL;
+
+	if (watchlist->destroy)
+		watchlist->destroy(item);
+}
+
 gboolean __ofono_watchlist_remove_item(struct ofono_watchlist *watchlist,
 					unsigned int id)
 {
 	struct ofono_watchlist_item *item;
-	GSList *p;
-	GSList *c;
-
-	p = NULL;
-	c = watchlist->items;
 
-	while (c) {
-		item = c->data;
+	if (id == 0)
+		return FALSE;
 
-		if (item->id != id) {
-			p = c;
-			c = c->next;
-			continue;
-		}
+	item = g_hash_table_lookup(watchlist->index, GUINT_TO_POINTER(id));
+	if (item == NULL)
+		return FALSE;
 
-		if (p)
-			p->next = c->next;
-		else
-			watchlist->items = c->next;
+	g_hash_table_remove(watchlist->index, GUINT_TO_POINTER(id));
+	watchlist->n_items--;
+	item->id = 0;
 
-		if (item->destroy)
-			item->destroy(item->notify_data);
+	if (item->destroy)
+		item->destroy(item->notify_data);
 
-		if (watchlist->destroy)
-			watchlist->destroy(item);
-		g_slist_free_1(c);
+	if (watchlist->dispatching)
+		watchlist->removed = g_slist_prepend(watchlist->removed, item);
+	else
+		watchlist_item_free(watchlist, item);
 
-		return TRUE;
-	}
-
-	return FALSE;
+	return TRUE;
 }
 
 void __ofono_watchlist_free(struct ofono_watchlist *watchlist)
 {
 	struct ofono_watchlist_item *item;
-	GSList *l;
+	struct ofono_watchlist_item *next;
 
-	for (l = watchlist->items; l; l = l->next) {
-		item = l->data;
+	for (item = watchlist->items; item; item = next) {
+		next = item->next;
 
-		if (item->destroy)
+		if (item->id && item->destroy)
 			item->destroy(item->notify_data);
 
 		if (watchlist->destroy)
 			watchlist->destroy(item);
 	}
 
-	g_slist_free(watchlist->items);
-	watchlist->items = NULL;
+	g_slist_free(watchlist->removed);
+	g_hash_table_destroy(watchlist->index);
 	g_free(watchlist);
 }
+
+gboolean __ofono_watchlist_is_empty(struct ofono_watchlist *watchlist)
+{
+	return watchlist->n_items == 0;
+}
+
+void __ofono_watchlist_dispatch_begin(struct ofono_watchlist *watchlist)
+{
+	watchlist->dispatching++;
+}
+
+void __ofono_watchlist_dispatch_end(struct ofono_watchlist *watchlist)
+{
+	GSList *l;
+
+	if (--watchlist->dispatching)
+		return;
+
+	for (l = watchlist->removed; l; l = l->next)
+		watchlist_item_free(watchlist, l->data);
+
+	g_slist_free(watchlist->removed);
+	watchlist->removed = NULL;
+}
+
+static struct ofono_watchlist_item *watchlist_skip_removed(
+					struct ofono_watchlist_item *item)
+{
+	while (item && item->id == 0)
+		item = item->next;
+
+	return item;
+}
+
+struct ofono_watchlist_item *__ofono_watchlist_first(
+					struct ofono_watchlist *watchlist)
+{
+	return watchlist_skip_removed(watchlist->items);
+}
+
+struct ofono_watchlist_item *__ofono_watchlist_next(
+					struct ofono_watchlist_item *item)
+{
+	return watchlist_skip_removed(item->next);
+}
@@ -0,0 +1,328 @@
+/*
+ *
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2008-2011  Intel Corporation. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+/*
+ * Runs the PDU vectors of the SMS, CBS and STK unit tests through the
+ * decoders in a timed loop and reports ns/PDU and allocations/PDU:
+ *
+ *	unit/bench-pdu [iterations]
+ *
+ * When built with -DBENCH_PDU_FUZZER and -fsanitize=fuzzer the same
+ * decode paths are exposed as a libFuzzer entry point instead.  The first
+ * input byte selects the decoder, the rest is the PDU.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ell/ell.h>
+#include <glib.h>
+
+#include <ofono/types.h>
+#include "util.h"
+#include "smsutil.h"
+#include "simutil.h"
+#include "stkutil.h"
+
+#include "sms-test-data.h"
+#include "stk-test-data.h"
+
+static gboolean decode_sms(const unsigned char *pdu, int len,
+				gboolean outgoing, int tpdu_len)
+{
+	struct sms sms;
+	GSList *list;
+	char *text;
+
+	if (!sms_decode(pdu, len, outgoing, tpdu_len, &sms))
+		return FALSE;
+
+	if (sms.type != SMS_TYPE_DELIVER && sms.type != SMS_TYPE_SUBMIT)
+		return TRUE;
+
+	list = g_slist_prepend(NULL, &sms);
+	text = sms_decode_text(list);
+	g_slist_free(list);
+	l_free(text);
+
+	return TRUE;
+}
+
+static gboolean decode_cbs(const unsigned char *pdu, int len)
+{
+	struct cbs cbs;
+	GSList *list;
+	char iso639_lang[3];
+	char *text;
+
+	if (!cbs_decode(pdu, len, &cbs))
+		return FALSE;
+
+	list = g_slist_prepend(NULL, &cbs);
+	text = cbs_decode_text(list, iso639_lang);
+	g_slist_free(list);
+	l_free(text);
+
+	return TRUE;
+}
+
+static gboolean decode_stk(const unsigned char *pdu, int len)
+{
+	struct stk_command *command;
+
+	command = stk_command_new_from_pdu(pdu, len);
+	if (command == NULL)
+		return FALSE;
+
+	stk_command_free(command);
+
+	return TRUE;
+}
+
+/* Walks the BER-TLV of a proactive command and its COMPREHENSION-TLVs */
+static gboolean iterate_stk_tlvs(const unsigned char *pdu, int len)
+{
+	struct ber_tlv_iter iter;
+	struct comprehension_tlv_iter ctlv;
+	unsigned int total = 0;
+
+	ber_tlv_iter_init(&iter, pdu, len);
+
+	if (!ber_tlv_iter_next(&iter))
+		return FALSE;
+
+	ber_tlv_iter_recurse_comprehension(&iter, &ctlv);
+
+	while (comprehension_tlv_iter_next(&ctlv))
+		total += comprehension_tlv_iter_get_length(&ctlv);
+
+	return total > 0;
+}
+
+static gboolean index_stk_tlvs(const unsigned char *pdu, int len)
+{
+	struct tlv_index_entry outer[1];
+	struct tlv_index_entry entries[32];
+	unsigned int total = 0;
+	unsigned int n;
+	unsigned int i;
+
+	if (ber_tlv_index(pdu, len, outer, 1) != 1)
+		return FALSE;
+
+	n = comprehension_tlv_index(pdu + outer[0].offset, outer[0].len,
+					entries, L_ARRAY_SIZE(entries));
+
+	for (i = 0; i < n; i++)
+		total += entries[i].len;
+
+	return total > 0;
+}
+
+#ifdef BENCH_PDU_FUZZER
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	if (size < 3 || size > 512)
+		return 0;
+
+	switch (data[0] % 4) {
+	case 0:
+		decode_sms(data + 2, size - 2, FALSE, data[1]);
+		break;
+	case 1:
+		decode_sms(data + 2, size - 2, TRUE, data[1]);
+		break;
+	case 2:
+		decode_cbs(data + 1, size - 1);
+		break;
+	case 3:
+		decode_stk(data + 1, size - 1);
+		break;
+	}
+
+	return 0;
+}
+
+#else
+
+static unsigned long alloc_count;
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+#define COUNT_ALLOCS
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+/* glib and ell both allocate through the libc, count every call */
+void *malloc(size_t size)
+{
+	alloc_count += 1;
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	alloc_count += 1;
+	return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	alloc_count += 1;
+	return __libc_realloc(ptr, size);
+}
+#endif
+
+struct pdu {
+	unsigned char *data;
+	size_t len;
+	gboolean outgoing;
+	int tpdu_len;
+};
+
+enum bench_decoder {
+	BENCH_SMS,
+	BENCH_CBS,
+	BENCH_STK,
+	BENCH_TLV_ITER,
+	BENCH_TLV_INDEX,
+};
+
+static gboolean bench_decode(enum bench_decoder decoder, const struct pdu *p)
+{
+	switch (decoder) {
+	case BENCH_SMS:
+		return decode_sms(p->data, p->len, p->outgoing, p->tpdu_len);
+	case BENCH_CBS:
+		return decode_cbs(p->data, p->len);
+	case BENCH_STK:
+		return decode_stk(p->data, p->len);
+	case BENCH_TLV_ITER:
+		return iterate_stk_tlvs(p->data, p->len);
+	case BENCH_TLV_INDEX:
+		return index_stk_tlvs(p->data, p->len);
+	}
+
+	return FALSE;
+}
+
+static void bench_run(const char *name, enum bench_decoder decoder,
+			const struct pdu *pdus, unsigned int n_pdus,
+			unsigned int iterations)
+{
+	unsigned long allocs;
+	gint64 start;
+	gint64 elapsed;
+	double total = (double) n_pdus * iterations;
+	unsigned int i;
+	unsigned int j;
+
+	/* Every vector must decode, otherwise the numbers are meaningless */
+	for (j = 0; j < n_pdus; j++) {
+		if (bench_decode(decoder, &pdus[j]))
+			continue;
+
+		fprintf(stderr, "%s: vector %u failed to decode\n", name, j);
+		exit(EXIT_FAILURE);
+	}
+
+	allocs = alloc_count;
+	start = g_get_monotonic_time();
+
+	for (i = 0; i < iterations; i++)
+		for (j = 0; j < n_pdus; j++)
+			bench_decode(decoder, &pdus[j]);
+
+	elapsed = g_get_monotonic_time() - start;
+	allocs = alloc_count - allocs;
+
+#ifdef COUNT_ALLOCS
+	printf("%-26s %4u PDUs %10.1f ns/PDU %8.2f allocs/PDU\n", name,
+			n_pdus, elapsed * 1000.0 / total, allocs / total);
+#else
+	printf("%-26s %4u PDUs %10.1f ns/PDU\n", name, n_pdus,
+			elapsed * 1000.0 / total);
+#endif
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int iterations = 10000;
+	struct pdu sms[L_ARRAY_SIZE(sms_test_pdus)];
+	struct pdu cbs[L_ARRAY_SIZE(cbs_test_pdus)];
+	struct pdu stk[L_ARRAY_SIZE(stk_test_commands)];
+	unsigned int i;
+
+	if (argc > 1)
+		iterations = strtoul(argv[1], NULL, 10);
+
+	if (iterations == 0)
+		iterations = 1;
+
+	for (i = 0; i < L_ARRAY_SIZE(sms_test_pdus); i++) {
+		sms[i].data = l_util_from_hexstring(sms_test_pdus[i].hex,
+							&sms[i].len);
+		sms[i].outgoing = sms_test_pdus[i].outgoing;
+		sms[i].tpdu_len = sms_test_pdus[i].tpdu_len;
+	}
+
+	for (i = 0; i < L_ARRAY_SIZE(cbs_test_pdus); i++)
+		cbs[i].data = l_util_from_hexstring(cbs_test_pdus[i],
+							&cbs[i].len);
+
+	for (i = 0; i < L_ARRAY_SIZE(stk_test_commands); i++) {
+		stk[i].data = l_memdup(stk_test_commands[i].pdu,
+						stk_test_commands[i].len);
+		stk[i].len = stk_test_commands[i].len;
+	}
+
+	bench_run("sms_decode", BENCH_SMS, sms, L_ARRAY_SIZE(sms),
+			iterations);
+	bench_run("cbs_decode", BENCH_CBS, cbs, L_ARRAY_SIZE(cbs),
+			iterations);
+	bench_run("stk_command_new_from_pdu", BENCH_STK, stk,
+			L_ARRAY_SIZE(stk), iterations);
+	bench_run("comprehension_tlv_iter", BENCH_TLV_ITER, stk,
+			L_ARRAY_SIZE(stk), iterations);
+	bench_run("comprehension_tlv_index", BENCH_TLV_INDEX, stk,
+			L_ARRAY_SIZE(stk), iterations);
+
+	for (i = 0; i < L_ARRAY_SIZE(sms); i++)
+		l_free(sms[i].data);
+
+	for (i = 0; i < L_ARRAY_SIZE(cbs); i++)
+		l_free(cbs[i].data);
+
+	for (i = 0; i < L_ARRAY_SIZE(stk); i++)
+		l_free(stk[i].data);
+
+	return 0;
+}
+
+#endif
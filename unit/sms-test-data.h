@@ -0,0 +1,167 @@
+static const char simple_deliver[] =
+	"07911326040000F0040B911346610089F60000208062917314480CC8F71D"
+	"14969741F977FD07";
+
+static const char alnum_sender[] =
+	"0791447758100650040DD0F334FC1CA6970100008080312170224008D4F2"
+	"9CDE0EA7D9";
+
+static const char unicode_deliver[] =
+	"04819999990414D0FBFD7EBFDFEFF77BFE1E0019512090801361807E00DC"
+	"00FC00C400E400D600F600C500E500D800F800C600E600C700E700C900E9"
+	"00CA00EA00DF003100320033003400350036003700380039003000200054"
+	"0068006900730020006D0065007300730061006700650020006900730020"
+	"0036003300200075006E00690063006F0064006500200063006800610072"
+	"0073002E";
+
+static const char simple_submit[] =
+	"0011000B916407281553F80000AA0AE8329BFD4697D9EC37";
+
+static const char simple_mwi[] =
+	"07913366002020F8040B913366600600F100C83180706174148000";
+
+static const char charset_default_pdu[] =
+	"0001000B915310101010100000808080604028180E888462C168381E9088"
+	"6442A9582E988C06C4E9783EA09068442A994EA8946AC56AB95EB0986C46"
+	"ABD96EB89C6EC7EBF97EC0A070482C1A8FC8A472C96C3A9FD0A8744AAD5A"
+	"AFD8AC76CBED7ABFE0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8"
+	"BC7ECFEFFBFF";
+
+static const char charset_default_ext_pdu[] =
+	"0001000B915310101010100000151BC58602DAA036A9CD6BC3DBF436BE0D"
+	"705306";
+
+static const char charset_turkey_pdu[] =
+	"0001000B915310101010100000808080604028180E888462C168381E9088"
+	"6442A9582E988C06C4E9783EA09068442A994EA8946AC56AB95EB0986C46"
+	"ABD96EB89C6EC7EBF97EC0A070482C1A8FC8A472C96C3A9FD0A8744AAD5A"
+	"AFD8AC76CBED7ABFE0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8"
+	"BC7ECFEFFBFF";
+
+static const char charset_turkey_ext_pdu[] =
+	"0001000B9153101010101000001A1BC586B2416D529BD786B7E96D7C1BE0"
+	"02C8011318870E";
+
+static const char charset_portugal_pdu[] =
+	"0001000B915310101010100000808080604028180E888462C168381E9088"
+	"6442A9582E988C06C4E9783EA09068442A994EA8946AC56AB95EB0986C46"
+	"ABD96EB89C6EC7EBF97EC0A070482C1A8FC8A472C96C3A9FD0A8744AAD5A"
+	"AFD8AC76CBED7ABFE0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8"
+	"BC7ECFEFFBFF";
+
+static const char charset_portugal_ext_pdu[] =
+	"0001000B9153101010101000003184C446B160381E1BC96662D9543696CD"
+	"6583D9643C1BD42675D9F0C01B9F8602CC74B75C0EE68030ECF91D";
+
+static const char charset_spain_pdu[] =
+	"0001000B915310101010100000269BC446B1A16C509BD4E6B5E16D7A1BDF"
+	"06B8096E929BE7A6BA096FCA9BF4E6BDA903";
+
+static const char ems_udh_pdu_1[] =
+	"0041000B915121551532F40000631A0A031906200A032104100A03270504"
+	"0A032E05080A043807002B8ACD29A85D9ECFC3E7F21C340EBB41E3B79B1E"
+	"4EBB41697A989D1EB340E2379BCC02B1C3F27399059AB7C36C3628EC2683"
+	"C66FF65B5E2683E8653C1D";
+
+static const char ems_udh_pdu_2[] =
+	"079194712272303351030B915121340195F60000FF80230A030F07230A03"
+	"1806130A031E0A430A032E0D830A033D14020A035104F60A035501060015"
+	"9D9E83D2735018442FCFE98A243DCC4E97C92C90F8CD26B3407537B92C67"
+	"A7DD65320B1476934173BA3CBD2ED3D1F277FD8C76299CEF3B280C92A7CF"
+	"683A28CC4E9FDD6532E8FE96935D";
+
+static const char assembly_pdu1[] =
+	"038121F340048155550119906041001222048C0500031E03010418044204"
+	"30043A002C00200410043B0435043A04410430043D043404400020002004"
+	"41043B044304480430043B00200437043000200434043204350440044C04"
+	"4E0020002004380020002004320441043500200431043E043B044C044804"
+	"350020043F0440043504380441043F043E043B043D044F043B0441044F00"
+	"2000200433043D0435";
+
+static const char assembly_pdu2[] =
+	"038121F340048155550119906041001222048C0500031E03020432043E04"
+	"3C002E000A041D0430043A043E043D04350446002C0020043D0435002004"
+	"32002004410438043B04300445002004340430043B043504350020044204"
+	"350440043F04350442044C002C0020043E043D0020044104420440043504"
+	"3C043804420435043B044C043D043E002004320431043504360430043B00"
+	"2004320020043A043E";
+
+static const char assembly_pdu3[] =
+	"038121F340048155550119906041001222044A0500031E0303043C043D04"
+	"3004420443002C0020043F043E043704300431044B0432000A0434043004"
+	"360435002C002004470442043E002000200431044B043B0020043D043004"
+	"33002E";
+
+static const char expected_no_fragmentation_7bit[] =
+	"079153485002020911000C915348870420140000A71154747A0E4ACF41F4"
+	"F29C9E769F4121";
+
+static const char sr_pdu1[] =
+	"06040D91945152991136F00160124130340A0160124130940A00";
+
+static const char sr_pdu2[] =
+	"06050D91945152991136F00160124130640A0160124130450A00";
+
+static const char sr_pdu3[] =
+	"0606098121436587F9019012413064A0019012413045A000";
+
+static const char wap_push_pdu_1[] =
+	"0791947122725014440185F039F501801140311480720605040B8423F001"
+	"06246170706C69636174696F6E2F766E642E7761702E6D6D732D6D657373"
+	"61676500AF84B4868C82984F67514B4B42008D9089088045726F74696B00"
+	"9650696E2D557073008A808E0240008805810303F48083687474703A2F2F"
+	"657073332E64652F4F2F5A39495A4F00";
+
+static const char cbs1[] =
+	"011000320111C2327BFC76BBCBEE46A3D168341A8D46A3D168341A8D46A3"
+	"D168341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D168"
+	"341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D100";
+
+static const char cbs2[] =
+	"0110003201114679785E96371A8D46A3D168341A8D46A3D168341A8D46A3"
+	"D168341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D168"
+	"341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D100";
+
+static const char cbs3[] =
+	"001000000111E280604028180E888462C168381E90886442A9582E988C66"
+	"C3E9783EA09068442A994EA8946AC56AB95EB0986C46ABD96EB89C6EC7EB"
+	"F97EC0A070482C1A8FC8A472C96C3A9FD0A8744AAD5AAFD8AC76CB05";
+
+struct sms_test_pdu {
+	const char *hex;
+	gboolean outgoing;
+	int tpdu_len;
+};
+
+/* For PDUs without the SMSC address, the TPDU is the whole PDU */
+#define SMS_TEST_TPDU(hex) { hex, FALSE, (sizeof(hex) - 1) / 2 }
+
+/* All of the SMS and CBS PDUs above, for walking the whole corpus */
+static const struct sms_test_pdu sms_test_pdus[] = {
+	{ simple_deliver, FALSE, 30 },
+	{ alnum_sender, FALSE, 27 },
+	{ unicode_deliver, FALSE, 149 },
+	{ simple_submit, TRUE, 23 },
+	{ simple_mwi, FALSE, 19 },
+	SMS_TEST_TPDU(charset_default_pdu),
+	SMS_TEST_TPDU(charset_default_ext_pdu),
+	SMS_TEST_TPDU(charset_turkey_pdu),
+	SMS_TEST_TPDU(charset_turkey_ext_pdu),
+	SMS_TEST_TPDU(charset_portugal_pdu),
+	SMS_TEST_TPDU(charset_portugal_ext_pdu),
+	SMS_TEST_TPDU(charset_spain_pdu),
+	{ ems_udh_pdu_1, TRUE, 100 },
+	{ ems_udh_pdu_2, TRUE, 126 },
+	{ assembly_pdu1, FALSE, 155 },
+	{ assembly_pdu2, FALSE, 155 },
+	{ assembly_pdu3, FALSE, 89 },
+	{ expected_no_fragmentation_7bit, TRUE, 29 },
+	{ sr_pdu1, FALSE, 26 },
+	{ sr_pdu2, FALSE, 26 },
+	{ sr_pdu3, FALSE, 24 },
+	{ wap_push_pdu_1, FALSE, 128 },
+};
+
+static const char *const cbs_test_pdus[] = {
+	cbs1, cbs2, cbs3,
+};
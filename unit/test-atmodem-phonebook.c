@@ -0,0 +1,303 @@
+/*
+ *
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2008-2011  Intel Corporation. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <glib.h>
+
+#include <ofono/modem.h>
+#include <ofono/phonebook.h>
+
+#include "gatchat.h"
+
+#define MAX_ENTRIES 16
+
+/* One command the driver is expected to send and the modem's answer */
+struct pb_step {
+	const char *cmd;
+	const char *rsp;
+};
+
+struct pb_test {
+	const struct pb_step *steps;
+	enum ofono_error_type error_type;
+	int num_entries;
+	const int *entries;
+};
+
+/* Declarations && Re-implementations of core functions. */
+struct ofono_phonebook {
+	void *driver_data;
+	int entries[MAX_ENTRIES];
+	int num_entries;
+};
+
+extern struct ofono_driver_desc __start___phonebook[];
+
+static const struct ofono_phonebook_driver *pbdriver;
+static const struct pb_test *current_test;
+static GIOChannel *modem_io;
+static GString *modem_line;
+static int current_step;
+static GMainLoop *mainloop;
+
+void ofono_phonebook_set_data(struct ofono_phonebook *pb, void *data)
+{
+	pb->driver_data = data;
+}
+
+void *ofono_phonebook_get_data(struct ofono_phonebook *pb)
+{
+	return pb->driver_data;
+}
+
+void ofono_phonebook_entry(struct ofono_phonebook *pb, int index,
+				const char *number, int type,
+				const char *text, int hidden,
+				const char *group,
+				const char *adnumber, int adtype,
+				const char *secondtext, const char *email,
+				const char *sip_uri, const char *tel_uri)
+{
+	g_assert(pb->num_entries < MAX_ENTRIES);
+
+	pb->entries[pb->num_entries++] = index;
+}
+
+void ofono_phonebook_when_ready(struct ofono_phonebook *pb,
+				ofono_phonebook_ready_cb_t cb, void *data,
+				ofono_destroy_func destroy)
+{
+	cb(data);
+}
+
+void ofono_phonebook_remove(struct ofono_phonebook *pb)
+{
+	g_assert_not_reached();
+}
+
+const char *ofono_modem_get_string(struct ofono_modem *modem,
+					const char *key)
+{
+	return NULL;
+}
+
+static void export_cb(const struct ofono_error *error, void *data)
+{
+	struct ofono_phonebook *pb = data;
+	const struct pb_test *test = current_test;
+	int i;
+
+	g_assert(error->type == test->error_type);
+	g_assert(test->steps[current_step].cmd == NULL);
+	g_assert(pb->num_entries == test->num_entries);
+
+	for (i = 0; i < test->num_entries; i++)
+		g_assert(pb->entries[i] == test->entries[i]);
+
+	g_main_loop_quit(mainloop);
+}
+
+void ofono_phonebook_register(struct ofono_phonebook *pb)
+{
+	pbdriver->export_entries(pb, "SM", export_cb, pb);
+}
+
+/* Answers each command with the canned response of the current step */
+static gboolean modem_received(GIOChannel *io, GIOCondition cond,
+							gpointer data)
+{
+	const struct pb_step *step;
+	char buf[256];
+	ssize_t len;
+	ssize_t i;
+
+	if (cond & (G_IO_HUP | G_IO_ERR | G_IO_NVAL))
+		return FALSE;
+
+	len = read(g_io_channel_unix_get_fd(io), buf, sizeof(buf));
+	g_assert(len > 0);
+
+	for (i = 0; i < len; i++) {
+		if (buf[i] != '\r') {
+			g_string_append_c(modem_line, buf[i]);
+			continue;
+		}
+
+		step = &current_test->steps[current_step++];
+
+		g_assert(step->cmd != NULL);
+		g_assert_cmpstr(modem_line->str, ==, step->cmd);
+		g_string_truncate(modem_line, 0);
+
+		g_assert(write(g_io_channel_unix_get_fd(io), step->rsp,
+					strlen(step->rsp)) ==
+				(ssize_t) strlen(step->rsp));
+	}
+
+	return TRUE;
+}
+
+#define PB_PROBE_STEPS \
+	{ "AT+CSCS=?", "\r\n+CSCS: (\"IRA\",\"UCS2\",\"UTF-8\")\r\n" \
+			"\r\nOK\r\n" }, \
+	{ "AT+CPBS=?", "\r\n+CPBS: (\"SM\")\r\n\r\nOK\r\n" }, \
+	{ "AT+CPBS=\"SM\"", "\r\nOK\r\n" }, \
+	{ "AT+CPBR=?", "\r\n+CPBR: (1-10),40,16\r\n\r\nOK\r\n" }, \
+	{ "AT+CSCS?", "\r\n+CSCS: \"UTF-8\"\r\n\r\nOK\r\n" }
+
+#define PB_ENTRY(n) "\r\n+CPBR: " #n ",\"+3581234567" #n "\",145,\"N" #n "\""
+
+/*
+ * The modem gives up half way through the whole range, the rest is read
+ * in windows of half the size
+ */
+static const struct pb_step window_steps[] = {
+	PB_PROBE_STEPS,
+	{ "AT+CPBR=1,10", PB_ENTRY(1) PB_ENTRY(2) "\r\n\r\nERROR\r\n" },
+	{ "AT+CPBR=3,7", PB_ENTRY(3) PB_ENTRY(7) "\r\n\r\nOK\r\n" },
+	{ "AT+CPBR=8,10", PB_ENTRY(9) "\r\n\r\nOK\r\n" },
+	{ }
+};
+
+static const int window_entries[] = { 1, 2, 3, 7, 9 };
+
+static const struct pb_test window_test = {
+	.steps = window_steps,
+	.error_type = OFONO_ERROR_TYPE_NO_ERROR,
+	.num_entries = G_N_ELEMENTS(window_entries),
+	.entries = window_entries,
+};
+
+/* An empty window is reported as not found, which ends nothing */
+static const struct pb_step not_found_steps[] = {
+	PB_PROBE_STEPS,
+	{ "AT+CPBR=1,10", "\r\nERROR\r\n" },
+	{ "AT+CPBR=1,5", "\r\n+CME ERROR: 22\r\n" },
+	{ "AT+CPBR=6,10", PB_ENTRY(6) PB_ENTRY(10) "\r\n\r\nOK\r\n" },
+	{ }
+};
+
+static const int not_found_entries[] = { 6, 10 };
+
+static const struct pb_test not_found_test = {
+	.steps = not_found_steps,
+	.error_type = OFONO_ERROR_TYPE_NO_ERROR,
+	.num_entries = G_N_ELEMENTS(not_found_entries),
+	.entries = not_found_entries,
+};
+
+/* An empty phonebook */
+static const struct pb_step empty_steps[] = {
+	PB_PROBE_STEPS,
+	{ "AT+CPBR=1,10", "\r\n+CME ERROR: 22\r\n" },
+	{ }
+};
+
+static const struct pb_test empty_test = {
+	.steps = empty_steps,
+	.error_type = OFONO_ERROR_TYPE_NO_ERROR,
+};
+
+/* Other errors still fail the export */
+static const struct pb_step failure_steps[] = {
+	PB_PROBE_STEPS,
+	{ "AT+CPBR=1,10", "\r\n+CME ERROR: 100\r\n" },
+	{ "AT+CPBR=1,5", "\r\n+CME ERROR: 100\r\n" },
+	{ "AT+CPBR=1,2", "\r\n+CME ERROR: 100\r\n" },
+	{ "AT+CPBR=1,1", "\r\n+CME ERROR: 100\r\n" },
+	{ }
+};
+
+static const struct pb_test failure_test = {
+	.steps = failure_steps,
+	.error_type = OFONO_ERROR_TYPE_CME,
+};
+
+static void test_export(gconstpointer data)
+{
+	struct ofono_phonebook *pb;
+	GIOChannel *io;
+	GAtSyntax *syntax;
+	GAtChat *chat;
+	guint watch;
+	int fds[2];
+
+	current_test = data;
+	current_step = 0;
+
+	g_assert(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+	io = g_io_channel_unix_new(fds[0]);
+	g_io_channel_set_close_on_unref(io, TRUE);
+	syntax = g_at_syntax_new_gsm_permissive();
+	chat = g_at_chat_new(io, syntax);
+	g_at_syntax_unref(syntax);
+	g_io_channel_unref(io);
+	g_assert(chat != NULL);
+
+	modem_line = g_string_new(NULL);
+	modem_io = g_io_channel_unix_new(fds[1]);
+	g_io_channel_set_close_on_unref(modem_io, TRUE);
+	watch = g_io_add_watch(modem_io, G_IO_IN | G_IO_HUP | G_IO_ERR |
+					G_IO_NVAL, modem_received, NULL);
+
+	mainloop = g_main_loop_new(NULL, FALSE);
+
+	pbdriver = __start___phonebook[0].driver;
+	pb = g_new0(struct ofono_phonebook, 1);
+	g_assert(pbdriver->probe(pb, 0, chat) == 0);
+
+	g_main_loop_run(mainloop);
+
+	pbdriver->remove(pb);
+	g_free(pb);
+	g_at_chat_unref(chat);
+
+	g_main_loop_unref(mainloop);
+	g_source_remove(watch);
+	g_io_channel_shutdown(modem_io, FALSE, NULL);
+	g_io_channel_unref(modem_io);
+	g_string_free(modem_line, TRUE);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, NULL);
+
+	g_test_add_data_func("/testatmodemphonebook/window", &window_test,
+				test_export);
+	g_test_add_data_func("/testatmodemphonebook/not found",
+				&not_found_test, test_export);
+	g_test_add_data_func("/testatmodemphonebook/empty", &empty_test,
+				test_export);
+	g_test_add_data_func("/testatmodemphonebook/failure", &failure_test,
+				test_export);
+
+	return g_test_run();
+}
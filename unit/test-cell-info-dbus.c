@@ -33,6 +33,7 @@
 #define CELL_INFO_DBUS_INTERFACE            "org.nemomobile.ofono.CellInfo"
 #define CELL_INFO_DBUS_CELLS_ADDED_SIGNAL   "CellsAdded"
 #define CELL_INFO_DBUS_CELLS_REMOVED_SIGNAL "CellsRemoved"
+#define CELL_INFO_DBUS_CELLS_CHANGED_SIGNAL "CellsChanged"
 #define CELL_INFO_DBUS_UNSUBSCRIBED_SIGNAL  "Unsubscribed"
 
 #define CELL_DBUS_INTERFACE_VERSION         (1)
@@ -1041,6 +1042,164 @@ static void test_property_changed(void)
 	}
 }
 
+/* ==== CellsChanged ==== */
+
+struct test_cells_changed_data {
+	struct ofono_modem modem;
+	struct test_dbus_context context;
+	struct cell_info_dbus *dbus;
+	struct ofono_cell cell;
+	CellInfoControl *ctl;
+	const char *type;
+	const char *cell_path;
+};
+
+static void test_check_cells_changed_signal(DBusMessage *signal,
+			const char *path, const struct ofono_cell *cell)
+{
+	DBusMessageIter it, array, st, dict;
+	gboolean registered_found = FALSE;
+	gboolean strength_found = FALSE;
+
+	dbus_message_iter_init(signal, &it);
+	g_assert(dbus_message_iter_get_arg_type(&it) == DBUS_TYPE_ARRAY);
+	dbus_message_iter_recurse(&it, &array);
+	dbus_message_iter_next(&it);
+	g_assert(dbus_message_iter_get_arg_type(&it) == DBUS_TYPE_INVALID);
+
+	/* Exactly one cell has changed */
+	g_assert(dbus_message_iter_get_arg_type(&array) == DBUS_TYPE_STRUCT);
+	dbus_message_iter_recurse(&array, &st);
+	dbus_message_iter_next(&array);
+	g_assert(dbus_message_iter_get_arg_type(&array) == DBUS_TYPE_INVALID);
+
+	g_assert(!g_strcmp0(test_dbus_get_object_path(&st), path));
+	g_assert(dbus_message_iter_get_arg_type(&st) == DBUS_TYPE_ARRAY);
+	dbus_message_iter_recurse(&st, &dict);
+	dbus_message_iter_next(&st);
+	g_assert(dbus_message_iter_get_arg_type(&st) == DBUS_TYPE_INVALID);
+
+	/* Only the changed properties are there */
+	while (dbus_message_iter_get_arg_type(&dict) == DBUS_TYPE_DICT_ENTRY) {
+		DBusMessageIter entry, var;
+		const char *name;
+
+		dbus_message_iter_recurse(&dict, &entry);
+		name = test_dbus_get_string(&entry);
+		g_assert(dbus_message_iter_get_arg_type(&entry) ==
+							DBUS_TYPE_VARIANT);
+		dbus_message_iter_recurse(&entry, &var);
+		if (!g_strcmp0(name, "registered")) {
+			g_assert(test_dbus_get_bool(&var) ==
+						(cell->registered != FALSE));
+			registered_found = TRUE;
+		} else if (!g_strcmp0(name, "signalStrength")) {
+			g_assert(test_dbus_get_int32(&var) ==
+					cell->info.gsm.signalStrength);
+			strength_found = TRUE;
+		} else {
+			g_assert(!"Unexpected property");
+		}
+		dbus_message_iter_next(&dict);
+	}
+
+	g_assert(registered_found);
+	g_assert(strength_found);
+}
+
+static void test_cells_changed_reply2(DBusPendingCall *call, void *data)
+{
+	struct test_cells_changed_data *test = data;
+
+	DBG("");
+	test_check_get_all_reply(call, &test->cell, test->type);
+	dbus_pending_call_unref(call);
+
+	test_loop_quit_later(test->context.loop);
+	test_dbus_watch_disconnect_all();
+}
+
+static void test_cells_changed_reply1(DBusPendingCall *call, void *data)
+{
+	struct test_cells_changed_data *test = data;
+	struct ofono_cell_info *info = test->ctl->info;
+	struct ofono_cell *first_cell;
+
+	DBG("");
+	test_check_get_cells_reply(call, test->cell_path, NULL);
+	dbus_pending_call_unref(call);
+
+	/* Change two properties at once */
+	first_cell = info->cells[0];
+	test->cell.info.gsm.signalStrength =
+		(++(first_cell->info.gsm.signalStrength));
+	test->cell.registered = first_cell->registered =
+		!first_cell->registered;
+	fake_cell_info_cells_changed(info);
+
+	test_submit_get_all_call(test->context.client_connection,
+			test->cell_path, test_cells_changed_reply2, test);
+}
+
+static void test_cells_changed_start(struct test_dbus_context *context)
+{
+	struct ofono_cell_info *info = fake_cell_info_new();
+	struct test_cells_changed_data *test =
+		G_CAST(context, struct test_cells_changed_data, context);
+
+	DBG("");
+	fake_cell_info_add_cell(info, &test->cell);
+	test->ctl = cell_info_control_get(test->modem.path);
+	cell_info_control_set_cell_info(test->ctl, info);
+
+	test->dbus = cell_info_dbus_new(&test->modem, test->ctl);
+	g_assert(test->dbus);
+	ofono_cell_info_unref(info);
+
+	/* Submit GetCellsBatched to enable "CellsChanged" signals */
+	test_submit_cell_info_call(test->context.client_connection,
+		"GetCellsBatched", test_cells_changed_reply1, test);
+}
+
+static void test_cells_changed(void)
+{
+	struct test_cells_changed_data test;
+	guint timeout = test_setup_timeout();
+	DBusMessage *signal;
+
+	memset(&test, 0, sizeof(test));
+	test.modem.path = TEST_MODEM_PATH;
+	test.context.start = test_cells_changed_start;
+	test_cell_init_gsm1(&test.cell);
+	test.type = "gsm";
+	test.cell_path = "/test/cell_0";
+	test_dbus_setup(&test.context);
+
+	g_main_loop_run(test.context.loop);
+
+	/* We must have received one "CellsChanged" signal */
+	signal = test_dbus_take_signal(&test.context, test.modem.path,
+		CELL_INFO_DBUS_INTERFACE, CELL_INFO_DBUS_CELLS_CHANGED_SIGNAL);
+	g_assert(signal);
+	test_check_cells_changed_signal(signal, test.cell_path, &test.cell);
+	dbus_message_unref(signal);
+	g_assert(!test_dbus_find_signal(&test.context, test.modem.path,
+		CELL_INFO_DBUS_INTERFACE, CELL_INFO_DBUS_CELLS_CHANGED_SIGNAL));
+
+	/* And no per-property signals */
+	g_assert(!test_dbus_find_signal(&test.context, test.cell_path,
+		CELL_DBUS_INTERFACE, CELL_DBUS_PROPERTY_CHANGED_SIGNAL));
+	g_assert(!test_dbus_find_signal(&test.context, test.cell_path,
+		CELL_DBUS_INTERFACE, CELL_DBUS_REGISTERED_CHANGED_SIGNAL));
+
+	cell_info_control_unref(test.ctl);
+	cell_info_dbus_free(test.dbus);
+	test_dbus_shutdown(&test.context);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
 /* ==== Unsubscribe ==== */
 
 struct test_unsubscribe_data {
@@ -1181,6 +1340,7 @@ int main(int argc, char *argv[])
 	g_test_add_func(TEST_("GetProperties"), test_get_properties);
 	g_test_add_func(TEST_("RegisteredChanged"), test_registered_changed);
 	g_test_add_func(TEST_("PropertyChanged"), test_property_changed);
+	g_test_add_func(TEST_("CellsChanged"), test_cells_changed);
 	g_test_add_func(TEST_("Unsubscribe"), test_unsubscribe);
 
 	return g_test_run();
@@ -0,0 +1,404 @@
+/*
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2021 Jolla Ltd. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ */
+
+#include "test-dbus.h"
+
+#include <ofono/dbus.h>
+#include <ofono/log.h>
+#include "ofono.h"
+
+#include <gutil_log.h>
+#include <gutil_macros.h>
+
+#define TEST_TIMEOUT                    (10)   /* seconds */
+
+#define TEST_DBUS_PATH                  "/test"
+#define TEST_DBUS_INTERFACE             "test.interface"
+#define TEST_PROPERTY_CHANGED_SIGNAL    "PropertyChanged"
+#define TEST_PROPERTIES_CHANGED_SIGNAL  "PropertiesChanged"
+
+struct test_data {
+	struct test_dbus_context dbus;
+	int count;
+	int expected;
+};
+
+static gboolean test_debug;
+
+/* ==== dummy interface ==== */
+
+static DBusMessage *test_dummy_handler(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	g_assert_not_reached();
+	return NULL;
+}
+
+static const GDBusMethodTable test_dummy_methods[] = {
+	{ GDBUS_ASYNC_METHOD("Dummy", NULL, NULL, test_dummy_handler) },
+	{ }
+};
+
+static const GDBusSignalTable test_property_change_signals[] = {
+	{ GDBUS_SIGNAL(TEST_PROPERTY_CHANGED_SIGNAL,
+			GDBUS_ARGS({ "name", "s" }, { "value", "v" })) },
+	{ GDBUS_SIGNAL(TEST_PROPERTIES_CHANGED_SIGNAL,
+			GDBUS_ARGS({ "properties", "a{sv}" })) },
+	{ }
+};
+
+static void test_register_interface(void)
+{
+	g_assert(g_dbus_register_interface(ofono_dbus_get_connection(),
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE,
+				test_dummy_methods,
+				test_property_change_signals,
+				NULL, NULL, NULL));
+}
+
+/* ==== common ==== */
+
+static gboolean test_timeout(gpointer param)
+{
+	g_assert(!"TIMEOUT");
+	return G_SOURCE_REMOVE;
+}
+
+static guint test_setup_timeout(void)
+{
+	if (test_debug) {
+		return 0;
+	} else {
+		return g_timeout_add_seconds(TEST_TIMEOUT, test_timeout, NULL);
+	}
+}
+
+static gboolean test_loop_quit(gpointer data)
+{
+	g_main_loop_quit(data);
+	return G_SOURCE_REMOVE;
+}
+
+static void test_loop_quit_later(GMainLoop *loop)
+{
+	g_idle_add(test_loop_quit, loop);
+}
+
+static void test_count_signal(struct test_dbus_context *dbus, DBusMessage *msg)
+{
+	struct test_data *test = G_CAST(dbus, struct test_data, dbus);
+
+	g_assert_cmpstr(dbus_message_get_path(msg), == ,TEST_DBUS_PATH);
+	g_assert_cmpstr(dbus_message_get_interface(msg), == ,
+						TEST_DBUS_INTERFACE);
+	test->count++;
+	if (test->count == test->expected) {
+		test_loop_quit_later(dbus->loop);
+	}
+}
+
+static void test_run(struct test_data *test,
+		void (*start)(struct test_dbus_context *dbus), int expected)
+{
+	guint timeout = test_setup_timeout();
+
+	memset(test, 0, sizeof(*test));
+	test->expected = expected;
+	test_dbus_setup(&test->dbus);
+	test->dbus.start = start;
+	test->dbus.handle_signal = test_count_signal;
+
+	g_main_loop_run(test->dbus.loop);
+	g_assert_cmpint(test->count, == ,expected);
+
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
+static void test_emit(struct ofono_dbus_property_batch *batch,
+			const char *name, int type, const void *value)
+{
+	if (batch) {
+		__ofono_dbus_property_batch_changed(batch,
+				ofono_dbus_get_connection(), name, type, value);
+	} else {
+		ofono_dbus_signal_property_changed(ofono_dbus_get_connection(),
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE, name,
+				type, value);
+	}
+}
+
+static void test_emit_string(struct ofono_dbus_property_batch *batch,
+				const char *name, const char *value)
+{
+	test_emit(batch, name, DBUS_TYPE_STRING, &value);
+}
+
+static void test_emit_byte(struct ofono_dbus_property_batch *batch,
+				const char *name, unsigned char value)
+{
+	test_emit(batch, name, DBUS_TYPE_BYTE, &value);
+}
+
+/* Registration update as emitted by network.c */
+static void test_emit_registration_update(
+				struct ofono_dbus_property_batch *batch)
+{
+	dbus_uint16_t lac = 9007;
+	dbus_uint32_t ci = 42335;
+
+	test_emit_string(batch, "Status", "registered");
+	test_emit(batch, "LocationAreaCode", DBUS_TYPE_UINT16, &lac);
+	test_emit(batch, "CellId", DBUS_TYPE_UINT32, &ci);
+	test_emit_string(batch, "Technology", "lte");
+	test_emit_byte(batch, "Strength", 50);
+	test_emit_byte(batch, "Strength", 60);
+}
+
+static int test_count_signals(struct test_data *test, const char *member)
+{
+	GSList *l;
+	int n = 0;
+
+	for (l = test->dbus.client_signals; l; l = l->next) {
+		if (dbus_message_is_signal(l->data, TEST_DBUS_INTERFACE,
+								member)) {
+			n++;
+		}
+	}
+	return n;
+}
+
+static const char *test_signal_property_name(DBusMessage *msg)
+{
+	DBusMessageIter it;
+
+	g_assert(dbus_message_is_signal(msg, TEST_DBUS_INTERFACE,
+					TEST_PROPERTY_CHANGED_SIGNAL));
+	dbus_message_iter_init(msg, &it);
+	return test_dbus_get_string(&it);
+}
+
+static DBusMessage *test_nth_signal(struct test_data *test, int n)
+{
+	DBusMessage *msg = g_slist_nth_data(test->dbus.client_signals, n);
+
+	g_assert(msg);
+	return msg;
+}
+
+/* ==== null ==== */
+
+static void test_null(void)
+{
+	/* We are NULL tolerant: */
+	g_assert(!__ofono_dbus_property_batch_new(NULL, NULL));
+	g_assert(!__ofono_dbus_property_batch_new(TEST_DBUS_PATH, NULL));
+	__ofono_dbus_property_batch_flush(NULL);
+	__ofono_dbus_property_batch_free(NULL);
+}
+
+/* ==== immediate ==== */
+
+static void test_immediate_start(struct test_dbus_context *dbus)
+{
+	test_register_interface();
+	test_emit_registration_update(NULL);
+}
+
+static void test_immediate(void)
+{
+	struct test_data test;
+
+	/* Without batching, each change is a separate signal */
+	test_run(&test, test_immediate_start, 6);
+	g_assert_cmpint(test_count_signals(&test,
+				TEST_PROPERTY_CHANGED_SIGNAL), == ,6);
+	g_assert_cmpint(test_count_signals(&test,
+				TEST_PROPERTIES_CHANGED_SIGNAL), == ,0);
+	test_dbus_shutdown(&test.dbus);
+}
+
+/* ==== coalesce ==== */
+
+static struct ofono_dbus_property_batch *test_batch;
+
+static void test_coalesce_start(struct test_dbus_context *dbus)
+{
+	test_register_interface();
+	test_batch = __ofono_dbus_property_batch_new(TEST_DBUS_PATH,
+						TEST_DBUS_INTERFACE);
+	test_emit_registration_update(test_batch);
+}
+
+static void test_coalesce(void)
+{
+	struct test_data test;
+	DBusMessage *msg;
+	DBusMessageIter it, dict, entry, var;
+	const char *name;
+	int n = 0;
+
+	/* All 6 PropertyChanged as they happen plus one PropertiesChanged */
+	test_run(&test, test_coalesce_start, 7);
+	g_assert_cmpint(test_count_signals(&test,
+				TEST_PROPERTY_CHANGED_SIGNAL), == ,6);
+	g_assert_cmpint(test_count_signals(&test,
+				TEST_PROPERTIES_CHANGED_SIGNAL), == ,1);
+
+	/* Legacy signals are neither reordered nor deduplicated */
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 0)),
+							== ,"Status");
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 4)),
+							== ,"Strength");
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 5)),
+							== ,"Strength");
+
+	/* The dictionary comes last and has the latest values */
+	msg = test_nth_signal(&test, 6);
+	g_assert(dbus_message_is_signal(msg, TEST_DBUS_INTERFACE,
+					TEST_PROPERTIES_CHANGED_SIGNAL));
+	dbus_message_iter_init(msg, &it);
+	g_assert(dbus_message_iter_get_arg_type(&it) == DBUS_TYPE_ARRAY);
+	dbus_message_iter_recurse(&it, &dict);
+	while (dbus_message_iter_get_arg_type(&dict) == DBUS_TYPE_DICT_ENTRY) {
+		dbus_message_iter_recurse(&dict, &entry);
+		name = test_dbus_get_string(&entry);
+		dbus_message_iter_recurse(&entry, &var);
+		if (!strcmp(name, "Strength")) {
+			unsigned char strength;
+
+			g_assert(dbus_message_iter_get_arg_type(&var) ==
+							DBUS_TYPE_BYTE);
+			dbus_message_iter_get_basic(&var, &strength);
+			g_assert_cmpuint(strength, == ,60);
+		} else if (!strcmp(name, "Technology")) {
+			g_assert_cmpstr(test_dbus_get_string(&var), == ,"lte");
+		}
+		dbus_message_iter_next(&dict);
+		n++;
+	}
+	g_assert_cmpint(n, == ,5);
+
+	__ofono_dbus_property_batch_free(test_batch);
+	test_batch = NULL;
+	test_dbus_shutdown(&test.dbus);
+}
+
+/* ==== free ==== */
+
+static void test_free_start(struct test_dbus_context *dbus)
+{
+	test_register_interface();
+	test_batch = __ofono_dbus_property_batch_new(TEST_DBUS_PATH,
+						TEST_DBUS_INTERFACE);
+	test_emit_string(test_batch, "Status", "searching");
+	test_emit_string(test_batch, "Name", "test");
+
+	/* Freeing flushes the pending changes */
+	__ofono_dbus_property_batch_free(test_batch);
+	test_batch = NULL;
+	test_emit_string(NULL, "Status", "registered");
+}
+
+static void test_free(void)
+{
+	struct test_data test;
+
+	test_run(&test, test_free_start, 4);
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 1)),
+							== ,"Name");
+	g_assert(dbus_message_is_signal(test_nth_signal(&test, 2),
+		TEST_DBUS_INTERFACE, TEST_PROPERTIES_CHANGED_SIGNAL));
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 3)),
+							== ,"Status");
+	test_dbus_shutdown(&test.dbus);
+}
+
+/* ==== array ==== */
+
+static void test_array_start(struct test_dbus_context *dbus)
+{
+	const char *values[] = { "a", "b", NULL };
+	const char **array = values;
+
+	test_register_interface();
+	test_batch = __ofono_dbus_property_batch_new(TEST_DBUS_PATH,
+						TEST_DBUS_INTERFACE);
+	test_emit_string(test_batch, "Status", "registered");
+
+	/* Array properties aren't batched and aren't held back either */
+	ofono_dbus_signal_array_property_changed(ofono_dbus_get_connection(),
+			TEST_DBUS_PATH, TEST_DBUS_INTERFACE, "Array",
+			DBUS_TYPE_STRING, &array);
+}
+
+static void test_array(void)
+{
+	struct test_data test;
+
+	test_run(&test, test_array_start, 3);
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 0)),
+							== ,"Status");
+	g_assert_cmpstr(test_signal_property_name(test_nth_signal(&test, 1)),
+							== ,"Array");
+	g_assert(dbus_message_is_signal(test_nth_signal(&test, 2),
+		TEST_DBUS_INTERFACE, TEST_PROPERTIES_CHANGED_SIGNAL));
+
+	__ofono_dbus_property_batch_free(test_batch);
+	test_batch = NULL;
+	test_dbus_shutdown(&test.dbus);
+}
+
+#define TEST_(name) "/dbus-batch/" name
+
+int main(int argc, char *argv[])
+{
+	int i;
+
+	g_test_init(&argc, &argv, NULL);
+	for (i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		if (!strcmp(arg, "-d") || !strcmp(arg, "--debug")) {
+			test_debug = TRUE;
+		} else {
+			GWARN("Unsupported command line option %s", arg);
+		}
+	}
+
+	gutil_log_timestamp = FALSE;
+	gutil_log_default.level = g_test_verbose() ?
+		GLOG_LEVEL_VERBOSE : GLOG_LEVEL_NONE;
+	__ofono_log_init("test-dbus-batch",
+				g_test_verbose() ? "*" : NULL,
+				FALSE);
+
+	g_test_add_func(TEST_("null"), test_null);
+	g_test_add_func(TEST_("immediate"), test_immediate);
+	g_test_add_func(TEST_("coalesce"), test_coalesce);
+	g_test_add_func(TEST_("free"), test_free);
+	g_test_add_func(TEST_("array"), test_array);
+
+	return g_test_run();
+}
+
+/*
+ * Local Variables:
+ * mode: C
+ * c-basic-offset: 8
+ * indent-tabs-mode: t
+ * End:
+ */
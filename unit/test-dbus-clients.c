@@ -35,12 +35,25 @@
 #define TEST_PROPERTY_NAME              "Test"
 #define TEST_PROPERTY_VALUE             "test"
 
+#define TEST_FANOUT_CLIENTS             (50)
+#define TEST_FANOUT_ROUNDS              (100)
+
 struct test_data {
 	struct test_dbus_context dbus;
 	struct ofono_dbus_clients *clients;
 	int count;
 };
 
+struct test_fanout_data {
+	struct test_dbus_context dbus;
+	struct ofono_dbus_clients *clients;
+	int count;
+	int expected;
+	gint64 start;
+	gint64 send_time;
+	gint64 total_time;
+};
+
 static gboolean test_debug;
 
 /* ==== dummy interface ==== */
@@ -241,6 +254,78 @@ static void test_signal(void)
 	}
 }
 
+/* ==== fanout ==== */
+
+static void test_fanout_handle(struct test_dbus_context *dbus,
+							DBusMessage *msg)
+{
+	struct test_fanout_data *test =
+		G_CAST(dbus, struct test_fanout_data, dbus);
+
+	g_assert_cmpstr(dbus_message_get_member(msg), == ,
+						TEST_PROPERTY_CHANGED_SIGNAL);
+	g_assert(dbus_message_get_destination(msg));
+	test->count++;
+	if (test->count == test->expected) {
+		test->total_time = g_get_monotonic_time() - test->start;
+		test_loop_quit_later(dbus->loop);
+	}
+}
+
+static void test_fanout_start(struct test_dbus_context *dbus)
+{
+	struct test_fanout_data *test =
+		G_CAST(dbus, struct test_fanout_data, dbus);
+	const char *value = TEST_PROPERTY_VALUE;
+	int i;
+
+	test_register_dummy_interface();
+	test->clients = ofono_dbus_clients_new(ofono_dbus_get_connection(),
+								NULL, NULL);
+
+	for (i = 0; i < TEST_FANOUT_CLIENTS; i++) {
+		char *name = g_strdup_printf(":1.%d", i);
+
+		g_assert(ofono_dbus_clients_add(test->clients, name));
+		g_free(name);
+	}
+
+	test->start = g_get_monotonic_time();
+	for (i = 0; i < TEST_FANOUT_ROUNDS; i++) {
+		ofono_dbus_clients_signal_property_changed(test->clients,
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE,
+				TEST_PROPERTY_NAME, DBUS_TYPE_STRING, &value);
+	}
+	test->send_time = g_get_monotonic_time() - test->start;
+	/* And wait for all signals to arrive */
+}
+
+static void test_fanout(void)
+{
+	struct test_fanout_data test;
+	guint timeout = test_setup_timeout();
+
+	memset(&test, 0, sizeof(test));
+	test.expected = TEST_FANOUT_ROUNDS * TEST_FANOUT_CLIENTS;
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_fanout_start;
+	test.dbus.handle_signal = test_fanout_handle;
+
+	g_main_loop_run(test.dbus.loop);
+
+	g_assert_cmpint(test.count, == ,test.expected);
+	g_test_message("%d subscribers, %d signals, %d messages, "
+		"send %.3f ms, delivery %.3f ms", TEST_FANOUT_CLIENTS,
+		TEST_FANOUT_ROUNDS, test.count, test.send_time / 1000.0,
+		test.total_time / 1000.0);
+
+	ofono_dbus_clients_free(test.clients);
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
 #define TEST_(name) "/dbus-clients/" name
 
 int main(int argc, char *argv[])
@@ -267,6 +352,7 @@ int main(int argc, char *argv[])
 	g_test_add_func(TEST_("null"), test_null);
 	g_test_add_func(TEST_("basic"), test_basic);
 	g_test_add_func(TEST_("signal"), test_signal);
+	g_test_add_func(TEST_("fanout"), test_fanout);
 
 	return g_test_run();
 }
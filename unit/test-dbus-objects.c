@@ -0,0 +1,268 @@
+/*
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2021 Jolla Ltd. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ */
+
+#include "test-dbus.h"
+
+#include <ofono/dbus.h>
+#include <ofono/log.h>
+#include "ofono.h"
+
+#include <gutil_log.h>
+#include <gutil_macros.h>
+
+#define TEST_TIMEOUT                    (10)   /* seconds */
+
+#define TEST_ROOT_PATH                  "/"
+#define TEST_ROOT_INTERFACE             "test.manager"
+#define TEST_GET_OBJECTS                "GetManagedObjects"
+#define TEST_DBUS_PATH                  "/test"
+#define TEST_DBUS_INTERFACE             "test.interface"
+#define TEST_GET_PROPERTIES             "GetProperties"
+
+/* Values that don't survive being copied through a pointer on 32-bit */
+#define TEST_INT64                      DBUS_INT64_CONSTANT(-0x123456789abc)
+#define TEST_UINT64                     DBUS_UINT64_CONSTANT(0xfedcba987654)
+#define TEST_DOUBLE                     (-1234.5625)
+#define TEST_STRING                     "test"
+
+struct test_data {
+	struct test_dbus_context dbus;
+	gboolean done;
+};
+
+static gboolean test_debug;
+
+/* ==== common ==== */
+
+static gboolean test_timeout(gpointer param)
+{
+	g_assert(!"TIMEOUT");
+	return G_SOURCE_REMOVE;
+}
+
+static guint test_setup_timeout(void)
+{
+	if (test_debug) {
+		return 0;
+	} else {
+		return g_timeout_add_seconds(TEST_TIMEOUT, test_timeout, NULL);
+	}
+}
+
+/* ==== objects ==== */
+
+static DBusMessage *test_get_objects(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	return g_dbus_get_managed_objects(conn, msg);
+}
+
+static DBusMessage *test_get_properties(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	DBusMessage *reply = dbus_message_new_method_return(msg);
+	DBusMessageIter it, dict;
+	dbus_int64_t i64 = TEST_INT64;
+	dbus_uint64_t u64 = TEST_UINT64;
+	double d = TEST_DOUBLE;
+	const char *str = TEST_STRING;
+
+	dbus_message_iter_init_append(reply, &it);
+	dbus_message_iter_open_container(&it, DBUS_TYPE_ARRAY,
+					OFONO_PROPERTIES_ARRAY_SIGNATURE,
+					&dict);
+	ofono_dbus_dict_append(&dict, "Int64", DBUS_TYPE_INT64, &i64);
+	ofono_dbus_dict_append(&dict, "UInt64", DBUS_TYPE_UINT64, &u64);
+	ofono_dbus_dict_append(&dict, "Double", DBUS_TYPE_DOUBLE, &d);
+	ofono_dbus_dict_append(&dict, "String", DBUS_TYPE_STRING, &str);
+	dbus_message_iter_close_container(&it, &dict);
+
+	return reply;
+}
+
+static const GDBusMethodTable test_root_methods[] = {
+	{ GDBUS_METHOD(TEST_GET_OBJECTS, NULL,
+			GDBUS_ARGS({ "objects", "a{oa{sa{sv}}}" }),
+			test_get_objects) },
+	{ }
+};
+
+static const GDBusMethodTable test_methods[] = {
+	{ GDBUS_METHOD(TEST_GET_PROPERTIES, NULL,
+			GDBUS_ARGS({ "properties", "a{sv}" }),
+			test_get_properties) },
+	{ }
+};
+
+static void test_check_properties(DBusMessageIter *dict)
+{
+	DBusMessageIter entry, var;
+	dbus_int64_t i64;
+	dbus_uint64_t u64;
+	double d;
+
+	dbus_message_iter_recurse(dict, &entry);
+	g_assert_cmpstr(test_dbus_get_string(&entry), == ,"Int64");
+	dbus_message_iter_recurse(&entry, &var);
+	g_assert_cmpint(dbus_message_iter_get_arg_type(&var), == ,
+							DBUS_TYPE_INT64);
+	dbus_message_iter_get_basic(&var, &i64);
+	g_assert(i64 == TEST_INT64);
+	g_assert(dbus_message_iter_next(dict));
+
+	dbus_message_iter_recurse(dict, &entry);
+	g_assert_cmpstr(test_dbus_get_string(&entry), == ,"UInt64");
+	dbus_message_iter_recurse(&entry, &var);
+	g_assert_cmpint(dbus_message_iter_get_arg_type(&var), == ,
+							DBUS_TYPE_UINT64);
+	dbus_message_iter_get_basic(&var, &u64);
+	g_assert(u64 == TEST_UINT64);
+	g_assert(dbus_message_iter_next(dict));
+
+	dbus_message_iter_recurse(dict, &entry);
+	g_assert_cmpstr(test_dbus_get_string(&entry), == ,"Double");
+	dbus_message_iter_recurse(&entry, &var);
+	g_assert_cmpint(dbus_message_iter_get_arg_type(&var), == ,
+							DBUS_TYPE_DOUBLE);
+	dbus_message_iter_get_basic(&var, &d);
+	g_assert(d == TEST_DOUBLE);
+	g_assert(dbus_message_iter_next(dict));
+
+	dbus_message_iter_recurse(dict, &entry);
+	g_assert_cmpstr(test_dbus_get_string(&entry), == ,"String");
+	dbus_message_iter_recurse(&entry, &var);
+	g_assert_cmpstr(test_dbus_get_string(&var), == ,TEST_STRING);
+	g_assert(!dbus_message_iter_next(dict));
+}
+
+static void test_objects_reply(DBusPendingCall *call, void *data)
+{
+	struct test_data *test = data;
+	DBusMessage *reply = dbus_pending_call_steal_reply(call);
+	DBusMessageIter it, objects, object, ifaces, iface, dict;
+	gboolean found = FALSE;
+
+	g_assert_cmpint(dbus_message_get_type(reply), == ,
+					DBUS_MESSAGE_TYPE_METHOD_RETURN);
+	g_assert_cmpstr(dbus_message_get_signature(reply), == ,
+							"a{oa{sa{sv}}}");
+
+	dbus_message_iter_init(reply, &it);
+	dbus_message_iter_recurse(&it, &objects);
+	dbus_message_iter_recurse(&objects, &object);
+	g_assert_cmpstr(test_dbus_get_object_path(&object), == ,
+							TEST_DBUS_PATH);
+	g_assert(!dbus_message_iter_next(&objects));
+
+	dbus_message_iter_recurse(&object, &ifaces);
+	while (dbus_message_iter_get_arg_type(&ifaces) ==
+						DBUS_TYPE_DICT_ENTRY) {
+		dbus_message_iter_recurse(&ifaces, &iface);
+		if (!g_strcmp0(test_dbus_get_string(&iface),
+						TEST_DBUS_INTERFACE)) {
+			dbus_message_iter_recurse(&iface, &dict);
+			test_check_properties(&dict);
+			found = TRUE;
+		}
+		dbus_message_iter_next(&ifaces);
+	}
+
+	g_assert(found);
+	dbus_message_unref(reply);
+	dbus_pending_call_unref(call);
+
+	test->done = TRUE;
+	g_main_loop_quit(test->dbus.loop);
+}
+
+static void test_objects_start(struct test_dbus_context *dbus)
+{
+	struct test_data *test = G_CAST(dbus, struct test_data, dbus);
+	DBusConnection *conn = ofono_dbus_get_connection();
+	DBusPendingCall *call;
+	DBusMessage *msg;
+
+	g_assert(g_dbus_register_interface(conn, TEST_ROOT_PATH,
+				TEST_ROOT_INTERFACE, test_root_methods,
+				NULL, NULL, test, NULL));
+	g_assert(g_dbus_register_interface(conn, TEST_DBUS_PATH,
+				TEST_DBUS_INTERFACE, test_methods,
+				NULL, NULL, test, NULL));
+
+	msg = dbus_message_new_method_call(NULL, TEST_ROOT_PATH,
+					TEST_ROOT_INTERFACE, TEST_GET_OBJECTS);
+	g_assert(dbus_connection_send_with_reply(dbus->client_connection,
+					msg, &call, DBUS_TIMEOUT_INFINITE));
+	dbus_pending_call_set_notify(call, test_objects_reply, test, NULL);
+	dbus_message_unref(msg);
+}
+
+static void test_objects(void)
+{
+	struct test_data test;
+	guint timeout = test_setup_timeout();
+
+	memset(&test, 0, sizeof(test));
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_objects_start;
+
+	g_main_loop_run(test.dbus.loop);
+	g_assert(test.done);
+
+	g_dbus_unregister_interface(ofono_dbus_get_connection(),
+					TEST_DBUS_PATH, TEST_DBUS_INTERFACE);
+	g_dbus_unregister_interface(ofono_dbus_get_connection(),
+					TEST_ROOT_PATH, TEST_ROOT_INTERFACE);
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
+#define TEST_(name) "/dbus-objects/" name
+
+int main(int argc, char *argv[])
+{
+	int i;
+
+	g_test_init(&argc, &argv, NULL);
+	for (i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		if (!strcmp(arg, "-d") || !strcmp(arg, "--debug")) {
+			test_debug = TRUE;
+		} else {
+			GWARN("Unsupported command line option %s", arg);
+		}
+	}
+
+	gutil_log_timestamp = FALSE;
+	gutil_log_default.level = g_test_verbose() ?
+		GLOG_LEVEL_VERBOSE : GLOG_LEVEL_NONE;
+	__ofono_log_init("test-dbus-objects",
+				g_test_verbose() ? "*" : NULL,
+				FALSE);
+
+	g_test_add_func(TEST_("objects"), test_objects);
+
+	return g_test_run();
+}
+
+/*
+ * Local Variables:
+ * mode: C
+ * c-basic-offset: 8
+ * indent-tabs-mode: t
+ * End:
+ */
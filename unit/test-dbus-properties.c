@@ -0,0 +1,339 @@
+/*
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2021 Jolla Ltd. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ */
+
+#include "test-dbus.h"
+
+#include <ofono/dbus.h>
+#include <ofono/log.h>
+#include "ofono.h"
+
+#include <gutil_log.h>
+#include <gutil_macros.h>
+
+#define TEST_TIMEOUT                    (10)   /* seconds */
+
+#define TEST_DBUS_PATH                  "/test"
+#define TEST_DBUS_INTERFACE             "test.interface"
+#define TEST_GET_PROPERTIES             "GetProperties"
+#define TEST_PROPERTY_CHANGED_SIGNAL    "PropertyChanged"
+#define TEST_PROPERTY_NAME              "Value"
+
+struct test_data {
+	struct test_dbus_context dbus;
+	const char *value;
+	int appended;
+	int step;
+};
+
+static gboolean test_debug;
+
+/* ==== common ==== */
+
+static gboolean test_timeout(gpointer param)
+{
+	g_assert(!"TIMEOUT");
+	return G_SOURCE_REMOVE;
+}
+
+static guint test_setup_timeout(void)
+{
+	if (test_debug) {
+		return 0;
+	} else {
+		return g_timeout_add_seconds(TEST_TIMEOUT, test_timeout, NULL);
+	}
+}
+
+static void test_append_properties(DBusMessageIter *dict, void *data)
+{
+	struct test_data *test = data;
+
+	test->appended++;
+
+	/* Like the netreg properties which are left out when unknown */
+	if (test->value) {
+		ofono_dbus_dict_append(dict, TEST_PROPERTY_NAME,
+					DBUS_TYPE_STRING, &test->value);
+	}
+}
+
+static DBusMessage *test_get_properties(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	return __ofono_dbus_cached_properties_reply(msg, TEST_DBUS_INTERFACE,
+						test_append_properties, data);
+}
+
+static const GDBusMethodTable test_methods[] = {
+	{ GDBUS_METHOD(TEST_GET_PROPERTIES, NULL,
+			GDBUS_ARGS({ "properties", "a{sv}" }),
+			test_get_properties) },
+	{ }
+};
+
+static const GDBusSignalTable test_signals[] = {
+	{ GDBUS_SIGNAL(TEST_PROPERTY_CHANGED_SIGNAL,
+			GDBUS_ARGS({ "name", "s" }, { "value", "v" })) },
+	{ }
+};
+
+static void test_check_reply(DBusPendingCall *call, const char *value)
+{
+	DBusMessage *reply = dbus_pending_call_steal_reply(call);
+	DBusMessageIter it, dict, entry, var;
+
+	g_assert_cmpint(dbus_message_get_type(reply), == ,
+					DBUS_MESSAGE_TYPE_METHOD_RETURN);
+	g_assert_cmpstr(dbus_message_get_signature(reply), == ,"a{sv}");
+
+	dbus_message_iter_init(reply, &it);
+	dbus_message_iter_recurse(&it, &dict);
+	dbus_message_iter_recurse(&dict, &entry);
+	g_assert_cmpstr(test_dbus_get_string(&entry), == ,TEST_PROPERTY_NAME);
+	dbus_message_iter_recurse(&entry, &var);
+	g_assert_cmpstr(test_dbus_get_string(&var), == ,value);
+	g_assert(!dbus_message_iter_next(&dict));
+
+	dbus_message_unref(reply);
+	dbus_pending_call_unref(call);
+}
+
+static void test_check_empty_reply(DBusPendingCall *call)
+{
+	DBusMessage *reply = dbus_pending_call_steal_reply(call);
+	DBusMessageIter it, dict;
+
+	g_assert_cmpint(dbus_message_get_type(reply), == ,
+					DBUS_MESSAGE_TYPE_METHOD_RETURN);
+	g_assert_cmpstr(dbus_message_get_signature(reply), == ,"a{sv}");
+
+	dbus_message_iter_init(reply, &it);
+	dbus_message_iter_recurse(&it, &dict);
+	g_assert_cmpint(dbus_message_iter_get_arg_type(&dict), == ,
+							DBUS_TYPE_INVALID);
+
+	dbus_message_unref(reply);
+	dbus_pending_call_unref(call);
+}
+
+static void test_call(struct test_data *test, DBusPendingCallNotifyFunction fn)
+{
+	DBusPendingCall *call;
+	DBusMessage *msg = dbus_message_new_method_call(NULL, TEST_DBUS_PATH,
+				TEST_DBUS_INTERFACE, TEST_GET_PROPERTIES);
+
+	g_assert(dbus_connection_send_with_reply(test->dbus.client_connection,
+					msg, &call, DBUS_TIMEOUT_INFINITE));
+	dbus_pending_call_set_notify(call, fn, test, NULL);
+	dbus_message_unref(msg);
+}
+
+/* ==== null ==== */
+
+static void test_null(void)
+{
+	/* We are NULL tolerant: */
+	__ofono_dbus_cached_properties_invalidate(NULL, NULL);
+	__ofono_dbus_cached_properties_invalidate(TEST_DBUS_PATH, NULL);
+
+	/* Nothing to invalidate */
+	__ofono_dbus_cached_properties_invalidate(TEST_DBUS_PATH,
+						TEST_DBUS_INTERFACE);
+}
+
+/* ==== cache ==== */
+
+static void test_cache_reply(DBusPendingCall *call, void *data)
+{
+	struct test_data *test = data;
+	DBusConnection *conn = ofono_dbus_get_connection();
+
+	DBG("step %d", test->step);
+	switch (test->step++) {
+	case 0:
+		test_check_reply(call, "a");
+		g_assert_cmpint(test->appended, == ,1);
+
+		/* Not signalled, the cached reply is still used */
+		test->value = "b";
+		break;
+	case 1:
+		test_check_reply(call, "a");
+		g_assert_cmpint(test->appended, == ,1);
+
+		/* The change signal drops the cached reply */
+		ofono_dbus_signal_property_changed(conn, TEST_DBUS_PATH,
+				TEST_DBUS_INTERFACE, TEST_PROPERTY_NAME,
+				DBUS_TYPE_STRING, &test->value);
+		break;
+	case 2:
+		test_check_reply(call, "b");
+		g_assert_cmpint(test->appended, == ,2);
+
+		/* So does explicit invalidation */
+		test->value = "c";
+		__ofono_dbus_cached_properties_invalidate(TEST_DBUS_PATH,
+							TEST_DBUS_INTERFACE);
+		break;
+	case 3:
+		test_check_reply(call, "c");
+		g_assert_cmpint(test->appended, == ,3);
+		g_main_loop_quit(test->dbus.loop);
+		return;
+	}
+
+	test_call(test, test_cache_reply);
+}
+
+static void test_cache_start(struct test_dbus_context *dbus)
+{
+	struct test_data *test = G_CAST(dbus, struct test_data, dbus);
+
+	g_assert(g_dbus_register_interface(ofono_dbus_get_connection(),
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE,
+				test_methods, test_signals, NULL, test, NULL));
+	test_call(test, test_cache_reply);
+}
+
+static void test_cache(void)
+{
+	struct test_data test;
+	guint timeout = test_setup_timeout();
+
+	memset(&test, 0, sizeof(test));
+	test.value = "a";
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_cache_start;
+
+	g_main_loop_run(test.dbus.loop);
+	g_assert_cmpint(test.step, == ,4);
+
+	__ofono_dbus_cached_properties_invalidate(TEST_DBUS_PATH,
+						TEST_DBUS_INTERFACE);
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
+/* ==== silent ==== */
+
+static void test_silent_reply(DBusPendingCall *call, void *data)
+{
+	struct test_data *test = data;
+
+	DBG("step %d", test->step);
+	switch (test->step++) {
+	case 0:
+		test_check_reply(call, "a");
+		g_assert_cmpint(test->appended, == ,1);
+
+		/*
+		 * The property goes away without a signal, e.g. CellId
+		 * being reset to -1. The owner invalidates the reply.
+		 */
+		test->value = NULL;
+		__ofono_dbus_cached_properties_invalidate(TEST_DBUS_PATH,
+							TEST_DBUS_INTERFACE);
+		break;
+	case 1:
+		test_check_empty_reply(call);
+		g_assert_cmpint(test->appended, == ,2);
+
+		/* And comes back with a signal */
+		test->value = "b";
+		ofono_dbus_signal_property_changed(ofono_dbus_get_connection(),
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE,
+				TEST_PROPERTY_NAME, DBUS_TYPE_STRING,
+				&test->value);
+		break;
+	case 2:
+		test_check_reply(call, "b");
+		g_assert_cmpint(test->appended, == ,3);
+		g_main_loop_quit(test->dbus.loop);
+		return;
+	}
+
+	test_call(test, test_silent_reply);
+}
+
+static void test_silent_start(struct test_dbus_context *dbus)
+{
+	struct test_data *test = G_CAST(dbus, struct test_data, dbus);
+
+	g_assert(g_dbus_register_interface(ofono_dbus_get_connection(),
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE,
+				test_methods, test_signals, NULL, test, NULL));
+	test_call(test, test_silent_reply);
+}
+
+static void test_silent(void)
+{
+	struct test_data test;
+	guint timeout = test_setup_timeout();
+
+	memset(&test, 0, sizeof(test));
+	test.value = "a";
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_silent_start;
+
+	g_main_loop_run(test.dbus.loop);
+	g_assert_cmpint(test.step, == ,3);
+
+	__ofono_dbus_cached_properties_invalidate(TEST_DBUS_PATH,
+						TEST_DBUS_INTERFACE);
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
+#define TEST_(name) "/dbus-properties/" name
+
+int main(int argc, char *argv[])
+{
+	int i;
+
+	g_test_init(&argc, &argv, NULL);
+	for (i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		if (!strcmp(arg, "-d") || !strcmp(arg, "--debug")) {
+			test_debug = TRUE;
+		} else {
+			GWARN("Unsupported command line option %s", arg);
+		}
+	}
+
+	gutil_log_timestamp = FALSE;
+	gutil_log_default.level = g_test_verbose() ?
+		GLOG_LEVEL_VERBOSE : GLOG_LEVEL_NONE;
+	__ofono_log_init("test-dbus-properties",
+				g_test_verbose() ? "*" : NULL,
+				FALSE);
+
+	g_test_add_func(TEST_("null"), test_null);
+	g_test_add_func(TEST_("cache"), test_cache);
+	g_test_add_func(TEST_("silent"), test_silent);
+
+	return g_test_run();
+}
+
+/*
+ * Local Variables:
+ * mode: C
+ * c-basic-offset: 8
+ * indent-tabs-mode: t
+ * End:
+ */
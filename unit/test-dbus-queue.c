@@ -33,6 +33,7 @@
 #define TEST_ERROR_CANCELED            "org.ofono.Error.Canceled"
 #define TEST_ERROR_FAILED              "org.ofono.Error.Failed"
 #define TEST_ERROR_NOT_SUPPORTED       "org.ofono.Error.NotSupported"
+#define TEST_ERROR_TIMED_OUT           "org.ofono.Error.Timedout"
 
 #define GDBUS_TEST_METHOD(fn) GDBUS_ASYNC_METHOD(TEST_DBUS_METHOD, \
 				GDBUS_ARGS( { "arg", "i" }), NULL, fn)
@@ -673,6 +674,212 @@ static void test_ok(void)
 	}
 }
 
+/* ==== priority ==== */
+
+struct test_priority_data {
+	struct test_dbus_context dbus;
+	struct ofono_dbus_queue *queue;
+	int order[4];
+	int count;
+};
+
+static dbus_int32_t test_get_arg(DBusMessage *msg)
+{
+	dbus_int32_t arg = -1;
+
+	g_assert(dbus_message_get_args(msg, NULL, DBUS_TYPE_INT32, &arg,
+							DBUS_TYPE_INVALID));
+	return arg;
+}
+
+static gboolean test_priority_complete(void *data)
+{
+	struct test_priority_data *test = data;
+
+	__ofono_dbus_queue_reply_ok(test->queue);
+	return G_SOURCE_REMOVE;
+}
+
+static DBusMessage *test_priority_cb(DBusMessage *msg, void *data)
+{
+	struct test_priority_data *test = data;
+	const dbus_int32_t arg = test_get_arg(msg);
+
+	DBG("%d", arg);
+	g_assert(test->count < G_N_ELEMENTS(test->order));
+	test->order[test->count++] = arg;
+
+	/* The first one stays pending until all others are queued */
+	return arg ? dbus_message_new_method_return(msg) : NULL;
+}
+
+static void test_priority_last_reply(DBusPendingCall *call, void *dbus)
+{
+	struct test_priority_data *test =
+		G_CAST(dbus, struct test_priority_data, dbus);
+
+	DBG("");
+	test_dbus_check_empty_reply(call, NULL);
+	g_assert_cmpint(test->count, == ,4);
+	g_assert_cmpint(test->order[0], == ,0);
+	g_assert_cmpint(test->order[1], == ,3);
+	g_assert_cmpint(test->order[2], == ,2);
+	g_assert_cmpint(test->order[3], == ,1);
+	g_assert(!__ofono_dbus_queue_pending(test->queue));
+	g_main_loop_quit(test->dbus.loop);
+}
+
+static DBusMessage *test_priority_handler(DBusConnection *conn,
+						DBusMessage *msg, void *data)
+{
+	static const enum ofono_dbus_queue_priority priority[] = {
+		OFONO_DBUS_QUEUE_PRIORITY_DEFAULT,
+		OFONO_DBUS_QUEUE_PRIORITY_BACKGROUND,
+		OFONO_DBUS_QUEUE_PRIORITY_DEFAULT,
+		OFONO_DBUS_QUEUE_PRIORITY_INTERACTIVE
+	};
+	struct test_priority_data *test = data;
+	const dbus_int32_t arg = test_get_arg(msg);
+
+	DBG("%d", arg);
+	__ofono_dbus_queue_request_full(test->queue, test_priority_cb, msg,
+					data, priority[arg], 0);
+	if (arg == 3) {
+		g_idle_add(test_priority_complete, test);
+	}
+	return NULL;
+}
+
+static const GDBusMethodTable test_priority_methods[] = {
+	{ GDBUS_TEST_METHOD(test_priority_handler) },
+	{ }
+};
+
+static void test_priority_start(struct test_dbus_context *dbus)
+{
+	struct test_priority_data *test =
+		G_CAST(dbus, struct test_priority_data, dbus);
+
+	test_register_interface(test_priority_methods, test);
+	test_client_call(dbus, 0, test_dbus_expect_empty_reply);
+	test_client_call(dbus, 1, test_priority_last_reply);
+	test_client_call(dbus, 2, test_dbus_expect_empty_reply);
+	test_client_call(dbus, 3, test_dbus_expect_empty_reply);
+}
+
+static void test_priority(void)
+{
+	struct test_priority_data test;
+	guint timeout = test_setup_timeout();
+
+	memset(&test, 0, sizeof(test));
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_priority_start;
+	test.queue = __ofono_dbus_queue_new();
+
+	g_main_loop_run(test.dbus.loop);
+
+	__ofono_dbus_queue_free(test.queue);
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
+/* ==== expire ==== */
+
+#define TEST_EXPIRE_SHORT_MS (10)
+#define TEST_EXPIRE_LONG_MS  (TEST_TIMEOUT * 1000)
+
+struct test_expire_data {
+	struct test_dbus_context dbus;
+	struct ofono_dbus_queue *queue;
+};
+
+static DBusMessage *test_expire_cb(DBusMessage *msg, void *data)
+{
+	const dbus_int32_t arg = test_get_arg(msg);
+
+	DBG("%d", arg);
+
+	/* The second one expires before it gets submitted */
+	g_assert_cmpint(arg, != ,1);
+	return arg ? dbus_message_new_method_return(msg) : NULL;
+}
+
+static void test_expire_timed_out(DBusPendingCall *call, void *dbus)
+{
+	struct test_expire_data *test =
+		G_CAST(dbus, struct test_expire_data, dbus);
+
+	DBG("");
+	test_dbus_check_error_reply(call, TEST_ERROR_TIMED_OUT);
+	g_assert(__ofono_dbus_queue_pending(test->queue));
+
+	/* Complete the first request, the last one gets submitted */
+	__ofono_dbus_queue_reply_ok(test->queue);
+}
+
+static void test_expire_last_reply(DBusPendingCall *call, void *dbus)
+{
+	struct test_expire_data *test =
+		G_CAST(dbus, struct test_expire_data, dbus);
+
+	DBG("");
+	test_dbus_check_empty_reply(call, NULL);
+	g_assert(!__ofono_dbus_queue_pending(test->queue));
+	g_main_loop_quit(test->dbus.loop);
+}
+
+static DBusMessage *test_expire_handler(DBusConnection *conn,
+						DBusMessage *msg, void *data)
+{
+	struct test_expire_data *test = data;
+	const dbus_int32_t arg = test_get_arg(msg);
+
+	DBG("%d", arg);
+	__ofono_dbus_queue_request_full(test->queue, test_expire_cb, msg,
+				data, OFONO_DBUS_QUEUE_PRIORITY_DEFAULT,
+				(arg == 1) ? TEST_EXPIRE_SHORT_MS :
+				TEST_EXPIRE_LONG_MS);
+	return NULL;
+}
+
+static const GDBusMethodTable test_expire_methods[] = {
+	{ GDBUS_TEST_METHOD(test_expire_handler) },
+	{ }
+};
+
+static void test_expire_start(struct test_dbus_context *dbus)
+{
+	struct test_expire_data *test =
+		G_CAST(dbus, struct test_expire_data, dbus);
+
+	test_register_interface(test_expire_methods, test);
+	test_client_call(dbus, 0, test_dbus_expect_empty_reply);
+	test_client_call(dbus, 1, test_expire_timed_out);
+	test_client_call(dbus, 2, test_expire_last_reply);
+}
+
+static void test_expire(void)
+{
+	struct test_expire_data test;
+	guint timeout = test_setup_timeout();
+
+	memset(&test, 0, sizeof(test));
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_expire_start;
+	test.queue = __ofono_dbus_queue_new();
+
+	g_main_loop_run(test.dbus.loop);
+
+	__ofono_dbus_queue_free(test.queue);
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
 #define TEST_(name) "/dbus-queue/" name
 
 int main(int argc, char *argv[])
@@ -703,6 +910,8 @@ int main(int argc, char *argv[])
 	g_test_add_func(TEST_("sync"), test_sync);
 	g_test_add_func(TEST_("reply"), test_reply);
 	g_test_add_func(TEST_("ok"), test_ok);
+	g_test_add_func(TEST_("priority"), test_priority);
+	g_test_add_func(TEST_("expire"), test_expire);
 
 	return g_test_run();
 }
@@ -0,0 +1,281 @@
+/*
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2021 Jolla Ltd. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ */
+
+#include "test-dbus.h"
+
+#include <ofono/dbus.h>
+#include <ofono/log.h>
+#include "ofono.h"
+
+#include <gutil_log.h>
+#include <gutil_macros.h>
+
+#define TEST_TIMEOUT                    (10)   /* seconds */
+#define TEST_ASYNC_DELAY                (20)   /* milliseconds */
+
+#define TEST_DBUS_PATH                  "/test"
+#define TEST_DBUS_INTERFACE             "test.interface"
+#define TEST_SYNC_METHOD                "Sync"
+#define TEST_ASYNC_METHOD               "Async"
+#define TEST_DROP_METHOD                "Drop"
+
+struct test_data {
+	struct test_dbus_context dbus;
+	DBusMessage *pending;
+	int step;
+};
+
+static gboolean test_debug;
+
+/* ==== common ==== */
+
+static gboolean test_timeout(gpointer param)
+{
+	g_assert(!"TIMEOUT");
+	return G_SOURCE_REMOVE;
+}
+
+static guint test_setup_timeout(void)
+{
+	if (test_debug) {
+		return 0;
+	} else {
+		return g_timeout_add_seconds(TEST_TIMEOUT, test_timeout, NULL);
+	}
+}
+
+static void test_find_stats_cb(const GDBusStatistics *stats, void *data)
+{
+	const GDBusStatistics **found = data;
+
+	if (!stats->signal && !g_strcmp0(stats->interface,
+				TEST_DBUS_INTERFACE) &&
+			!g_strcmp0(stats->member, (*found)->member)) {
+		*found = stats;
+	}
+}
+
+static const GDBusStatistics *test_find_stats(const char *member)
+{
+	GDBusStatistics key;
+	const GDBusStatistics *found = &key;
+
+	memset(&key, 0, sizeof(key));
+	key.member = member;
+	g_dbus_foreach_statistics(test_find_stats_cb, &found);
+	g_assert(found != &key);
+	return found;
+}
+
+static void test_sender_stats_cb(const char *sender, unsigned int count,
+								void *data)
+{
+	*(unsigned int *)data += count;
+}
+
+/* ==== stats ==== */
+
+static void test_call(struct test_data *test, const char *method,
+					DBusPendingCallNotifyFunction fn)
+{
+	DBusMessage *msg = dbus_message_new_method_call(NULL, TEST_DBUS_PATH,
+					TEST_DBUS_INTERFACE, method);
+
+	if (fn) {
+		DBusPendingCall *call;
+
+		g_assert(dbus_connection_send_with_reply(
+					test->dbus.client_connection, msg,
+					&call, DBUS_TIMEOUT_INFINITE));
+		dbus_pending_call_set_notify(call, fn, test, NULL);
+		dbus_pending_call_unref(call);
+	} else {
+		/* Still expects a reply, the client just doesn't wait */
+		g_assert(dbus_connection_send(test->dbus.client_connection,
+								msg, NULL));
+	}
+	dbus_message_unref(msg);
+}
+
+static DBusMessage *test_sync_handler(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	return dbus_message_new_method_return(msg);
+}
+
+static gboolean test_async_reply(gpointer data)
+{
+	struct test_data *test = data;
+
+	__ofono_dbus_pending_reply(&test->pending,
+			dbus_message_new_method_return(test->pending));
+	return G_SOURCE_REMOVE;
+}
+
+static DBusMessage *test_async_handler(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	struct test_data *test = data;
+
+	g_assert(!test->pending);
+	test->pending = dbus_message_ref(msg);
+	g_timeout_add(TEST_ASYNC_DELAY, test_async_reply, test);
+	return NULL;
+}
+
+static gboolean test_drop(gpointer data)
+{
+	struct test_data *test = data;
+	const GDBusStatistics *stats;
+	unsigned int senders = 0;
+
+	/* The last reference goes away without a reply */
+	dbus_message_unref(test->pending);
+	test->pending = NULL;
+
+	stats = test_find_stats(TEST_SYNC_METHOD);
+	g_assert_cmpuint(stats->count, == ,1);
+	g_assert_cmpuint(stats->errors, == ,0);
+	g_assert_cmpuint(stats->deferred, == ,0);
+	g_assert_cmpuint(stats->dropped, == ,0);
+	g_assert(stats->max_time == stats->total_time);
+
+	stats = test_find_stats(TEST_ASYNC_METHOD);
+	g_assert_cmpuint(stats->count, == ,1);
+	g_assert_cmpuint(stats->errors, == ,0);
+	g_assert_cmpuint(stats->deferred, == ,1);
+	g_assert_cmpuint(stats->dropped, == ,0);
+	g_assert(stats->total_time >= TEST_ASYNC_DELAY * 1000);
+	g_assert(stats->max_time == stats->total_time);
+
+	stats = test_find_stats(TEST_DROP_METHOD);
+	g_assert_cmpuint(stats->count, == ,0);
+	g_assert_cmpuint(stats->dropped, == ,1);
+	g_assert(!stats->total_time);
+
+	g_dbus_foreach_sender_statistics(test_sender_stats_cb, &senders);
+	g_assert_cmpuint(senders, == ,3);
+
+	g_main_loop_quit(test->dbus.loop);
+	return G_SOURCE_REMOVE;
+}
+
+static DBusMessage *test_drop_handler(DBusConnection *conn,
+					DBusMessage *msg, void *data)
+{
+	struct test_data *test = data;
+
+	g_assert(!test->pending);
+	test->pending = dbus_message_ref(msg);
+	g_idle_add(test_drop, test);
+	return NULL;
+}
+
+static const GDBusMethodTable test_methods[] = {
+	{ GDBUS_METHOD(TEST_SYNC_METHOD, NULL, NULL, test_sync_handler) },
+	{ GDBUS_ASYNC_METHOD(TEST_ASYNC_METHOD, NULL, NULL,
+						test_async_handler) },
+	{ GDBUS_ASYNC_METHOD(TEST_DROP_METHOD, NULL, NULL,
+						test_drop_handler) },
+	{ }
+};
+
+static void test_stats_reply(DBusPendingCall *call, void *data)
+{
+	struct test_data *test = data;
+
+	test_dbus_check_empty_reply(call, NULL);
+
+	DBG("step %d", test->step);
+	switch (test->step++) {
+	case 0:
+		test_call(test, TEST_ASYNC_METHOD, test_stats_reply);
+		break;
+	case 1:
+		test_call(test, TEST_DROP_METHOD, NULL);
+		break;
+	}
+}
+
+static void test_stats_start(struct test_dbus_context *dbus)
+{
+	struct test_data *test = G_CAST(dbus, struct test_data, dbus);
+
+	g_assert(g_dbus_register_interface(ofono_dbus_get_connection(),
+				TEST_DBUS_PATH, TEST_DBUS_INTERFACE,
+				test_methods, NULL, NULL, test, NULL));
+	test_call(test, TEST_SYNC_METHOD, test_stats_reply);
+}
+
+static void test_stats(void)
+{
+	struct test_data test;
+	guint timeout = test_setup_timeout();
+	int flags = g_dbus_get_flags();
+
+	g_dbus_reset_statistics();
+	g_dbus_set_flags(flags | G_DBUS_FLAG_ENABLE_STATISTICS);
+
+	memset(&test, 0, sizeof(test));
+	test_dbus_setup(&test.dbus);
+	test.dbus.start = test_stats_start;
+
+	g_main_loop_run(test.dbus.loop);
+	g_assert_cmpint(test.step, == ,2);
+	g_assert(!test.pending);
+
+	g_dbus_set_flags(flags);
+	g_dbus_reset_statistics();
+	test_dbus_shutdown(&test.dbus);
+	if (timeout) {
+		g_source_remove(timeout);
+	}
+}
+
+#define TEST_(name) "/dbus-stats/" name
+
+int main(int argc, char *argv[])
+{
+	int i;
+
+	g_test_init(&argc, &argv, NULL);
+	for (i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		if (!strcmp(arg, "-d") || !strcmp(arg, "--debug")) {
+			test_debug = TRUE;
+		} else {
+			GWARN("Unsupported command line option %s", arg);
+		}
+	}
+
+	gutil_log_timestamp = FALSE;
+	gutil_log_default.level = g_test_verbose() ?
+		GLOG_LEVEL_VERBOSE : GLOG_LEVEL_NONE;
+	__ofono_log_init("test-dbus-stats",
+				g_test_verbose() ? "*" : NULL,
+				FALSE);
+
+	g_test_add_func(TEST_("stats"), test_stats);
+
+	return g_test_run();
+}
+
+/*
+ * Local Variables:
+ * mode: C
+ * c-basic-offset: 8
+ * indent-tabs-mode: t
+ * End:
+ */
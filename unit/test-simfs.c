@@ -0,0 +1,652 @@
+/*
+ *
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2008-2011  Intel Corporation. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <glib.h>
+#include <ell/ell.h>
+
+#include "ofono.h"
+
+#include "simfs.h"
+#include "simutil.h"
+
+#define TEST_IMSI	"001010123456789"
+#define TEST_PHASE	OFONO_SIM_PHASE_3G
+#define TEST_EF		0x6f46
+
+static const unsigned char test_ef_data[] = {
+	0x01, 0x6f, 0x46, 0x6f, 0x4e, 0x6f, 0x20, 0x54, 0x65, 0x73, 0x74,
+};
+
+/* Update, rehabilitate and invalidate are all ADM, so the EF is cached */
+static const unsigned char test_ef_access[3] = { 0x0e, 0x00, 0xee };
+
+static GMainLoop *test_loop;
+static int info_reads;
+static int data_reads;
+
+struct fake_request {
+	gconstpointer cb;
+	void *data;
+};
+
+/* Answer from the main loop, as a real modem would */
+static void fake_request_add(gconstpointer cb, void *data, GSourceFunc func)
+{
+	struct fake_request *req = g_new0(struct fake_request, 1);
+
+	req->cb = cb;
+	req->data = data;
+	g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, func, req, g_free);
+}
+
+static gboolean fake_info_reply(gpointer user_data)
+{
+	struct fake_request *req = user_data;
+	ofono_sim_file_info_cb_t cb = req->cb;
+	struct ofono_error error = { OFONO_ERROR_TYPE_NO_ERROR, 0 };
+
+	cb(&error, sizeof(test_ef_data), OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
+		0, test_ef_access, SIM_FILE_STATUS_VALID, req->data);
+
+	return FALSE;
+}
+
+static gboolean fake_read_reply(gpointer user_data)
+{
+	struct fake_request *req = user_data;
+	ofono_sim_read_cb_t cb = req->cb;
+	struct ofono_error error = { OFONO_ERROR_TYPE_NO_ERROR, 0 };
+
+	cb(&error, test_ef_data, sizeof(test_ef_data), req->data);
+
+	return FALSE;
+}
+
+static void fake_read_file_info(struct ofono_sim *sim, int fileid,
+				const unsigned char *path,
+				unsigned int path_len,
+				ofono_sim_file_info_cb_t cb, void *data)
+{
+	g_assert(fileid == TEST_EF);
+
+	info_reads += 1;
+	fake_request_add(cb, data, fake_info_reply);
+}
+
+static void fake_read_file_transparent(struct ofono_sim *sim, int fileid,
+					int start, int length,
+					const unsigned char *path,
+					unsigned int path_len,
+					ofono_sim_read_cb_t cb, void *data)
+{
+	g_assert(fileid == TEST_EF);
+	g_assert(start == 0);
+
+	data_reads += 1;
+	fake_request_add(cb, data, fake_read_reply);
+}
+
+static const struct ofono_sim_driver fake_driver = {
+	.read_file_info		= fake_read_file_info,
+	.read_file_transparent	= fake_read_file_transparent,
+};
+
+/* Only what simfs needs from the SIM atom */
+const char *ofono_sim_get_imsi(struct ofono_sim *sim)
+{
+	return TEST_IMSI;
+}
+
+enum ofono_sim_phase ofono_sim_get_phase(struct ofono_sim *sim)
+{
+	return TEST_PHASE;
+}
+
+struct ofono_sim_aid_session *__ofono_sim_get_session_by_aid(
+		struct ofono_sim *sim, unsigned char *aid)
+{
+	return NULL;
+}
+
+unsigned int __ofono_sim_add_session_watch(
+		struct ofono_sim_aid_session *session,
+		ofono_sim_session_event_cb_t notify, void *data,
+		ofono_destroy_func destroy)
+{
+	return 0;
+}
+
+void __ofono_sim_remove_session_watch(struct ofono_sim_aid_session *session,
+		unsigned int id)
+{
+}
+
+struct ofono_watchlist *__ofono_watchlist_new(ofono_destroy_func destroy)
+{
+	return NULL;
+}
+
+unsigned int __ofono_watchlist_add_item(struct ofono_watchlist *watchlist,
+					struct ofono_watchlist_item *item)
+{
+	return 0;
+}
+
+gboolean __ofono_watchlist_remove_item(struct ofono_watchlist *watchlist,
+					unsigned int id)
+{
+	return FALSE;
+}
+
+void __ofono_watchlist_free(struct ofono_watchlist *watchlist)
+{
+}
+
+void __ofono_watchlist_dispatch_begin(struct ofono_watchlist *watchlist)
+{
+}
+
+void __ofono_watchlist_dispatch_end(struct ofono_watchlist *watchlist)
+{
+}
+
+struct ofono_watchlist_item *__ofono_watchlist_first(
+					struct ofono_watchlist *watchlist)
+{
+	return NULL;
+}
+
+struct ofono_watchlist_item *__ofono_watchlist_next(
+					struct ofono_watchlist_item *item)
+{
+	return NULL;
+}
+
+static void test_read_cb(int ok, int total_length, int record,
+				const unsigned char *data,
+				int record_length, void *userdata)
+{
+	g_assert(ok);
+	g_assert(total_length == sizeof(test_ef_data));
+	g_assert(memcmp(data, test_ef_data, sizeof(test_ef_data)) == 0);
+
+	g_main_loop_quit(test_loop);
+}
+
+static void test_read(struct ofono_sim_context *context)
+{
+	g_assert(sim_fs_read(context, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, 0,
+				NULL, 0, test_read_cb, NULL) == 0);
+	g_main_loop_run(test_loop);
+}
+
+static void test_check_stats(unsigned int hits, unsigned int misses)
+{
+	unsigned int cache_hits;
+	unsigned int cache_misses;
+
+	sim_fs_get_cache_stats(&cache_hits, &cache_misses);
+	g_assert_cmpuint(cache_hits, ==, hits);
+	g_assert_cmpuint(cache_misses, ==, misses);
+}
+
+static struct sim_fs *test_fs_new(void)
+{
+	struct sim_fs *fs;
+
+	test_loop = g_main_loop_new(NULL, FALSE);
+	info_reads = 0;
+	data_reads = 0;
+
+	fs = sim_fs_new(NULL, &fake_driver);
+	g_assert(fs);
+
+	/* Creates the cache directory and starts out with an empty cache */
+	sim_fs_check_version(fs);
+	sim_fs_cache_flush(fs);
+
+	return fs;
+}
+
+static void test_fs_free(struct sim_fs *fs)
+{
+	char *path;
+
+	sim_fs_cache_flush(fs);
+	sim_fs_free(fs);
+	sim_fs_cache_cleanup();
+
+	path = g_strdup_printf(SIM_FS_STORAGEDIR "/%s-%i/version",
+					TEST_IMSI, TEST_PHASE);
+	unlink(path);
+	g_free(path);
+
+	path = g_strdup_printf(SIM_FS_STORAGEDIR "/%s-%i/images",
+					TEST_IMSI, TEST_PHASE);
+	rmdir(path);
+	g_free(path);
+
+	path = g_strdup_printf(SIM_FS_STORAGEDIR "/%s-%i",
+					TEST_IMSI, TEST_PHASE);
+	rmdir(path);
+	g_free(path);
+
+	rmdir(SIM_FS_STORAGEDIR);
+
+	g_main_loop_unref(test_loop);
+}
+
+static void test_cache_stats(void)
+{
+	struct sim_fs *fs;
+	struct ofono_sim_context *context;
+
+	fs = test_fs_new();
+
+	context = sim_fs_context_new(fs);
+	g_assert(context);
+
+	sim_fs_get_cache_stats(NULL, NULL);
+	test_check_stats(0, 0);
+
+	/* Nothing cached yet, the SIM is read and the EF is cached */
+	test_read(context);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+	test_check_stats(0, 1);
+
+	/* Served from memory */
+	test_read(context);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+	test_check_stats(1, 1);
+
+	/* The cache file is still there once memory is dropped */
+	sim_fs_cache_cleanup();
+	test_read(context);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+	test_check_stats(1, 2);
+
+	test_read(context);
+	test_check_stats(2, 2);
+
+	/* Flushing drops the in-memory copy as well */
+	sim_fs_cache_flush(fs);
+	test_read(context);
+	g_assert(info_reads == 2);
+	g_assert(data_reads == 2);
+	test_check_stats(2, 3);
+
+	test_fs_free(fs);
+}
+
+static int pending_cbs;
+
+static void test_done(void)
+{
+	pending_cbs -= 1;
+	g_assert(pending_cbs >= 0);
+
+	if (pending_cbs == 0)
+		g_main_loop_quit(test_loop);
+}
+
+static void test_count_read_cb(int ok, int total_length, int record,
+				const unsigned char *data,
+				int record_length, void *userdata)
+{
+	int *count = userdata;
+
+	g_assert(ok);
+	g_assert(total_length == sizeof(test_ef_data));
+	g_assert(memcmp(data, test_ef_data, sizeof(test_ef_data)) == 0);
+
+	*count += 1;
+	test_done();
+}
+
+static void test_count_info_cb(int ok, unsigned char file_status,
+				int total_length, int record_length,
+				void *userdata)
+{
+	int *count = userdata;
+
+	g_assert(ok);
+	g_assert(file_status == SIM_FILE_STATUS_VALID);
+	g_assert(total_length == sizeof(test_ef_data));
+
+	*count += 1;
+	test_done();
+}
+
+static void test_unexpected_read_cb(int ok, int total_length, int record,
+				const unsigned char *data,
+				int record_length, void *userdata)
+{
+	g_assert_not_reached();
+}
+
+static void test_unexpected_info_cb(int ok, unsigned char file_status,
+				int total_length, int record_length,
+				void *userdata)
+{
+	g_assert_not_reached();
+}
+
+static int test_read_count(struct ofono_sim_context *context, int *count)
+{
+	return sim_fs_read(context, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, 0,
+				NULL, 0, test_count_read_cb, count);
+}
+
+static int test_info_count(struct ofono_sim_context *context, int *count)
+{
+	return sim_fs_read_info(context, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
+				test_count_info_cb, count);
+}
+
+static void test_coalesce_reads(void)
+{
+	struct sim_fs *fs = test_fs_new();
+	struct ofono_sim_context *context = sim_fs_context_new(fs);
+	int first = 0;
+	int second = 0;
+
+	/* Nothing runs before the main loop, so the second read is merged */
+	g_assert(test_read_count(context, &first) == 0);
+	g_assert(test_read_count(context, &second) == 0);
+
+	pending_cbs = 2;
+	g_main_loop_run(test_loop);
+
+	g_assert(first == 1);
+	g_assert(second == 1);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+
+	sim_fs_context_free(context);
+	test_fs_free(fs);
+}
+
+static void test_coalesce_info(void)
+{
+	struct sim_fs *fs = test_fs_new();
+	struct ofono_sim_context *context = sim_fs_context_new(fs);
+	int read = 0;
+	int info = 0;
+
+	/* EF-info comes with the pending read */
+	g_assert(test_read_count(context, &read) == 0);
+	g_assert(test_info_count(context, &info) == 0);
+
+	pending_cbs = 2;
+	g_main_loop_run(test_loop);
+
+	g_assert(read == 1);
+	g_assert(info == 1);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+
+	sim_fs_context_free(context);
+	test_fs_free(fs);
+}
+
+static void test_coalesce_upgrade(void)
+{
+	struct sim_fs *fs = test_fs_new();
+	struct ofono_sim_context *context = sim_fs_context_new(fs);
+	int info = 0;
+	int read = 0;
+
+	/* The pending info-only request is turned into a read */
+	g_assert(test_info_count(context, &info) == 0);
+	g_assert(test_read_count(context, &read) == 0);
+
+	pending_cbs = 2;
+	g_main_loop_run(test_loop);
+
+	g_assert(info == 1);
+	g_assert(read == 1);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+
+	sim_fs_context_free(context);
+	test_fs_free(fs);
+}
+
+static gboolean test_quit(gpointer user_data)
+{
+	g_main_loop_quit(test_loop);
+	return FALSE;
+}
+
+static void test_coalesce_free(void)
+{
+	struct sim_fs *fs = test_fs_new();
+	struct ofono_sim_context *owner = sim_fs_context_new(fs);
+	struct ofono_sim_context *other = sim_fs_context_new(fs);
+	int read = 0;
+
+	/* Waiters of a freed context are dropped without being called */
+	g_assert(test_read_count(owner, &read) == 0);
+	g_assert(sim_fs_read(other, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, 0,
+				NULL, 0, test_unexpected_read_cb, NULL) == 0);
+	g_assert(sim_fs_read_info(other, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
+				test_unexpected_info_cb, NULL) == 0);
+	sim_fs_context_free(other);
+
+	pending_cbs = 1;
+	g_main_loop_run(test_loop);
+
+	g_assert(read == 1);
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+
+	/* Once every requester is gone the SIM is not read at all */
+	sim_fs_cache_flush(fs);
+	other = sim_fs_context_new(fs);
+
+	g_assert(sim_fs_read(owner, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, 0,
+				NULL, 0, test_unexpected_read_cb, NULL) == 0);
+	g_assert(sim_fs_read(other, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT, 0, 0,
+				NULL, 0, test_unexpected_read_cb, NULL) == 0);
+	g_assert(sim_fs_read_info(other, TEST_EF,
+				OFONO_SIM_FILE_STRUCTURE_TRANSPARENT,
+				test_unexpected_info_cb, NULL) == 0);
+	sim_fs_context_free(other);
+	sim_fs_context_free(owner);
+
+	g_idle_add_full(G_PRIORITY_LOW, test_quit, NULL, NULL);
+	g_main_loop_run(test_loop);
+
+	g_assert(info_reads == 1);
+	g_assert(data_reads == 1);
+
+	test_fs_free(fs);
+}
+
+#define TEST_ICCID	"8949000000000000001"
+
+static const unsigned char test_efust[] = { 0x9e, 0x6b, 0x1d, 0x04 };
+
+static GByteArray *test_snapshot_build(unsigned char mnc_length)
+{
+	GByteArray *buf = sim_fs_snapshot_begin();
+	unsigned char phase = TEST_PHASE;
+	unsigned char cphs[3] = { OFONO_SIM_CPHS_PHASE_2G, 0x33, 0x00 };
+
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_IMSI, TEST_IMSI,
+				strlen(TEST_IMSI));
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_PHASE, &phase, 1);
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_MNC_LENGTH, &mnc_length, 1);
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_CPHS, cphs, 3);
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_EFUST, test_efust,
+				sizeof(test_efust));
+
+	return buf;
+}
+
+static struct sim_fs_snapshot *test_snapshot_reopen(GByteArray *buf)
+{
+	g_assert(sim_fs_snapshot_commit(buf, TEST_ICCID) == 0);
+
+	return sim_fs_snapshot_open(TEST_ICCID);
+}
+
+static void test_snapshot_round_trip(void)
+{
+	struct sim_fs *fs = test_fs_new();
+	struct sim_fs_snapshot *snap;
+	struct sim_fs_snapshot_data data;
+	GByteArray *buf;
+
+	snap = test_snapshot_reopen(test_snapshot_build(3));
+	g_assert(snap);
+
+	g_assert(sim_fs_snapshot_parse(snap, &data));
+	g_assert(data.imsi_len == strlen(TEST_IMSI));
+	g_assert(memcmp(data.imsi, TEST_IMSI, data.imsi_len) == 0);
+	g_assert(data.phase == TEST_PHASE);
+	g_assert(data.mnc_length == 3);
+	g_assert(data.cphs_phase == OFONO_SIM_CPHS_PHASE_2G);
+	g_assert(data.cphs_service_table[0] == 0x33);
+	g_assert(data.efust_length == sizeof(test_efust));
+	g_assert(memcmp(data.efust, test_efust, sizeof(test_efust)) == 0);
+	g_assert(data.efest == NULL);
+	g_assert(data.efsst == NULL);
+
+	/* Rebuilding from the same contents matches what was saved */
+	buf = test_snapshot_build(3);
+	g_assert(sim_fs_snapshot_matches(snap, buf));
+	g_byte_array_free(buf, TRUE);
+
+	buf = test_snapshot_build(2);
+	g_assert(!sim_fs_snapshot_matches(snap, buf));
+	g_byte_array_free(buf, TRUE);
+
+	sim_fs_snapshot_close(snap);
+	sim_fs_snapshot_remove(TEST_ICCID);
+	g_assert(sim_fs_snapshot_open(TEST_ICCID) == NULL);
+
+	test_fs_free(fs);
+}
+
+static void test_snapshot_reject(unsigned char mnc_length)
+{
+	struct sim_fs_snapshot *snap;
+	struct sim_fs_snapshot_data data;
+
+	snap = test_snapshot_reopen(test_snapshot_build(mnc_length));
+	g_assert(snap);
+	g_assert(!sim_fs_snapshot_parse(snap, &data));
+	sim_fs_snapshot_close(snap);
+}
+
+static void test_snapshot_corrupted(void)
+{
+	struct sim_fs *fs = test_fs_new();
+	struct sim_fs_snapshot *snap;
+	struct sim_fs_snapshot_data data;
+	GByteArray *buf;
+	unsigned char bad_phase = OFONO_SIM_PHASE_UNKNOWN;
+	unsigned int len;
+
+	/* Only 2 and 3 digit MNCs are valid */
+	test_snapshot_reject(0);
+	test_snapshot_reject(1);
+	test_snapshot_reject(4);
+	test_snapshot_reject(0xff);
+
+	/* Wrong magic */
+	buf = test_snapshot_build(2);
+	buf->data[0] ^= 0xff;
+	g_assert(test_snapshot_reopen(buf) == NULL);
+
+	/* Too short to hold the magic */
+	buf = test_snapshot_build(2);
+	g_byte_array_set_size(buf, 2);
+	g_assert(test_snapshot_reopen(buf) == NULL);
+
+	/* Truncated in the middle of the last record */
+	buf = test_snapshot_build(2);
+	g_byte_array_set_size(buf, buf->len - 1);
+	snap = test_snapshot_reopen(buf);
+	g_assert(snap);
+	g_assert(!sim_fs_snapshot_get(snap, SIM_SNAPSHOT_EFUST, &len));
+	g_assert(sim_fs_snapshot_parse(snap, &data));
+	g_assert(data.efust == NULL);
+	sim_fs_snapshot_close(snap);
+
+	/* IMSI with something else than digits */
+	buf = sim_fs_snapshot_begin();
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_IMSI, "00101012345678x", 15);
+	snap = test_snapshot_reopen(buf);
+	g_assert(snap);
+	g_assert(!sim_fs_snapshot_parse(snap, &data));
+	sim_fs_snapshot_close(snap);
+
+	/* Unknown SIM phase */
+	buf = sim_fs_snapshot_begin();
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_IMSI, TEST_IMSI,
+				strlen(TEST_IMSI));
+	sim_fs_snapshot_append(buf, SIM_SNAPSHOT_PHASE, &bad_phase, 1);
+	snap = test_snapshot_reopen(buf);
+	g_assert(snap);
+	g_assert(!sim_fs_snapshot_parse(snap, &data));
+	sim_fs_snapshot_close(snap);
+
+	sim_fs_snapshot_remove(TEST_ICCID);
+	test_fs_free(fs);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, NULL);
+
+	__ofono_log_init("test-simfs", g_test_verbose() ? "*" : NULL, FALSE);
+
+	g_test_add_func("/testsimfs/cache stats", test_cache_stats);
+	g_test_add_func("/testsimfs/coalesce reads", test_coalesce_reads);
+	g_test_add_func("/testsimfs/coalesce info", test_coalesce_info);
+	g_test_add_func("/testsimfs/coalesce upgrade", test_coalesce_upgrade);
+	g_test_add_func("/testsimfs/coalesce free", test_coalesce_free);
+	g_test_add_func("/testsimfs/snapshot round trip",
+					test_snapshot_round_trip);
+	g_test_add_func("/testsimfs/snapshot corrupted",
+					test_snapshot_corrupted);
+
+	return g_test_run();
+}
@@ -407,6 +407,359 @@ static void test_eons(void)
 	sim_eons_free(eons_info);
 }
 
+/* 246/82, whole PLMN, PNN record 2 */
+static const unsigned char valid_efopl_82[] = {
+	0x42, 0xf6, 0x28, 0x00, 0x00, 0xff, 0xfe, 0x02,
+};
+
+static void test_eons_partial_opl(void)
+{
+	const struct sim_eons_operator_info *op_info;
+	struct sim_eons *eons_info;
+
+	eons_info = sim_eons_new(2);
+
+	sim_eons_add_pnn_record(eons_info, 1,
+			valid_efpnn[0], sizeof(valid_efpnn[0]));
+	sim_eons_add_pnn_record(eons_info, 2,
+			valid_efpnn[1], sizeof(valid_efpnn[1]));
+
+	/* Looked up while EFopl is still being read */
+	sim_eons_add_opl_record(eons_info, valid_efopl, sizeof(valid_efopl));
+
+	op_info = sim_eons_lookup(eons_info, "246", "81");
+	g_assert(op_info);
+	g_assert(!strcmp(op_info->longname, "Solavei"));
+
+	op_info = sim_eons_lookup(eons_info, "246", "82");
+	g_assert(op_info == NULL);
+
+	sim_eons_add_opl_record(eons_info, valid_efopl_82,
+						sizeof(valid_efopl_82));
+	sim_eons_optimize(eons_info);
+
+	op_info = sim_eons_lookup(eons_info, "246", "82");
+	g_assert(op_info);
+	g_assert(!strcmp(op_info->longname, "T-Mobile"));
+
+	op_info = sim_eons_lookup(eons_info, "246", "81");
+	g_assert(op_info);
+	g_assert(!strcmp(op_info->longname, "Solavei"));
+
+	/* A record added after optimizing is not lost either */
+	sim_eons_free(eons_info);
+
+	eons_info = sim_eons_new(2);
+
+	sim_eons_add_pnn_record(eons_info, 1,
+			valid_efpnn[0], sizeof(valid_efpnn[0]));
+	sim_eons_add_pnn_record(eons_info, 2,
+			valid_efpnn[1], sizeof(valid_efpnn[1]));
+
+	sim_eons_add_opl_record(eons_info, valid_efopl, sizeof(valid_efopl));
+	sim_eons_optimize(eons_info);
+	g_assert(sim_eons_lookup(eons_info, "246", "82") == NULL);
+
+	sim_eons_add_opl_record(eons_info, valid_efopl_82,
+						sizeof(valid_efopl_82));
+	op_info = sim_eons_lookup(eons_info, "246", "82");
+	g_assert(op_info);
+	g_assert(!strcmp(op_info->longname, "T-Mobile"));
+
+	sim_eons_optimize(eons_info);
+	op_info = sim_eons_lookup(eons_info, "246", "82");
+	g_assert(op_info);
+	g_assert(!strcmp(op_info->longname, "T-Mobile"));
+	g_assert(sim_eons_lookup(eons_info, "246", "81"));
+
+	sim_eons_free(eons_info);
+}
+
+static void check_ber_tlv_index(const unsigned char *pdu, unsigned int len)
+{
+	struct tlv_index_entry entries[64];
+	struct ber_tlv_iter iter;
+	unsigned int n, i;
+
+	n = ber_tlv_index(pdu, len, entries, L_ARRAY_SIZE(entries));
+
+	ber_tlv_iter_init(&iter, pdu, len);
+
+	for (i = 0; i < n; i++) {
+		g_assert(ber_tlv_iter_next(&iter));
+		g_assert(entries[i].tag == ber_tlv_iter_get_short_tag(&iter));
+		g_assert(pdu + entries[i].offset ==
+					ber_tlv_iter_get_data(&iter));
+		g_assert(entries[i].len == ber_tlv_iter_get_length(&iter));
+	}
+
+	if (n < L_ARRAY_SIZE(entries))
+		g_assert(!ber_tlv_iter_next(&iter));
+}
+
+static void check_comprehension_tlv_index(const unsigned char *pdu,
+						unsigned int len)
+{
+	struct tlv_index_entry entries[64];
+	struct comprehension_tlv_iter iter;
+	unsigned int n, i;
+
+	n = comprehension_tlv_index(pdu, len, entries, L_ARRAY_SIZE(entries));
+
+	comprehension_tlv_iter_init(&iter, pdu, len);
+
+	for (i = 0; i < n; i++) {
+		g_assert(comprehension_tlv_iter_next(&iter));
+		g_assert(entries[i].tag ==
+				comprehension_tlv_iter_get_tag(&iter));
+		g_assert(entries[i].cr == comprehension_tlv_get_cr(&iter));
+		g_assert(pdu + entries[i].offset ==
+				comprehension_tlv_iter_get_data(&iter));
+		g_assert(entries[i].len ==
+				comprehension_tlv_iter_get_length(&iter));
+	}
+
+	if (n < L_ARRAY_SIZE(entries))
+		g_assert(!comprehension_tlv_iter_next(&iter));
+}
+
+static void check_simple_tlv_index(const unsigned char *pdu,
+						unsigned int len)
+{
+	struct tlv_index_entry entries[64];
+	struct simple_tlv_iter iter;
+	unsigned int n, i;
+
+	n = simple_tlv_index(pdu, len, entries, L_ARRAY_SIZE(entries));
+
+	simple_tlv_iter_init(&iter, pdu, len);
+
+	for (i = 0; i < n; i++) {
+		g_assert(simple_tlv_iter_next(&iter));
+		g_assert(entries[i].tag == simple_tlv_iter_get_tag(&iter));
+		g_assert(pdu + entries[i].offset ==
+					simple_tlv_iter_get_data(&iter));
+		g_assert(entries[i].len == simple_tlv_iter_get_length(&iter));
+	}
+
+	if (n < L_ARRAY_SIZE(entries))
+		g_assert(!simple_tlv_iter_next(&iter));
+}
+
+static void test_tlv_index(void)
+{
+	static const unsigned char long_forms[] = {
+		0x00, 0xff, 0x9f, 0x81, 0x02, 0x02, 0xaa, 0xbb,
+		0x7f, 0x01, 0x02, 0x81, 0x81, 0x00, 0x03, 0xcc,
+		0x81, 0x81,
+	};
+	const struct tlv_index_entry *entry;
+	struct tlv_index_entry entries[4];
+	unsigned char buf[160];
+	GRand *rand = g_rand_new_with_seed(0x71f);
+	unsigned int n, i, j;
+
+	check_ber_tlv_index(valid_mms_params, sizeof(valid_mms_params));
+	check_ber_tlv_index(valid_efpnn[1], sizeof(valid_efpnn[1]));
+	check_ber_tlv_index(long_forms, sizeof(long_forms));
+	check_comprehension_tlv_index(long_forms + 8,
+					sizeof(long_forms) - 8);
+	check_simple_tlv_index(long_forms, sizeof(long_forms));
+
+	n = ber_tlv_index(valid_efpnn[1], sizeof(valid_efpnn[1]),
+				entries, L_ARRAY_SIZE(entries));
+	g_assert(n == 2);
+
+	entry = tlv_index_find(entries, n, 0x45);
+	g_assert(entry);
+	g_assert(entry->offset == 12);
+	g_assert(entry->len == 8);
+	g_assert(tlv_index_find(entries, n, 0x80) == NULL);
+
+	/* Random buffers, biased towards the interesting bytes */
+	for (i = 0; i < 5000; i++) {
+		unsigned int len = g_rand_int_range(rand, 0, sizeof(buf));
+
+		for (j = 0; j < len; j++) {
+			static const unsigned char special[] = {
+				0x00, 0xff, 0x80, 0x7f, 0x1f, 0x9f, 0x81,
+				0x82, 0x83, 0x84, 0x01, 0x02, 0x03,
+			};
+
+			if (g_rand_boolean(rand))
+				buf[j] = special[g_rand_int_range(rand, 0,
+						L_ARRAY_SIZE(special))];
+			else
+				buf[j] = g_rand_int_range(rand, 0, 256);
+		}
+
+		check_ber_tlv_index(buf, len);
+		check_comprehension_tlv_index(buf, len);
+		check_simple_tlv_index(buf, len);
+	}
+
+	g_rand_free(rand);
+}
+
+struct eons_ref_opl {
+	char mcc[OFONO_MAX_MCC_LENGTH + 1];
+	char mnc[OFONO_MAX_MNC_LENGTH + 1];
+	guint16 low;
+	guint16 high;
+	guint8 id;
+};
+
+static const char eons_digits[] = "12b";
+
+static char eons_ref_digit(guint8 digit)
+{
+	return digit == 0xd ? 'b' : '0' + digit;
+}
+
+/* The plain walk over the records in file order the index replaces */
+static int eons_ref_lookup(const struct eons_ref_opl *opl, int n,
+				const char *mcc, const char *mnc,
+				gboolean have_lac, guint16 lac)
+{
+	int i, j;
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < OFONO_MAX_MCC_LENGTH; j++)
+			if (mcc[j] != opl[i].mcc[j] &&
+					!(opl[i].mcc[j] == 'b' && mcc[j]))
+				break;
+
+		if (j < OFONO_MAX_MCC_LENGTH)
+			continue;
+
+		for (j = 0; j < OFONO_MAX_MNC_LENGTH; j++)
+			if (mnc[j] != opl[i].mnc[j] &&
+					!(opl[i].mnc[j] == 'b' && mnc[j]))
+				break;
+
+		if (j < OFONO_MAX_MNC_LENGTH)
+			continue;
+
+		if (opl[i].low == 0 && opl[i].high == 0xfffe)
+			return opl[i].id;
+
+		if (have_lac && lac >= opl[i].low && lac <= opl[i].high)
+			return opl[i].id;
+	}
+
+	return 0;
+}
+
+static void test_eons_opl_index(void)
+{
+	struct eons_ref_opl ref[64];
+	struct sim_eons *eons;
+	GRand *rand = g_rand_new_with_seed(0x6f5a);
+	int round, i;
+
+	for (round = 0; round < 50; round++) {
+		int n = g_rand_int_range(rand, 1, G_N_ELEMENTS(ref));
+
+		eons = sim_eons_new(20);
+
+		for (i = 0; i < 20; i++) {
+			unsigned char pnn[] = { 0x43, 0x02, 0x81, 'A' + i };
+
+			sim_eons_add_pnn_record(eons, i + 1, pnn, sizeof(pnn));
+		}
+
+		for (i = 0; i < n; i++) {
+			guint8 d[6];
+			unsigned char record[8];
+			int j;
+
+			for (j = 0; j < 6; j++) {
+				char c = eons_digits[g_rand_int_range(rand, 0,
+								3)];
+
+				d[j] = c == 'b' ? 0xd : c - '0';
+			}
+
+			/* Also have some two digit MNCs */
+			if (g_rand_boolean(rand))
+				d[5] = 0xf;
+
+			for (j = 0; j < 3; j++)
+				ref[i].mcc[j] = eons_ref_digit(d[j]);
+
+			ref[i].mcc[3] = '\0';
+			ref[i].mnc[0] = eons_ref_digit(d[3]);
+			ref[i].mnc[1] = eons_ref_digit(d[4]);
+			ref[i].mnc[2] = d[5] == 0xf ? '\0' :
+						eons_ref_digit(d[5]);
+			ref[i].mnc[3] = '\0';
+
+			if (g_rand_int_range(rand, 0, 8) == 0) {
+				ref[i].low = 0;
+				ref[i].high = 0xfffe;
+			} else {
+				ref[i].low = g_rand_int_range(rand, 0, 40);
+				ref[i].high = ref[i].low +
+					g_rand_int_range(rand, 0, 12) - 1;
+			}
+
+			ref[i].id = g_rand_int_range(rand, 0, 21);
+
+			record[0] = d[0] | (d[1] << 4);
+			record[1] = d[2] | (d[5] << 4);
+			record[2] = d[3] | (d[4] << 4);
+			record[3] = ref[i].low >> 8;
+			record[4] = ref[i].low & 0xff;
+			record[5] = ref[i].high >> 8;
+			record[6] = ref[i].high & 0xff;
+			record[7] = ref[i].id;
+
+			sim_eons_add_opl_record(eons, record, sizeof(record));
+		}
+
+		sim_eons_optimize(eons);
+
+		for (i = 0; i < 200; i++) {
+			const struct sim_eons_operator_info *info;
+			char mcc[OFONO_MAX_MCC_LENGTH + 1] = "";
+			char mnc[OFONO_MAX_MNC_LENGTH + 1] = "";
+			guint16 lac = g_rand_int_range(rand, 0, 54);
+			gboolean have_lac = i % 4 != 0;
+			int mnc_len = g_rand_boolean(rand) ? 2 : 3;
+			int expect;
+			int j;
+
+			for (j = 0; j < OFONO_MAX_MCC_LENGTH; j++)
+				mcc[j] = "12"[g_rand_int_range(rand, 0, 2)];
+
+			for (j = 0; j < mnc_len; j++)
+				mnc[j] = "12"[g_rand_int_range(rand, 0, 2)];
+
+			expect = eons_ref_lookup(ref, n, mcc, mnc,
+							have_lac, lac);
+
+			if (have_lac)
+				info = sim_eons_lookup_with_lac(eons, mcc, mnc,
+								lac);
+			else
+				info = sim_eons_lookup(eons, mcc, mnc);
+
+			if (expect == 0) {
+				g_assert(info == NULL);
+				continue;
+			}
+
+			g_assert(info);
+			g_assert(info->longname);
+			g_assert(info->longname[0] == 'A' + expect - 1);
+		}
+
+		sim_eons_free(eons);
+	}
+
+	g_rand_free(rand);
+}
+
 static void test_ef_db(void)
 {
 	struct sim_ef_info *info;
@@ -753,6 +1106,7 @@ int main(int argc, char **argv)
 	g_test_init(&argc, &argv, NULL);
 
 	g_test_add_func("/testsimutil/ber tlv iter", test_ber_tlv_iter);
+	g_test_add_func("/testsimutil/ber tlv index", test_tlv_index);
 	g_test_add_func("/testsimutil/ber tlv validate utf8", test_validate_tlv);
 	g_test_add_func("/testsimutil/ber tlv encode MMS",
 			test_ber_tlv_builder_mms);
@@ -761,6 +1115,9 @@ int main(int argc, char **argv)
 	g_test_add_func("/testsimutil/ber tlv encode 3G Status response",
 			test_ber_tlv_builder_3g_status);
 	g_test_add_func("/testsimutil/EONS Handling", test_eons);
+	g_test_add_func("/testsimutil/EONS OPL index", test_eons_opl_index);
+	g_test_add_func("/testsimutil/EONS partial OPL",
+					test_eons_partial_opl);
 	g_test_add_func("/testsimutil/Elementary File DB", test_ef_db);
 	g_test_add_func("/testsimutil/3G Status response", test_3g_status_data);
 	g_test_add_func("/testsimutil/Application entries decoding",
@@ -116,12 +116,79 @@ static void test_serialize_assembly(void)
 	sms_assembly_free(assembly);
 }
 
+static void test_serialize_sr_assembly(void)
+{
+	struct status_report_assembly *sra;
+	struct sms_address addr;
+	struct sms sr;
+	unsigned char msgid[SMS_MSGID_LEN];
+	unsigned char id[SMS_MSGID_LEN];
+	gboolean delivered;
+	unsigned int i;
+
+	__sms_address_from_string(&addr, "+4915259911630");
+
+	sra = status_report_assembly_new("1234");
+
+	/* Two part messages, both parts are sent before syncing */
+	for (i = 0; i < 100; i++) {
+		memset(msgid, i, sizeof(msgid));
+
+		status_report_assembly_add_fragment(sra, msgid, &addr,
+						2 * i, time(NULL), 2);
+		status_report_assembly_add_fragment(sra, msgid, &addr,
+						2 * i + 1, time(NULL), 2);
+	}
+
+	g_assert(status_report_assembly_needs_sync(sra));
+	status_report_assembly_sync(sra);
+	g_assert(!status_report_assembly_needs_sync(sra));
+
+	memset(&sr, 0, sizeof(sr));
+	sr.type = SMS_TYPE_STATUS_REPORT;
+	sr.status_report.raddr = addr;
+	sr.status_report.st = SMS_ST_COMPLETED_RECEIVED;
+
+	/* Report the first part of every message */
+	for (i = 0; i < 100; i++) {
+		sr.status_report.mr = 2 * i;
+		g_assert(!status_report_assembly_report(sra, &sr, id,
+								&delivered));
+	}
+
+	status_report_assembly_free(sra);
+
+	/* Restore from the log and report the remaining parts */
+	sra = status_report_assembly_new("1234");
+
+	g_assert(g_hash_table_size(sra->mr_table) == 100);
+
+	for (i = 0; i < 100; i++) {
+		sr.status_report.mr = 2 * i + 1;
+		g_assert(status_report_assembly_report(sra, &sr, id,
+								&delivered));
+
+		memset(msgid, i, sizeof(msgid));
+		g_assert(memcmp(id, msgid, SMS_MSGID_LEN) == 0);
+		g_assert(delivered == TRUE);
+	}
+
+	status_report_assembly_free(sra);
+
+	/* Everything was delivered, nothing is restored */
+	sra = status_report_assembly_new("1234");
+	g_assert(g_hash_table_size(sra->assembly_table) == 0);
+	status_report_assembly_free(sra);
+}
+
 int main(int argc, char **argv)
 {
 	g_test_init(&argc, &argv, NULL);
 
 	g_test_add_func("/testsms/Test SMS Assembly Serialize",
 			test_serialize_assembly);
+	g_test_add_func("/testsms/Test Status Report Assembly Serialize",
+			test_serialize_sr_assembly);
 
 	return g_test_run();
 }
@@ -35,23 +35,9 @@
 #include "util.h"
 #include "smsutil.h"
 
-static const bool VERBOSE = false;
+#include "sms-test-data.h"
 
-static const char *simple_deliver = "07911326040000F0"
-		"040B911346610089F60000208062917314480CC8F71D14969741F977FD07";
-static const char *alnum_sender = "0791447758100650"
-		"040DD0F334FC1CA6970100008080312170224008D4F29CDE0EA7D9";
-static const char *unicode_deliver = "04819999990414D0FBFD7EBFDFEFF77BFE1E001"
-		"9512090801361807E00DC00FC00C400E400D600F600C500E500D800F800C"
-		"600E600C700E700C900E900CA00EA00DF003100320033003400350036003"
-		"7003800390030002000540068006900730020006D0065007300730061006"
-		"7006500200069007300200036003300200075006E00690063006F0064006"
-		"5002000630068006100720073002E";
-static const char *simple_submit = "0011000B916407281553F80000AA"
-		"0AE8329BFD4697D9EC37";
-
-static const char *simple_mwi = "07913366002020F8040B913366600600F100C8318070"
-				"6174148000";
+static const bool VERBOSE = false;
 
 static void print_scts(struct sms_scts *scts, const char *prefix)
 {
@@ -572,7 +558,7 @@ static void test_simple_mwi(void)
 }
 
 struct sms_charset_data {
-	char *pdu;
+	const char *pdu;
 	int data_len;
 	enum gsm_dialect locking_lang;
 	enum gsm_dialect single_lang;
@@ -580,13 +566,7 @@ struct sms_charset_data {
 };
 
 static struct sms_charset_data sms_charset_default = {
-	.pdu =
-		"0001000B91" "5310101010" "1000008080" "8060402818" "0E888462C1"
-		"68381E9088" "6442A9582E" "988C06C4E9" "783EA09068" "442A994EA8"
-		"946AC56AB9" "5EB0986C46" "ABD96EB89C" "6EC7EBF97E" "C0A070482C"
-		"1A8FC8A472" "C96C3A9FD0" "A8744AAD5A" "AFD8AC76CB" "ED7ABFE0B0"
-		"784C2E9BCF" "E8B47ACD6E" "BBDFF0B87C" "4EAFDBEFF8" "BC7ECFEFFB"
-		"FF",
+	.pdu = charset_default_pdu,
 	.data_len = 112,
 	.expected_text = {
 		0x40, 0xc2, 0xa3, 0x24, 0xc2, 0xa5, 0xc3, 0xa8, 0xc3, 0xa9,
@@ -610,9 +590,7 @@ static struct sms_charset_data sms_charset_default = {
 };
 
 static struct sms_charset_data sms_charset_default_ext = {
-	.pdu =
-		"0001000B91" "5310101010" "100000151B" "C58602DAA0" "36A9CD6BC3"
-		"DBF436BE0D" "705306",
+	.pdu = charset_default_ext_pdu,
 	.data_len = 19,
 	.expected_text = {
 		0x0c, 0x5e, 0x20, 0x7b,	0x7d, 0x5c, 0x5b, 0x7e,	0x5d, 0x7c,
@@ -621,13 +599,7 @@ static struct sms_charset_data sms_charset_default_ext = {
 };
 
 static struct sms_charset_data sms_charset_turkey = {
-	.pdu =
-		"0001000B91" "5310101010" "1000008080" "8060402818" "0E888462C1"
-		"68381E9088" "6442A9582E" "988C06C4E9" "783EA09068" "442A994EA8"
-		"946AC56AB9" "5EB0986C46" "ABD96EB89C" "6EC7EBF97E" "C0A070482C"
-		"1A8FC8A472" "C96C3A9FD0" "A8744AAD5A" "AFD8AC76CB" "ED7ABFE0B0"
-		"784C2E9BCF" "E8B47ACD6E" "BBDFF0B87C" "4EAFDBEFF8" "BC7ECFEFFB"
-		"FF",
+	.pdu = charset_turkey_pdu,
 	.data_len = 112,
 	.locking_lang = GSM_DIALECT_TURKISH,
 	.expected_text = {
@@ -652,9 +624,7 @@ static struct sms_charset_data sms_charset_turkey = {
 };
 
 static struct sms_charset_data sms_charset_turkey_ext = {
-	.pdu =
-		"0001000B91" "5310101010" "1000001A1B" "C586B2416D" "529BD786B7"
-		"E96D7C1BE0" "02C8011318" "870E",
+	.pdu = charset_turkey_ext_pdu,
 	.data_len = 23,
 	.locking_lang = GSM_DIALECT_TURKISH,
 	.single_lang = GSM_DIALECT_TURKISH,
@@ -666,13 +636,7 @@ static struct sms_charset_data sms_charset_turkey_ext = {
 };
 
 static struct sms_charset_data sms_charset_portugal = {
-	.pdu =
-		"0001000B91" "5310101010" "1000008080" "8060402818" "0E888462C1"
-		"68381E9088" "6442A9582E" "988C06C4E9" "783EA09068" "442A994EA8"
-		"946AC56AB9" "5EB0986C46" "ABD96EB89C" "6EC7EBF97E" "C0A070482C"
-		"1A8FC8A472" "C96C3A9FD0" "A8744AAD5A" "AFD8AC76CB" "ED7ABFE0B0"
-		"784C2E9BCF" "E8B47ACD6E" "BBDFF0B87C" "4EAFDBEFF8" "BC7ECFEFFB"
-		"FF",
+	.pdu = charset_portugal_pdu,
 	.data_len = 112,
 	.locking_lang = GSM_DIALECT_PORTUGUESE,
 	.expected_text = {
@@ -697,10 +661,7 @@ static struct sms_charset_data sms_charset_portugal = {
 };
 
 static struct sms_charset_data sms_charset_portugal_ext = {
-	.pdu =
-		"0001000B91" "5310101010" "1000003184" "C446B16038" "1E1BC96662"
-		"D9543696CD" "6583D9643C" "1BD42675D9" "F0C01B9F86" "02CC74B75C"
-		"0EE68030EC" "F91D",
+	.pdu = charset_portugal_ext_pdu,
 	.data_len = 43,
 	.locking_lang = GSM_DIALECT_PORTUGUESE,
 	.single_lang = GSM_DIALECT_PORTUGUESE,
@@ -716,9 +677,7 @@ static struct sms_charset_data sms_charset_portugal_ext = {
 };
 
 static struct sms_charset_data sms_charset_spain = {
-	.pdu =
-		"0001000B91" "5310101010" "100000269B" "C446B1A16C" "509BD4E6B5"
-		"E16D7A1BDF" "06B8096E92" "9BE7A6BA09" "6FCA9BF4E6" "BDA903",
+	.pdu = charset_spain_pdu,
 	.data_len = 34,
 	.locking_lang = GSM_DIALECT_SPANISH,
 	.single_lang = GSM_DIALECT_SPANISH,
@@ -794,10 +753,7 @@ struct ems_udh_test {
 };
 
 static struct ems_udh_test ems_udh_test_1 = {
-	.pdu = "0041000B915121551532F40000631A0A031906200A032104100A03270504"
-		"0A032E05080A043807002B8ACD29A85D9ECFC3E7F21C340EBB41E3B79B1"
-		"E4EBB41697A989D1EB340E2379BCC02B1C3F27399059AB7C36C3628EC26"
-		"83C66FF65B5E2683E8653C1D",
+	.pdu = ems_udh_pdu_1,
 	.len = 100,
 	.expected = "EMS messages can contain italic, bold, large, small and"
 		" colored text",
@@ -843,11 +799,7 @@ static struct ems_udh_test ems_udh_test_1 = {
 };
 
 static struct ems_udh_test ems_udh_test_2 = {
-	.pdu = "079194712272303351030B915121340195F60000FF80230A030F07230A031"
-		"806130A031E0A430A032E0D830A033D14020A035104F60A0355010600159"
-		"D9E83D2735018442FCFE98A243DCC4E97C92C90F8CD26B3407537B92C67A"
-		"7DD65320B1476934173BA3CBD2ED3D1F277FD8C76299CEF3B280C92A7CF6"
-		"83A28CC4E9FDD6532E8FE96935D",
+	.pdu = ems_udh_pdu_2,
 	.len = 126,
 	.expected = "This is a test\nItalied, bold, underlined, and "
 		"strikethrough.\nNow a right aligned word.",
@@ -984,33 +936,10 @@ static void test_ems_udh(gconstpointer data)
 	l_free(utf8);
 }
 
-static const char *assembly_pdu1 = "038121F340048155550119906041001222048C0500"
-					"031E0301041804420430043A002C002004100"
-					"43B0435043A04410430043D04340440002000"
-					"200441043B044304480430043B00200437043"
-					"000200434043204350440044C044E00200020"
-					"04380020002004320441043500200431043E0"
-					"43B044C044804350020043F04400435043804"
-					"41043F043E043B043D044F043B0441044F002"
-					"000200433043D0435";
 static int assembly_pdu_len1 = 155;
 
-static const char *assembly_pdu2 = "038121F340048155550119906041001222048C0500"
-					"031E03020432043E043C002E000A041D04300"
-					"43A043E043D04350446002C0020043D043500"
-					"200432002004410438043B043004450020043"
-					"40430043B043504350020044204350440043F"
-					"04350442044C002C0020043E043D002004410"
-					"44204400435043C043804420435043B044C04"
-					"3D043E002004320431043504360430043B002"
-					"004320020043A043E";
 static int assembly_pdu_len2 = 155;
 
-static const char *assembly_pdu3 = "038121F340048155550119906041001222044A0500"
-					"031E0303043C043D043004420443002C00200"
-					"43F043E043704300431044B0432000A043404"
-					"3004360435002C002004470442043E0020002"
-					"00431044B043B0020043D04300433002E";
 static int assembly_pdu_len3 = 89;
 
 static void test_assembly(void)
@@ -1097,8 +1026,6 @@ static void test_assembly(void)
 }
 
 static const char *test_no_fragmentation_7bit = "This is testing !";
-static const char *expected_no_fragmentation_7bit = "079153485002020911000C915"
-			"348870420140000A71154747A0E4ACF41F4F29C9E769F4121";
 static const char *sc_addr = "+358405202090";
 static const char *da_addr = "+358478400241";
 static void test_prepare_7bit(void)
@@ -1310,17 +1237,67 @@ static void test_prepare_limits(void)
 	test_limit(ucs2, target_size, FALSE);
 }
 
-static const char *cbs1 = "011000320111C2327BFC76BBCBEE46A3D168341A8D46A3D1683"
-	"41A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D168"
-	"341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D100";
+static void test_tx_msgid(void)
+{
+	/* A SendMessages batch with the same message queued twice */
+	static const char *batch[][2] = {
+		{ "+15554449999", "Hello" },
+		{ "+15554449999", "Hello" },
+		{ "+15554448888", "Hello" },
+	};
+	unsigned char msgid[G_N_ELEMENTS(batch)][SMS_MSGID_LEN];
+	unsigned char again[SMS_MSGID_LEN];
+	GSList *lists[G_N_ELEMENTS(batch)];
+	gint64 now = g_get_real_time();
+	unsigned int i, j;
+
+	/* All queued within the same microsecond, with consecutive ids */
+	for (i = 0; i < G_N_ELEMENTS(batch); i++) {
+		lists[i] = sms_text_prepare(batch[i][0], batch[i][1], 0,
+						FALSE, FALSE);
+		g_assert(lists[i]);
+
+		sms_tx_msgid(lists[i], i, now, msgid[i]);
+	}
+
+	for (i = 0; i < G_N_ELEMENTS(batch); i++)
+		for (j = i + 1; j < G_N_ELEMENTS(batch); j++)
+			g_assert(memcmp(msgid[i], msgid[j], SMS_MSGID_LEN));
+
+	/* The id only depends on the PDUs, the sequence number and time */
+	sms_tx_msgid(lists[1], 0, now, again);
+	g_assert(!memcmp(msgid[0], again, SMS_MSGID_LEN));
+
+	sms_tx_msgid(lists[0], 0, now + 1, again);
+	g_assert(memcmp(msgid[0], again, SMS_MSGID_LEN));
+
+	for (i = 0; i < G_N_ELEMENTS(batch); i++)
+		g_slist_free_full(lists[i], g_free);
+}
+
+static void test_corpus(void)
+{
+	unsigned char pdu[176];
+	long pdu_len;
+	struct sms sms;
+	struct cbs cbs;
+	unsigned int i;
+
+	/* Every vector shared with unit/bench-pdu must decode */
+	for (i = 0; i < L_ARRAY_SIZE(sms_test_pdus); i++) {
+		const struct sms_test_pdu *test = &sms_test_pdus[i];
 
-static const char *cbs2 = "0110003201114679785E96371A8D46A3D168341A8D46A3D1683"
-	"41A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D168"
-	"341A8D46A3D168341A8D46A3D168341A8D46A3D168341A8D46A3D100";
+		g_assert(decode_hex_own_buf(test->hex, -1, &pdu_len, 0, pdu));
+		g_assert(sms_decode(pdu, pdu_len, test->outgoing,
+						test->tpdu_len, &sms));
+	}
 
-static const char *cbs3 = "001000000111E280604028180E888462C168381E90886442A95"
-	"82E988C66C3E9783EA09068442A994EA8946AC56AB95EB0986C46ABD96EB89C6EC7EBF"
-	"97EC0A070482C1A8FC8A472C96C3A9FD0A8744AAD5AAFD8AC76CB05";
+	for (i = 0; i < L_ARRAY_SIZE(cbs_test_pdus); i++) {
+		g_assert(decode_hex_own_buf(cbs_test_pdus[i], -1, &pdu_len,
+								0, pdu));
+		g_assert(cbs_decode(pdu, pdu_len, &cbs));
+	}
+}
 
 static void test_cbs_encode_decode(void)
 {
@@ -1410,14 +1387,14 @@ static void test_cbs_assembly(void)
 	/* Add an initial page to the assembly */
 	l = cbs_assembly_add_page(assembly, &dec1);
 	g_assert(l);
-	g_assert(g_slist_length(assembly->recv_cell) == 1);
+	g_assert(g_hash_table_size(assembly->recv_cell) == 1);
 	g_slist_free_full(l, g_free);
 
 	/* Can we receive new updates ? */
 	dec1.update_number = 8;
 	l = cbs_assembly_add_page(assembly, &dec1);
 	g_assert(l);
-	g_assert(g_slist_length(assembly->recv_cell) == 1);
+	g_assert(g_hash_table_size(assembly->recv_cell) == 1);
 	g_slist_free_full(l, g_free);
 
 	/* Do we ignore old pages ? */
@@ -1430,7 +1407,7 @@ static void test_cbs_assembly(void)
 	g_assert(l == NULL);
 
 	cbs_assembly_location_changed(assembly, TRUE, TRUE, TRUE);
-	g_assert(assembly->recv_cell == NULL);
+	g_assert(g_hash_table_size(assembly->recv_cell) == 0);
 
 	dec1.update_number = 9;
 	dec1.page = 3;
@@ -1469,6 +1446,77 @@ static void test_cbs_assembly(void)
 	cbs_assembly_free(assembly);
 }
 
+#define CBS_STORM_TOPICS 64
+#define CBS_STORM_PAGES 3
+#define CBS_STORM_ROUNDS 50
+
+/*
+ * Replay a public warning flood: all pages of every topic are repeated
+ * each round, interleaved across topics.  Halfway through the messages
+ * are updated, so every topic has to complete exactly twice.
+ */
+static void test_cbs_storm(void)
+{
+	unsigned char *decoded_pdu;
+	size_t pdu_len;
+	struct cbs page;
+	struct cbs_assembly *assembly;
+	unsigned int completed = 0;
+	unsigned int pages = 0;
+	unsigned int round;
+	unsigned int topic;
+	unsigned int i;
+	double elapsed;
+	GSList *l;
+
+	decoded_pdu = l_util_from_hexstring(cbs1, &pdu_len);
+	g_assert(cbs_decode(decoded_pdu, pdu_len, &page));
+	l_free(decoded_pdu);
+
+	assembly = cbs_assembly_new();
+	page.max_pages = CBS_STORM_PAGES;
+
+	g_test_timer_start();
+
+	for (round = 0; round < CBS_STORM_ROUNDS; round++) {
+		page.update_number = round < CBS_STORM_ROUNDS / 2 ? 1 : 2;
+
+		for (i = 1; i <= CBS_STORM_PAGES; i++) {
+			page.page = i;
+
+			for (topic = 0; topic < CBS_STORM_TOPICS; topic++) {
+				page.message_identifier = 4352 + topic;
+
+				l = cbs_assembly_add_page(assembly, &page);
+				pages += 1;
+
+				if (l == NULL)
+					continue;
+
+				g_assert(g_slist_length(l) == CBS_STORM_PAGES);
+				completed += 1;
+				g_slist_free_full(l, g_free);
+			}
+		}
+	}
+
+	elapsed = g_test_timer_elapsed();
+
+	g_assert(completed == 2 * CBS_STORM_TOPICS);
+	g_assert(g_hash_table_size(assembly->assembly_table) == 0);
+	g_assert(g_hash_table_size(assembly->recv_cell) +
+			g_hash_table_size(assembly->recv_loc) +
+			g_hash_table_size(assembly->recv_plmn) ==
+			CBS_STORM_TOPICS);
+
+	if (g_test_perf())
+		g_test_minimized_result(elapsed * 1e9 / pages,
+					"%u pages, %.1f ns/page", pages,
+					elapsed * 1e9 / pages);
+
+	cbs_assembly_free(assembly);
+}
+
 static void test_cbs_padding_character(void)
 {
 	unsigned char *decoded_pdu;
@@ -1555,14 +1603,49 @@ static void test_range_minimizer(void)
 	}
 }
 
+static void test_topic_index(void)
+{
+	struct cbs_topic_range unsorted[] = {
+		{ 900, 999 }, { 4352, 4356 }, { 1, 5 }, { 6, 6 }, { 950, 960 },
+	};
+	struct cbs_topic_index *index;
+	GSList *l = NULL;
+	unsigned int topic;
+	unsigned int i;
+
+	g_assert(!cbs_topic_index_contains(NULL, 0));
+
+	for (i = 0; ranges[i]; i++) {
+		GSList *r = cbs_extract_topic_ranges(ranges[i]);
+
+		index = cbs_topic_index_new(r);
+
+		for (topic = 0; topic < 65536; topic++)
+			g_assert(cbs_topic_index_contains(index, topic) ==
+					cbs_topic_in_range(topic, r));
+
+		cbs_topic_index_free(index);
+		g_slist_free_full(r, g_free);
+	}
+
+	for (i = 0; i < L_ARRAY_SIZE(unsorted); i++)
+		l = g_slist_prepend(l, &unsorted[i]);
+
+	index = cbs_topic_index_new(l);
+
+	/* 1-5 and 6 are adjacent, 950-960 is contained in 900-999 */
+	g_assert(index->len == 3);
+
+	for (topic = 0; topic < 65536; topic++)
+		g_assert(cbs_topic_index_contains(index, topic) ==
+					cbs_topic_in_range(topic, l));
+
+	cbs_topic_index_free(index);
+	g_slist_free(l);
+}
+
 static void test_sr_assembly(void)
 {
-	const char *sr_pdu1 = "06040D91945152991136F00160124130340A0160124130"
-				"940A00";
-	const char *sr_pdu2 = "06050D91945152991136F00160124130640A0160124130"
-				"450A00";
-	const char *sr_pdu3 = "0606098121436587F9019012413064A0019012413045A0"
-				"00";
         struct sms sr1;
 	struct sms sr2;
 	struct sms sr3;
@@ -1653,17 +1736,64 @@ static void test_sr_assembly(void)
 	status_report_assembly_free(sra);
 }
 
+static void test_sr_assembly_mr_reuse(void)
+{
+	struct status_report_assembly *sra;
+	struct sms_address addr;
+	struct sms sr;
+	unsigned char msgid[SMS_MSGID_LEN];
+	unsigned char id[SMS_MSGID_LEN];
+	gboolean delivered;
+	unsigned int i;
+
+	__sms_address_from_string(&addr, "+4915259911630");
+
+	sra = status_report_assembly_new(NULL);
+
+	/* More single part messages than there are message references */
+	for (i = 0; i < 300; i++) {
+		memset(msgid, 0, sizeof(msgid));
+		msgid[0] = i & 0xff;
+		msgid[1] = i >> 8;
+
+		status_report_assembly_add_fragment(sra, msgid, &addr,
+							i % 256, time(NULL), 1);
+	}
+
+	g_assert(g_hash_table_size(sra->mr_table) == 256);
+
+	memset(&sr, 0, sizeof(sr));
+	sr.type = SMS_TYPE_STATUS_REPORT;
+	sr.status_report.raddr = addr;
+	sr.status_report.st = SMS_ST_COMPLETED_RECEIVED;
+
+	/* A reused reference is matched against the oldest message first */
+	for (i = 0; i < 300; i++) {
+		sr.status_report.mr = i % 256;
+
+		g_assert(status_report_assembly_report(sra, &sr, id,
+								&delivered));
+		g_assert(id[0] == (i & 0xff));
+		g_assert(id[1] == i >> 8);
+		g_assert(delivered == TRUE);
+	}
+
+	g_assert(g_hash_table_size(sra->assembly_table) == 0);
+	g_assert(g_hash_table_size(sra->mr_table) == 0);
+
+	/* No message is left to match */
+	g_assert(!status_report_assembly_report(sra, &sr, id, &delivered));
+
+	status_report_assembly_free(sra);
+}
+
 struct wap_push_data {
 	const char *pdu;
 	int len;
 };
 
 static struct wap_push_data wap_push_1 = {
-	.pdu = "0791947122725014440185F039F501801140311480720605040B8423F00106"
-		"246170706C69636174696F6E2F766E642E7761702E6D6D732D6D657373616"
-		"76500AF84B4868C82984F67514B4B42008D9089088045726F74696B009650"
-		"696E2D557073008A808E0240008805810303F48083687474703A2F2F65707"
-		"3332E64652F4F2F5A39495A4F00",
+	.pdu = wap_push_pdu_1,
 	.len = 128,
 };
 
@@ -1799,17 +1929,23 @@ int main(int argc, char **argv)
 			&long_string_test, test_prepare_concat);
 
 	g_test_add_func("/testsms/Test Prepare Limits", test_prepare_limits);
+	g_test_add_func("/testsms/Test TX Message Id", test_tx_msgid);
+	g_test_add_func("/testsms/Test Corpus", test_corpus);
 
 	g_test_add_func("/testsms/Test CBS Encode / Decode",
 			test_cbs_encode_decode);
 	g_test_add_func("/testsms/Test CBS Assembly", test_cbs_assembly);
+	g_test_add_func("/testsms/Test CBS Storm", test_cbs_storm);
 
 	g_test_add_func("/testsms/Test CBS Padding Character",
 			test_cbs_padding_character);
 
 	g_test_add_func("/testsms/Range minimizer", test_range_minimizer);
+	g_test_add_func("/testsms/Topic index", test_topic_index);
 
 	g_test_add_func("/testsms/Status Report Assembly", test_sr_assembly);
+	g_test_add_func("/testsms/Status Report MR Reuse",
+			test_sr_assembly_mr_reuse);
 
 	g_test_add_data_func("/testsms/Test WAP Push 1", &wap_push_1,
 				test_wap_push);
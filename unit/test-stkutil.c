@@ -885,126 +885,6 @@ struct get_inkey_test {
 	char *html;
 };
 
-static unsigned char get_inkey_711[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x80, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x2B, 0x22 };
-
-static unsigned char get_inkey_712[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x80, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x2B, 0x22 };
-
-static unsigned char get_inkey_912[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_922[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_932[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_942[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22, 0xD0, 0x04, 0x00,
-						0x09, 0x00, 0xB4 };
-
-static unsigned char get_inkey_943[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_952[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22, 0xD0, 0x04, 0x00,
-						0x09, 0x00, 0xB4 };
-
-static unsigned char get_inkey_953[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_962[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22, 0xD0, 0x04, 0x00,
-						0x09, 0x00, 0xB4 };
-
-static unsigned char get_inkey_963[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_972[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22, 0xD0, 0x04, 0x00,
-						0x09, 0x00, 0xB4 };
-
-static unsigned char get_inkey_973[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_982[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22, 0xD0, 0x04, 0x00,
-						0x09, 0x00, 0xB4 };
-
-static unsigned char get_inkey_983[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_992a[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22, 0xD0, 0x04, 0x00,
-						0x09, 0x00, 0xB4 };
-
-static unsigned char get_inkey_992b[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_993[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
-static unsigned char get_inkey_9102[] = { 0xD0, 0x15, 0x81, 0x03, 0x01, 0x22,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0A, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x22,
-						0x23, 0x22 };
-
 static struct get_inkey_test get_inkey_data_111 = {
 	.pdu = get_inkey_111,
 	.pdu_len = sizeof(get_inkey_111),
@@ -1547,131 +1427,6 @@ struct get_input_test {
 	char *html;
 };
 
-static unsigned char get_input_711[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x80, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x31,
-						0x32, 0x33, 0x34, 0x35, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_812[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_822[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_832[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_842[] = { 0xD0, 0x21, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05, 0xD0, 0x04,
-						0x00, 0x0B, 0x00, 0xB4 };
-
-static unsigned char get_input_843[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x33,
-						0x33, 0x33, 0x33, 0x33, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_852[] = { 0xD0, 0x21, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05, 0xD0, 0x04,
-						0x00, 0x0B, 0x00, 0xB4 };
-
-static unsigned char get_input_853[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x33,
-						0x33, 0x33, 0x33, 0x33, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_862[] = { 0xD0, 0x21, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05, 0xD0, 0x04,
-						0x00, 0x0B, 0x00, 0xB4 };
-
-static unsigned char get_input_863[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x33,
-						0x33, 0x33, 0x33, 0x33, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_872[] = { 0xD0, 0x21, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05, 0xD0, 0x04,
-						0x00, 0x0B, 0x00, 0xB4 };
-
-static unsigned char get_input_873[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x33,
-						0x33, 0x33, 0x33, 0x33, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_882[] = { 0xD0, 0x21, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05, 0xD0, 0x04,
-						0x00, 0x0B, 0x00, 0xB4 };
-
-static unsigned char get_input_883[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x33,
-						0x33, 0x33, 0x33, 0x33, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_892[] = { 0xD0, 0x21, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05, 0xD0, 0x04,
-						0x00, 0x0B, 0x00, 0xB4 };
-
-static unsigned char get_input_893[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x33,
-						0x33, 0x33, 0x33, 0x33, 0x91,
-						0x02, 0x05, 0x05 };
-
-static unsigned char get_input_8102[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x23,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x8D, 0x0C, 0x04, 0x45, 0x6E,
-						0x74, 0x65, 0x72, 0x20, 0x32,
-						0x32, 0x32, 0x32, 0x32, 0x91,
-						0x02, 0x05, 0x05 };
-
 static struct get_input_test get_input_data_111 = {
 	.pdu = get_input_111,
 	.pdu_len = sizeof(get_input_111),
@@ -3356,614 +3111,6 @@ struct setup_menu_test {
 	char *html;
 };
 
-static unsigned char setup_menu_111[] = { 0xD0, 0x3B, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32, 0x8F, 0x07, 0x03,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x33, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34 };
-
-static unsigned char setup_menu_112[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x04, 0x11, 0x4F, 0x6E, 0x65,
-						0x8F, 0x04, 0x12, 0x54, 0x77,
-						0x6F };
-
-static unsigned char setup_menu_113[] = { 0xD0, 0x0D, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x00 };
-
-static unsigned char setup_menu_121[] = { 0xD0, 0x81, 0xFC, 0x81, 0x03, 0x01,
-						0x25, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x4C, 0x61,
-						0x72, 0x67, 0x65, 0x4D, 0x65,
-						0x6E, 0x75, 0x31, 0x8F, 0x05,
-						0x50, 0x5A, 0x65, 0x72, 0x6F,
-						0x8F, 0x04, 0x4F, 0x4F, 0x6E,
-						0x65, 0x8F, 0x04, 0x4E, 0x54,
-						0x77, 0x6F, 0x8F, 0x06, 0x4D,
-						0x54, 0x68, 0x72, 0x65, 0x65,
-						0x8F, 0x05, 0x4C, 0x46, 0x6F,
-						0x75, 0x72, 0x8F, 0x05, 0x4B,
-						0x46, 0x69, 0x76, 0x65, 0x8F,
-						0x04, 0x4A, 0x53, 0x69, 0x78,
-						0x8F, 0x06, 0x49, 0x53, 0x65,
-						0x76, 0x65, 0x6E, 0x8F, 0x06,
-						0x48, 0x45, 0x69, 0x67, 0x68,
-						0x74, 0x8F, 0x05, 0x47, 0x4E,
-						0x69, 0x6E, 0x65, 0x8F, 0x06,
-						0x46, 0x41, 0x6C, 0x70, 0x68,
-						0x61, 0x8F, 0x06, 0x45, 0x42,
-						0x72, 0x61, 0x76, 0x6F, 0x8F,
-						0x08, 0x44, 0x43, 0x68, 0x61,
-						0x72, 0x6C, 0x69, 0x65, 0x8F,
-						0x06, 0x43, 0x44, 0x65, 0x6C,
-						0x74, 0x61, 0x8F, 0x05, 0x42,
-						0x45, 0x63, 0x68, 0x6F, 0x8F,
-						0x09, 0x41, 0x46, 0x6F, 0x78,
-						0x2D, 0x74, 0x72, 0x6F, 0x74,
-						0x8F, 0x06, 0x40, 0x42, 0x6C,
-						0x61, 0x63, 0x6B, 0x8F, 0x06,
-						0x3F, 0x42, 0x72, 0x6F, 0x77,
-						0x6E, 0x8F, 0x04, 0x3E, 0x52,
-						0x65, 0x64, 0x8F, 0x07, 0x3D,
-						0x4F, 0x72, 0x61, 0x6E, 0x67,
-						0x65, 0x8F, 0x07, 0x3C, 0x59,
-						0x65, 0x6C, 0x6C, 0x6F, 0x77,
-						0x8F, 0x06, 0x3B, 0x47, 0x72,
-						0x65, 0x65, 0x6E, 0x8F, 0x05,
-						0x3A, 0x42, 0x6C, 0x75, 0x65,
-						0x8F, 0x07, 0x39, 0x56, 0x69,
-						0x6F, 0x6C, 0x65, 0x74, 0x8F,
-						0x05, 0x38, 0x47, 0x72, 0x65,
-						0x79, 0x8F, 0x06, 0x37, 0x57,
-						0x68, 0x69, 0x74, 0x65, 0x8F,
-						0x06, 0x36, 0x6D, 0x69, 0x6C,
-						0x6C, 0x69, 0x8F, 0x06, 0x35,
-						0x6D, 0x69, 0x63, 0x72, 0x6F,
-						0x8F, 0x05, 0x34, 0x6E, 0x61,
-						0x6E, 0x6F, 0x8F, 0x05, 0x33,
-						0x70, 0x69, 0x63, 0x6F };
-
-static unsigned char setup_menu_122[] = { 0xD0, 0x81, 0xF3, 0x81, 0x03, 0x01,
-						0x25, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x4C, 0x61,
-						0x72, 0x67, 0x65, 0x4D, 0x65,
-						0x6E, 0x75, 0x32, 0x8F, 0x1D,
-						0xFF, 0x31, 0x20, 0x43, 0x61,
-						0x6C, 0x6C, 0x20, 0x46, 0x6F,
-						0x72, 0x77, 0x61, 0x72, 0x64,
-						0x20, 0x55, 0x6E, 0x63, 0x6F,
-						0x6E, 0x64, 0x69, 0x74, 0x69,
-						0x6F, 0x6E, 0x61, 0x6C, 0x8F,
-						0x1C, 0xFE, 0x32, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x20, 0x46,
-						0x6F, 0x72, 0x77, 0x61, 0x72,
-						0x64, 0x20, 0x4F, 0x6E, 0x20,
-						0x55, 0x73, 0x65, 0x72, 0x20,
-						0x42, 0x75, 0x73, 0x79, 0x8F,
-						0x1B, 0xFD, 0x33, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x20, 0x46,
-						0x6F, 0x72, 0x77, 0x61, 0x72,
-						0x64, 0x20, 0x4F, 0x6E, 0x20,
-						0x4E, 0x6F, 0x20, 0x52, 0x65,
-						0x70, 0x6C, 0x79, 0x8F, 0x25,
-						0xFC, 0x34, 0x20, 0x43, 0x61,
-						0x6C, 0x6C, 0x20, 0x46, 0x6F,
-						0x72, 0x77, 0x61, 0x72, 0x64,
-						0x20, 0x4F, 0x6E, 0x20, 0x55,
-						0x73, 0x65, 0x72, 0x20, 0x4E,
-						0x6F, 0x74, 0x20, 0x52, 0x65,
-						0x61, 0x63, 0x68, 0x61, 0x62,
-						0x6C, 0x65, 0x8F, 0x20, 0xFB,
-						0x35, 0x20, 0x42, 0x61, 0x72,
-						0x72, 0x69, 0x6E, 0x67, 0x20,
-						0x4F, 0x66, 0x20, 0x41, 0x6C,
-						0x6C, 0x20, 0x4F, 0x75, 0x74,
-						0x67, 0x6F, 0x69, 0x6E, 0x67,
-						0x20, 0x43, 0x61, 0x6C, 0x6C,
-						0x73, 0x8F, 0x24, 0xFA, 0x36,
-						0x20, 0x42, 0x61, 0x72, 0x72,
-						0x69, 0x6E, 0x67, 0x20, 0x4F,
-						0x66, 0x20, 0x41, 0x6C, 0x6C,
-						0x20, 0x4F, 0x75, 0x74, 0x67,
-						0x6F, 0x69, 0x6E, 0x67, 0x20,
-						0x49, 0x6E, 0x74, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x73, 0x8F,
-						0x13, 0xF9, 0x37, 0x20, 0x43,
-						0x4C, 0x49, 0x20, 0x50, 0x72,
-						0x65, 0x73, 0x65, 0x6E, 0x74,
-						0x61, 0x74, 0x69, 0x6F, 0x6E };
-
-static unsigned char setup_menu_123[] = { 0xD0, 0x81, 0xFC, 0x81, 0x03, 0x01,
-						0x25, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x81, 0xEC, 0x54,
-						0x68, 0x65, 0x20, 0x53, 0x49,
-						0x4D, 0x20, 0x73, 0x68, 0x61,
-						0x6C, 0x6C, 0x20, 0x73, 0x75,
-						0x70, 0x70, 0x6C, 0x79, 0x20,
-						0x61, 0x20, 0x73, 0x65, 0x74,
-						0x20, 0x6F, 0x66, 0x20, 0x6D,
-						0x65, 0x6E, 0x75, 0x20, 0x69,
-						0x74, 0x65, 0x6D, 0x73, 0x2C,
-						0x20, 0x77, 0x68, 0x69, 0x63,
-						0x68, 0x20, 0x73, 0x68, 0x61,
-						0x6C, 0x6C, 0x20, 0x62, 0x65,
-						0x20, 0x69, 0x6E, 0x74, 0x65,
-						0x67, 0x72, 0x61, 0x74, 0x65,
-						0x64, 0x20, 0x77, 0x69, 0x74,
-						0x68, 0x20, 0x74, 0x68, 0x65,
-						0x20, 0x6D, 0x65, 0x6E, 0x75,
-						0x20, 0x73, 0x79, 0x73, 0x74,
-						0x65, 0x6D, 0x20, 0x28, 0x6F,
-						0x72, 0x20, 0x6F, 0x74, 0x68,
-						0x65, 0x72, 0x20, 0x4D, 0x4D,
-						0x49, 0x20, 0x66, 0x61, 0x63,
-						0x69, 0x6C, 0x69, 0x74, 0x79,
-						0x29, 0x20, 0x69, 0x6E, 0x20,
-						0x6F, 0x72, 0x64, 0x65, 0x72,
-						0x20, 0x74, 0x6F, 0x20, 0x67,
-						0x69, 0x76, 0x65, 0x20, 0x74,
-						0x68, 0x65, 0x20, 0x75, 0x73,
-						0x65, 0x72, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x6F, 0x70, 0x70,
-						0x6F, 0x72, 0x74, 0x75, 0x6E,
-						0x69, 0x74, 0x79, 0x20, 0x74,
-						0x6F, 0x20, 0x63, 0x68, 0x6F,
-						0x6F, 0x73, 0x65, 0x20, 0x6F,
-						0x6E, 0x65, 0x20, 0x6F, 0x66,
-						0x20, 0x74, 0x68, 0x65, 0x73,
-						0x65, 0x20, 0x6D, 0x65, 0x6E,
-						0x75, 0x20, 0x69, 0x74, 0x65,
-						0x6D, 0x73, 0x20, 0x61, 0x74,
-						0x20, 0x68, 0x69, 0x73, 0x20,
-						0x6F, 0x77, 0x6E, 0x20, 0x64,
-						0x69, 0x73, 0x63, 0x72, 0x65,
-						0x74, 0x69, 0x6F, 0x6E, 0x2E,
-						0x20, 0x45, 0x61, 0x63, 0x68,
-						0x20, 0x69, 0x74, 0x65, 0x6D,
-						0x20, 0x63, 0x6F, 0x6D, 0x70,
-						0x72, 0x69, 0x73, 0x65, 0x73,
-						0x20, 0x61, 0x20, 0x73, 0x68,
-						0x8F, 0x02, 0x01, 0x59 };
-
-static unsigned char setup_menu_211[] = { 0xD0, 0x3B, 0x81, 0x03, 0x01, 0x25,
-						0x80, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32, 0x8F, 0x07, 0x03,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x33, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34 };
-
-static unsigned char setup_menu_311[] = { 0xD0, 0x41, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32, 0x8F, 0x07, 0x03,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x33, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34,
-						0x18, 0x04, 0x13, 0x10, 0x15,
-						0x26 };
-
-static unsigned char setup_menu_411[] = { 0xD0, 0x3C, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32, 0x8F, 0x07, 0x03,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x33, 0x9E, 0x02, 0x01, 0x01,
-						0x9F, 0x04, 0x01, 0x05, 0x05,
-						0x05 };
-
-static unsigned char setup_menu_421[] = { 0xD0, 0x3C, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32, 0x8F, 0x07, 0x03,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x33, 0x9E, 0x02, 0x00, 0x01,
-						0x9F, 0x04, 0x00, 0x05, 0x05,
-						0x05 };
-
-static unsigned char setup_menu_511[] = { 0xD0, 0x29, 0x81, 0x03, 0x01, 0x25,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32 };
-
-static unsigned char setup_menu_611[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x00, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x00, 0xB4,
-						0x00, 0x06, 0x00, 0xB4, 0x00,
-						0x06, 0x00, 0xB4 };
-
-static unsigned char setup_menu_612[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x32, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34,
-						0x8F, 0x07, 0x05, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x35, 0x8F,
-						0x07, 0x06, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x36 };
-
-static unsigned char setup_menu_621[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x01, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x01, 0xB4,
-						0x00, 0x06, 0x01, 0xB4, 0x00,
-						0x06, 0x01, 0xB4 };
-
-static unsigned char setup_menu_622[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x32, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34,
-						0x8F, 0x07, 0x05, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x35, 0x8F,
-						0x07, 0x06, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x36 };
-
-static unsigned char setup_menu_631[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x02, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x02, 0xB4,
-						0x00, 0x06, 0x02, 0xB4, 0x00,
-						0x06, 0x02, 0xB4 };
-
-static unsigned char setup_menu_632[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x32, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34,
-						0x8F, 0x07, 0x05, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x35, 0x8F,
-						0x07, 0x06, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x36 };
-
-static unsigned char setup_menu_641[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x04, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x04, 0xB4,
-						0x00, 0x06, 0x04, 0xB4, 0x00,
-						0x06, 0x04, 0xB4 };
-
-static unsigned char setup_menu_642[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x32, 0x8F, 0x07, 0x04, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x34,
-						0x8F, 0x07, 0x05, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x35, 0x8F,
-						0x07, 0x06, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x36, 0xD0, 0x04,
-						0x00, 0x0E, 0x00, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x00, 0xB4,
-						0x00, 0x06, 0x00, 0xB4, 0x00,
-						0x06, 0x00, 0xB4 };
-
-static unsigned char setup_menu_643[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x33, 0x8F, 0x07, 0x07, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x37,
-						0x8F, 0x07, 0x08, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x38, 0x8F,
-						0x07, 0x09, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x39 };
-
-static unsigned char setup_menu_651[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x08, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x08, 0xB4,
-						0x00, 0x06, 0x08, 0xB4, 0x00,
-						0x06, 0x08, 0xB4 };
-
-static unsigned char setup_menu_661[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x10, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x10, 0xB4,
-						0x00, 0x06, 0x10, 0xB4, 0x00,
-						0x06, 0x10, 0xB4 };
-
-static unsigned char setup_menu_671[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x20, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x20, 0xB4,
-						0x00, 0x06, 0x20, 0xB4, 0x00,
-						0x06, 0x20, 0xB4 };
-
-static unsigned char setup_menu_681[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x40, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x40, 0xB4,
-						0x00, 0x06, 0x40, 0xB4, 0x00,
-						0x06, 0x40, 0xB4 };
-
-static unsigned char setup_menu_691[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x20,
-						0x31, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0xD0, 0x04,
-						0x00, 0x0E, 0x80, 0xB4, 0xD1,
-						0x0C, 0x00, 0x06, 0x80, 0xB4,
-						0x00, 0x06, 0x80, 0xB4, 0x00,
-						0x06, 0x80, 0xB4 };
-
-static unsigned char setup_menu_6101[] = { 0xD0, 0x46, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0C, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x4D, 0x65, 0x6E, 0x75, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31, 0x8F, 0x07,
-						0x02, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x32, 0x8F, 0x07, 0x03,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x33, 0xD0, 0x04, 0x00, 0x0C,
-						0x00, 0xB4, 0xD1, 0x0C, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4, 0x00, 0x06, 0x00,
-						0xB4 };
-
-static unsigned char setup_menu_711[] = { 0xD0, 0x81, 0x9C, 0x81, 0x03, 0x01,
-						0x25, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x19, 0x80, 0x04,
-						0x17, 0x04, 0x14, 0x04, 0x20,
-						0x04, 0x10, 0x04, 0x12, 0x04,
-						0x21, 0x04, 0x22, 0x04, 0x12,
-						0x04, 0x23, 0x04, 0x19, 0x04,
-						0x22, 0x04, 0x15, 0x8F, 0x1C,
-						0x01, 0x80, 0x04, 0x17, 0x04,
-						0x14, 0x04, 0x20, 0x04, 0x10,
-						0x04, 0x12, 0x04, 0x21, 0x04,
-						0x22, 0x04, 0x12, 0x04, 0x23,
-						0x04, 0x19, 0x04, 0x22, 0x04,
-						0x15, 0x00, 0x31, 0x8F, 0x1C,
-						0x02, 0x80, 0x04, 0x17, 0x04,
-						0x14, 0x04, 0x20, 0x04, 0x10,
-						0x04, 0x12, 0x04, 0x21, 0x04,
-						0x22, 0x04, 0x12, 0x04, 0x23,
-						0x04, 0x19, 0x04, 0x22, 0x04,
-						0x15, 0x00, 0x32, 0x8F, 0x1C,
-						0x03, 0x80, 0x04, 0x17, 0x04,
-						0x14, 0x04, 0x20, 0x04, 0x10,
-						0x04, 0x12, 0x04, 0x21, 0x04,
-						0x22, 0x04, 0x12, 0x04, 0x23,
-						0x04, 0x19, 0x04, 0x22, 0x04,
-						0x15, 0x00, 0x33, 0x8F, 0x1C,
-						0x04, 0x80, 0x04, 0x17, 0x04,
-						0x14, 0x04, 0x20, 0x04, 0x10,
-						0x04, 0x12, 0x04, 0x21, 0x04,
-						0x22, 0x04, 0x12, 0x04, 0x23,
-						0x04, 0x19, 0x04, 0x22, 0x04,
-						0x15, 0x00, 0x34 };
-
-static unsigned char setup_menu_712[] = { 0xD0, 0x60, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x8F, 0x1C, 0x11,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15,
-						0x00, 0x35, 0x8F, 0x1C, 0x12,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15,
-						0x00, 0x36 };
-
-static unsigned char setup_menu_713[] = { 0xD0, 0x0D, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x00 };
-
-static unsigned char setup_menu_811[] = { 0xD0, 0x3C, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x09, 0x80, 0x5D, 0xE5,
-						0x51, 0x77, 0x7B, 0xB1, 0x53,
-						0x55, 0x8F, 0x08, 0x01, 0x80,
-						0x98, 0x79, 0x76, 0xEE, 0x4E,
-						0x00, 0x8F, 0x08, 0x02, 0x80,
-						0x98, 0x79, 0x76, 0xEE, 0x4E,
-						0x8C, 0x8F, 0x08, 0x03, 0x80,
-						0x98, 0x79, 0x76, 0xEE, 0x4E,
-						0x09, 0x8F, 0x08, 0x04, 0x80,
-						0x98, 0x79, 0x76, 0xEE, 0x56,
-						0xDB };
-
-static unsigned char setup_menu_812[] = { 0xD0, 0x20, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x09, 0x80, 0x5D, 0xE5,
-						0x51, 0x77, 0x7B, 0xB1, 0x53,
-						0x55, 0x8F, 0x04, 0x11, 0x80,
-						0x4E, 0x00, 0x8F, 0x04, 0x12,
-						0x80, 0x4E, 0x8C };
-
-static unsigned char setup_menu_813[] = { 0xD0, 0x0D, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x00 };
-
-static unsigned char setup_menu_911[] = { 0xD0, 0x44, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x09, 0x80, 0x00, 0x38,
-						0x00, 0x30, 0x30, 0xEB, 0x00,
-						0x30, 0x8F, 0x0A, 0x01, 0x80,
-						0x00, 0x38, 0x00, 0x30, 0x30,
-						0xEB, 0x00, 0x31, 0x8F, 0x0A,
-						0x02, 0x80, 0x00, 0x38, 0x00,
-						0x30, 0x30, 0xEB, 0x00, 0x32,
-						0x8F, 0x0A, 0x03, 0x80, 0x00,
-						0x38, 0x00, 0x30, 0x30, 0xEB,
-						0x00, 0x33, 0x8F, 0x0A, 0x04,
-						0x80, 0x00, 0x38, 0x00, 0x30,
-						0x30, 0xEB, 0x00, 0x34 };
-
-static unsigned char setup_menu_912[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x09, 0x80, 0x00, 0x38,
-						0x00, 0x30, 0x30, 0xEB, 0x00,
-						0x30, 0x8F, 0x0A, 0x11, 0x80,
-						0x00, 0x38, 0x00, 0x30, 0x30,
-						0xEB, 0x00, 0x35, 0x8F, 0x0A,
-						0x12, 0x80, 0x00, 0x38, 0x00,
-						0x30, 0x30, 0xEB, 0x00, 0x36 };
-
-static unsigned char setup_menu_913[] = { 0xD0, 0x0D, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x00 };
-
-/* Negative case: No item is present */
-static unsigned char setup_menu_neg_1[] = { 0xD0, 0x0B, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00 };
-
-/* Negative case: Two empty items*/
-static unsigned char setup_menu_neg_2[] = { 0xD0, 0x0F, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x00, 0x8F,
-						0x00 };
-
-/* Negative case: valid item + empty item */
-static unsigned char setup_menu_neg_3[] = { 0xD0, 0x16, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x07, 0x01,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x31, 0x8F, 0x00 };
-
-/* Negative case: empty item + valid item */
-static unsigned char setup_menu_neg_4[] = { 0xD0, 0x16, 0x81, 0x03, 0x01, 0x25,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x00, 0x8F, 0x00, 0x8F,
-						0x07, 0x01, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x31 };
-
 static struct setup_menu_test setup_menu_data_111 = {
 	.pdu = setup_menu_111,
 	.pdu_len = sizeof(setup_menu_111),
@@ -4654,793 +3801,6 @@ struct select_item_test {
 	char *html;
 };
 
-static unsigned char select_item_111[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0x8F, 0x07,
-						0x04, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x34 };
-
-static unsigned char select_item_121[] = { 0xD0, 0x81, 0xFC, 0x81, 0x03, 0x01,
-						0x24, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x4C, 0x61,
-						0x72, 0x67, 0x65, 0x4D, 0x65,
-						0x6E, 0x75, 0x31, 0x8F, 0x05,
-						0x50, 0x5A, 0x65, 0x72, 0x6F,
-						0x8F, 0x04, 0x4F, 0x4F, 0x6E,
-						0x65, 0x8F, 0x04, 0x4E, 0x54,
-						0x77, 0x6F, 0x8F, 0x06, 0x4D,
-						0x54, 0x68, 0x72, 0x65, 0x65,
-						0x8F, 0x05, 0x4C, 0x46, 0x6F,
-						0x75, 0x72, 0x8F, 0x05, 0x4B,
-						0x46, 0x69, 0x76, 0x65, 0x8F,
-						0x04, 0x4A, 0x53, 0x69, 0x78,
-						0x8F, 0x06, 0x49, 0x53, 0x65,
-						0x76, 0x65, 0x6E, 0x8F, 0x06,
-						0x48, 0x45, 0x69, 0x67, 0x68,
-						0x74, 0x8F, 0x05, 0x47, 0x4E,
-						0x69, 0x6E, 0x65, 0x8F, 0x06,
-						0x46, 0x41, 0x6C, 0x70, 0x68,
-						0x61, 0x8F, 0x06, 0x45, 0x42,
-						0x72, 0x61, 0x76, 0x6F, 0x8F,
-						0x08, 0x44, 0x43, 0x68, 0x61,
-						0x72, 0x6C, 0x69, 0x65, 0x8F,
-						0x06, 0x43, 0x44, 0x65, 0x6C,
-						0x74, 0x61, 0x8F, 0x05, 0x42,
-						0x45, 0x63, 0x68, 0x6F, 0x8F,
-						0x09, 0x41, 0x46, 0x6F, 0x78,
-						0x2D, 0x74, 0x72, 0x6F, 0x74,
-						0x8F, 0x06, 0x40, 0x42, 0x6C,
-						0x61, 0x63, 0x6B, 0x8F, 0x06,
-						0x3F, 0x42, 0x72, 0x6F, 0x77,
-						0x6E, 0x8F, 0x04, 0x3E, 0x52,
-						0x65, 0x64, 0x8F, 0x07, 0x3D,
-						0x4F, 0x72, 0x61, 0x6E, 0x67,
-						0x65, 0x8F, 0x07, 0x3C, 0x59,
-						0x65, 0x6C, 0x6C, 0x6F, 0x77,
-						0x8F, 0x06, 0x3B, 0x47, 0x72,
-						0x65, 0x65, 0x6E, 0x8F, 0x05,
-						0x3A, 0x42, 0x6C, 0x75, 0x65,
-						0x8F, 0x07, 0x39, 0x56, 0x69,
-						0x6F, 0x6C, 0x65, 0x74, 0x8F,
-						0x05, 0x38, 0x47, 0x72, 0x65,
-						0x79, 0x8F, 0x06, 0x37, 0x57,
-						0x68, 0x69, 0x74, 0x65, 0x8F,
-						0x06, 0x36, 0x6D, 0x69, 0x6C,
-						0x6C, 0x69, 0x8F, 0x06, 0x35,
-						0x6D, 0x69, 0x63, 0x72, 0x6F,
-						0x8F, 0x05, 0x34, 0x6E, 0x61,
-						0x6E, 0x6F, 0x8F, 0x05, 0x33,
-						0x70, 0x69, 0x63, 0x6F };
-
-static unsigned char select_item_131[] = { 0xD0, 0x81, 0xFB, 0x81, 0x03, 0x01,
-						0x24, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x4C, 0x61,
-						0x72, 0x67, 0x65, 0x4D, 0x65,
-						0x6E, 0x75, 0x32, 0x8F, 0x1E,
-						0xFF, 0x43, 0x61, 0x6C, 0x6C,
-						0x20, 0x46, 0x6F, 0x72, 0x77,
-						0x61, 0x72, 0x64, 0x69, 0x6E,
-						0x67, 0x20, 0x55, 0x6E, 0x63,
-						0x6F, 0x6E, 0x64, 0x69, 0x74,
-						0x69, 0x6F, 0x6E, 0x61, 0x6C,
-						0x8F, 0x1D, 0xFE, 0x43, 0x61,
-						0x6C, 0x6C, 0x20, 0x46, 0x6F,
-						0x72, 0x77, 0x61, 0x72, 0x64,
-						0x69, 0x6E, 0x67, 0x20, 0x4F,
-						0x6E, 0x20, 0x55, 0x73, 0x65,
-						0x72, 0x20, 0x42, 0x75, 0x73,
-						0x79, 0x8F, 0x1C, 0xFD, 0x43,
-						0x61, 0x6C, 0x6C, 0x20, 0x46,
-						0x6F, 0x72, 0x77, 0x61, 0x72,
-						0x64, 0x69, 0x6E, 0x67, 0x20,
-						0x4F, 0x6E, 0x20, 0x4E, 0x6F,
-						0x20, 0x52, 0x65, 0x70, 0x6C,
-						0x79, 0x8F, 0x26, 0xFC, 0x43,
-						0x61, 0x6C, 0x6C, 0x20, 0x46,
-						0x6F, 0x72, 0x77, 0x61, 0x72,
-						0x64, 0x69, 0x6E, 0x67, 0x20,
-						0x4F, 0x6E, 0x20, 0x55, 0x73,
-						0x65, 0x72, 0x20, 0x4E, 0x6F,
-						0x74, 0x20, 0x52, 0x65, 0x61,
-						0x63, 0x68, 0x61, 0x62, 0x6C,
-						0x65, 0x8F, 0x1E, 0xFB, 0x42,
-						0x61, 0x72, 0x72, 0x69, 0x6E,
-						0x67, 0x20, 0x4F, 0x66, 0x20,
-						0x41, 0x6C, 0x6C, 0x20, 0x4F,
-						0x75, 0x74, 0x67, 0x6F, 0x69,
-						0x6E, 0x67, 0x20, 0x43, 0x61,
-						0x6C, 0x6C, 0x73, 0x8F, 0x2C,
-						0xFA, 0x42, 0x61, 0x72, 0x72,
-						0x69, 0x6E, 0x67, 0x20, 0x4F,
-						0x66, 0x20, 0x41, 0x6C, 0x6C,
-						0x20, 0x4F, 0x75, 0x74, 0x67,
-						0x6F, 0x69, 0x6E, 0x67, 0x20,
-						0x49, 0x6E, 0x74, 0x65, 0x72,
-						0x6E, 0x61, 0x74, 0x69, 0x6F,
-						0x6E, 0x61, 0x6C, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x73, 0x8F,
-						0x11, 0xF9, 0x43, 0x4C, 0x49,
-						0x20, 0x50, 0x72, 0x65, 0x73,
-						0x65, 0x6E, 0x74, 0x61, 0x74,
-						0x69, 0x6F, 0x6E };
-
-static unsigned char select_item_141[] = { 0xD0, 0x22, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0B, 0x53, 0x65, 0x6C,
-						0x65, 0x63, 0x74, 0x20, 0x49,
-						0x74, 0x65, 0x6D, 0x8F, 0x04,
-						0x11, 0x4F, 0x6E, 0x65, 0x8F,
-						0x04, 0x12, 0x54, 0x77, 0x6F };
-
-static unsigned char select_item_151[] = { 0xD0, 0x81, 0xFD, 0x81, 0x03, 0x01,
-						0x24, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x81, 0xED, 0x54,
-						0x68, 0x65, 0x20, 0x53, 0x49,
-						0x4D, 0x20, 0x73, 0x68, 0x61,
-						0x6C, 0x6C, 0x20, 0x73, 0x75,
-						0x70, 0x70, 0x6C, 0x79, 0x20,
-						0x61, 0x20, 0x73, 0x65, 0x74,
-						0x20, 0x6F, 0x66, 0x20, 0x69,
-						0x74, 0x65, 0x6D, 0x73, 0x20,
-						0x66, 0x72, 0x6F, 0x6D, 0x20,
-						0x77, 0x68, 0x69, 0x63, 0x68,
-						0x20, 0x74, 0x68, 0x65, 0x20,
-						0x75, 0x73, 0x65, 0x72, 0x20,
-						0x6D, 0x61, 0x79, 0x20, 0x63,
-						0x68, 0x6F, 0x6F, 0x73, 0x65,
-						0x20, 0x6F, 0x6E, 0x65, 0x2E,
-						0x20, 0x45, 0x61, 0x63, 0x68,
-						0x20, 0x69, 0x74, 0x65, 0x6D,
-						0x20, 0x63, 0x6F, 0x6D, 0x70,
-						0x72, 0x69, 0x73, 0x65, 0x73,
-						0x20, 0x61, 0x20, 0x73, 0x68,
-						0x6F, 0x72, 0x74, 0x20, 0x69,
-						0x64, 0x65, 0x6E, 0x74, 0x69,
-						0x66, 0x69, 0x65, 0x72, 0x20,
-						0x28, 0x75, 0x73, 0x65, 0x64,
-						0x20, 0x74, 0x6F, 0x20, 0x69,
-						0x6E, 0x64, 0x69, 0x63, 0x61,
-						0x74, 0x65, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x73, 0x65, 0x6C,
-						0x65, 0x63, 0x74, 0x69, 0x6F,
-						0x6E, 0x29, 0x20, 0x61, 0x6E,
-						0x64, 0x20, 0x61, 0x20, 0x74,
-						0x65, 0x78, 0x74, 0x20, 0x73,
-						0x74, 0x72, 0x69, 0x6E, 0x67,
-						0x2E, 0x20, 0x4F, 0x70, 0x74,
-						0x69, 0x6F, 0x6E, 0x61, 0x6C,
-						0x6C, 0x79, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x53, 0x49, 0x4D,
-						0x20, 0x6D, 0x61, 0x79, 0x20,
-						0x69, 0x6E, 0x63, 0x6C, 0x75,
-						0x64, 0x65, 0x20, 0x61, 0x6E,
-						0x20, 0x61, 0x6C, 0x70, 0x68,
-						0x61, 0x20, 0x69, 0x64, 0x65,
-						0x6E, 0x74, 0x69, 0x66, 0x69,
-						0x65, 0x72, 0x2E, 0x20, 0x54,
-						0x68, 0x65, 0x20, 0x61, 0x6C,
-						0x70, 0x68, 0x61, 0x20, 0x69,
-						0x64, 0x65, 0x6E, 0x74, 0x69,
-						0x66, 0x69, 0x65, 0x72, 0x20,
-						0x69, 0x8F, 0x02, 0x01, 0x59 };
-
-static unsigned char select_item_161[] = { 0xD0, 0x81, 0xF3, 0x81, 0x03, 0x01,
-						0x24, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x30, 0x4C,
-						0x61, 0x72, 0x67, 0x65, 0x4D,
-						0x65, 0x6E, 0x75, 0x8F, 0x1D,
-						0xFF, 0x31, 0x20, 0x43, 0x61,
-						0x6C, 0x6C, 0x20, 0x46, 0x6F,
-						0x72, 0x77, 0x61, 0x72, 0x64,
-						0x20, 0x55, 0x6E, 0x63, 0x6F,
-						0x6E, 0x64, 0x69, 0x74, 0x69,
-						0x6F, 0x6E, 0x61, 0x6C, 0x8F,
-						0x1C, 0xFE, 0x32, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x20, 0x46,
-						0x6F, 0x72, 0x77, 0x61, 0x72,
-						0x64, 0x20, 0x4F, 0x6E, 0x20,
-						0x55, 0x73, 0x65, 0x72, 0x20,
-						0x42, 0x75, 0x73, 0x79, 0x8F,
-						0x1B, 0xFD, 0x33, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x20, 0x46,
-						0x6F, 0x72, 0x77, 0x61, 0x72,
-						0x64, 0x20, 0x4F, 0x6E, 0x20,
-						0x4E, 0x6F, 0x20, 0x52, 0x65,
-						0x70, 0x6C, 0x79, 0x8F, 0x25,
-						0xFC, 0x34, 0x20, 0x43, 0x61,
-						0x6C, 0x6C, 0x20, 0x46, 0x6F,
-						0x72, 0x77, 0x61, 0x72, 0x64,
-						0x20, 0x4F, 0x6E, 0x20, 0x55,
-						0x73, 0x65, 0x72, 0x20, 0x4E,
-						0x6F, 0x74, 0x20, 0x52, 0x65,
-						0x61, 0x63, 0x68, 0x61, 0x62,
-						0x6C, 0x65, 0x8F, 0x20, 0xFB,
-						0x35, 0x20, 0x42, 0x61, 0x72,
-						0x72, 0x69, 0x6E, 0x67, 0x20,
-						0x4F, 0x66, 0x20, 0x41, 0x6C,
-						0x6C, 0x20, 0x4F, 0x75, 0x74,
-						0x67, 0x6F, 0x69, 0x6E, 0x67,
-						0x20, 0x43, 0x61, 0x6C, 0x6C,
-						0x73, 0x8F, 0x24, 0xFA, 0x36,
-						0x20, 0x42, 0x61, 0x72, 0x72,
-						0x69, 0x6E, 0x67, 0x20, 0x4F,
-						0x66, 0x20, 0x41, 0x6C, 0x6C,
-						0x20, 0x4F, 0x75, 0x74, 0x67,
-						0x6F, 0x69, 0x6E, 0x67, 0x20,
-						0x49, 0x6E, 0x74, 0x20, 0x43,
-						0x61, 0x6C, 0x6C, 0x73, 0x8F,
-						0x13, 0xF9, 0x37, 0x20, 0x43,
-						0x4C, 0x49, 0x20, 0x50, 0x72,
-						0x65, 0x73, 0x65, 0x6E, 0x74,
-						0x61, 0x74, 0x69, 0x6F, 0x6E };
-
-static unsigned char select_item_211[] = { 0xD0, 0x39, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0x18, 0x03,
-						0x13, 0x10, 0x26 };
-
-static unsigned char select_item_311[] = { 0xD0, 0x37, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0x90, 0x01,
-						0x02 };
-
-static unsigned char select_item_411[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x24,
-						0x80, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33 };
-
-static unsigned char select_item_511[] = { 0xD0, 0x3E, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0x9E, 0x02,
-						0x01, 0x01, 0x9F, 0x04, 0x01,
-						0x05, 0x05, 0x05 };
-
-static unsigned char select_item_521[] = { 0xD0, 0x3E, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33, 0x9E, 0x02,
-						0x00, 0x01, 0x9F, 0x04, 0x00,
-						0x05, 0x05, 0x05 };
-
-static unsigned char select_item_611[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x24,
-						0x03, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33 };
-
-static unsigned char select_item_621[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x24,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32, 0x8F,
-						0x07, 0x03, 0x49, 0x74, 0x65,
-						0x6D, 0x20, 0x33 };
-
-static unsigned char select_item_711[] = { 0xD0, 0x2B, 0x81, 0x03, 0x01, 0x24,
-						0x04, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0E, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x8F, 0x07, 0x01, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x31,
-						0x8F, 0x07, 0x02, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x32 };
-
-static unsigned char select_item_811[] = { 0xD0, 0x30, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0A, 0x3C, 0x54, 0x49,
-						0x4D, 0x45, 0x2D, 0x4F, 0x55,
-						0x54, 0x3E, 0x8F, 0x07, 0x01,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x31, 0x8F, 0x07, 0x02, 0x49,
-						0x74, 0x65, 0x6D, 0x20, 0x32,
-						0x8F, 0x07, 0x03, 0x49, 0x74,
-						0x65, 0x6D, 0x20, 0x33 };
-
-static unsigned char select_item_911[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_912[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34 };
-
-static unsigned char select_item_921[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x01, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x01, 0xB4, 0x00, 0x06,
-						0x01, 0xB4 };
-
-static unsigned char select_item_922[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34 };
-
-static unsigned char select_item_931[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x02, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x02, 0xB4, 0x00, 0x06,
-						0x02, 0xB4 };
-
-static unsigned char select_item_932[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34 };
-
-static unsigned char select_item_941[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x04, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x04, 0xB4, 0x00, 0x06,
-						0x04, 0xB4 };
-
-static unsigned char select_item_942[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_943[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x33, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x35, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x36 };
-
-static unsigned char select_item_951[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x08, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x08, 0xB4, 0x00, 0x06,
-						0x08, 0xB4 };
-
-static unsigned char select_item_952[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_953[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x33, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x35, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x36 };
-
-static unsigned char select_item_961[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x10, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x10, 0xB4, 0x00, 0x06,
-						0x10, 0xB4 };
-
-static unsigned char select_item_962[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_963[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x33, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x35, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x36 };
-
-static unsigned char select_item_971[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x20, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x20, 0xB4, 0x00, 0x06,
-						0x20, 0xB4 };
-
-static unsigned char select_item_972[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_973[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x33, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x35, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x36 };
-
-static unsigned char select_item_981[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x40, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x40, 0xB4, 0x00, 0x06,
-						0x40, 0xB4 };
-
-static unsigned char select_item_982[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_983[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x33, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x35, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x36 };
-
-static unsigned char select_item_991[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x80, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x80, 0xB4, 0x00, 0x06,
-						0x80, 0xB4 };
-
-static unsigned char select_item_992[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_993[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x33, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x35, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x36 };
-
-static unsigned char select_item_9101[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x31, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x31, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4, 0xD1, 0x08, 0x00,
-						0x06, 0x00, 0xB4, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char select_item_9102[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x54, 0x6F, 0x6F,
-						0x6C, 0x6B, 0x69, 0x74, 0x20,
-						0x53, 0x65, 0x6C, 0x65, 0x63,
-						0x74, 0x20, 0x32, 0x8F, 0x07,
-						0x01, 0x49, 0x74, 0x65, 0x6D,
-						0x20, 0x33, 0x8F, 0x07, 0x02,
-						0x49, 0x74, 0x65, 0x6D, 0x20,
-						0x34 };
-
-static unsigned char select_item_1011[] = { 0xD0, 0x7E, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x8F, 0x1C, 0x01,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15,
-						0x00, 0x31, 0x8F, 0x1C, 0x02,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15,
-						0x00, 0x32, 0x8F, 0x1C, 0x03,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15,
-						0x00, 0x33 };
-
-static unsigned char select_item_1021[] = { 0xD0, 0x53, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0F, 0x81, 0x0C, 0x08,
-						0x97, 0x94, 0xA0, 0x90, 0x92,
-						0xA1, 0xA2, 0x92, 0xA3, 0x99,
-						0xA2, 0x95, 0x8F, 0x11, 0x01,
-						0x81, 0x0D, 0x08, 0x97, 0x94,
-						0xA0, 0x90, 0x92, 0xA1, 0xA2,
-						0x92, 0xA3, 0x99, 0xA2, 0x95,
-						0x31, 0x8F, 0x11, 0x02, 0x81,
-						0x0D, 0x08, 0x97, 0x94, 0xA0,
-						0x90, 0x92, 0xA1, 0xA2, 0x92,
-						0xA3, 0x99, 0xA2, 0x95, 0x32,
-						0x8F, 0x11, 0x03, 0x81, 0x0D,
-						0x08, 0x97, 0x94, 0xA0, 0x90,
-						0x92, 0xA1, 0xA2, 0x92, 0xA3,
-						0x99, 0xA2, 0x95, 0x33 };
-
-static unsigned char select_item_1031[] = { 0xD0, 0x57, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x10, 0x82, 0x0C, 0x04,
-						0x10, 0x87, 0x84, 0x90, 0x80,
-						0x82, 0x91, 0x92, 0x82, 0x93,
-						0x89, 0x92, 0x85, 0x8F, 0x12,
-						0x01, 0x82, 0x0D, 0x04, 0x10,
-						0x87, 0x84, 0x90, 0x80, 0x82,
-						0x91, 0x92, 0x82, 0x93, 0x89,
-						0x92, 0x85, 0x31, 0x8F, 0x12,
-						0x02, 0x82, 0x0D, 0x04, 0x10,
-						0x87, 0x84, 0x90, 0x80, 0x82,
-						0x91, 0x92, 0x82, 0x93, 0x89,
-						0x92, 0x85, 0x32, 0x8F, 0x12,
-						0x03, 0x82, 0x0D, 0x04, 0x10,
-						0x87, 0x84, 0x90, 0x80, 0x82,
-						0x91, 0x92, 0x82, 0x93, 0x89,
-						0x92, 0x85, 0x33 };
-
-static unsigned char select_item_1111[] = { 0xD0, 0x3E, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x0B, 0x80, 0x5D, 0xE5,
-						0x51, 0x77, 0x7B, 0xB1, 0x90,
-						0x09, 0x62, 0xE9, 0x8F, 0x08,
-						0x01, 0x80, 0x98, 0x79, 0x76,
-						0xEE, 0x4E, 0x00, 0x8F, 0x08,
-						0x02, 0x80, 0x98, 0x79, 0x76,
-						0xEE, 0x4E, 0x8C, 0x8F, 0x08,
-						0x03, 0x80, 0x98, 0x79, 0x76,
-						0xEE, 0x4E, 0x09, 0x8F, 0x08,
-						0x04, 0x80, 0x98, 0x79, 0x76,
-						0xEE, 0x56, 0xDB };
-
-static unsigned char select_item_1211[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x09, 0x80, 0x00, 0x38,
-						0x00, 0x30, 0x30, 0xEB, 0x00,
-						0x30, 0x8F, 0x0A, 0x01, 0x80,
-						0x00, 0x38, 0x00, 0x30, 0x30,
-						0xEB, 0x00, 0x31, 0x8F, 0x0A,
-						0x02, 0x80, 0x00, 0x38, 0x00,
-						0x30, 0x30, 0xEB, 0x00, 0x32,
-						0x8F, 0x0A, 0x03, 0x80, 0x00,
-						0x38, 0x00, 0x30, 0x30, 0xEB,
-						0x00, 0x33 };
-
-static unsigned char select_item_1221[] = { 0xD0, 0x30, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x07, 0x81, 0x04, 0x61,
-						0x38, 0x31, 0xEB, 0x30, 0x8F,
-						0x08, 0x01, 0x81, 0x04, 0x61,
-						0x38, 0x31, 0xEB, 0x31, 0x8F,
-						0x08, 0x02, 0x81, 0x04, 0x61,
-						0x38, 0x31, 0xEB, 0x32, 0x8F,
-						0x08, 0x03, 0x81, 0x04, 0x61,
-						0x38, 0x31, 0xEB, 0x33 };
-
-static unsigned char select_item_1231[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x24,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0x85, 0x08, 0x82, 0x04, 0x30,
-						0xA0, 0x38, 0x32, 0xCB, 0x30,
-						0x8F, 0x09, 0x01, 0x82, 0x04,
-						0x30, 0xA0, 0x38, 0x32, 0xCB,
-						0x31, 0x8F, 0x09, 0x02, 0x82,
-						0x04, 0x30, 0xA0, 0x38, 0x32,
-						0xCB, 0x32, 0x8F, 0x09, 0x03,
-						0x82, 0x04, 0x30, 0xA0, 0x38,
-						0x32, 0xCB, 0x33 };
-
 static struct select_item_test select_item_data_111 = {
 	.pdu = select_item_111,
 	.pdu_len = sizeof(select_item_111),
@@ -6276,618 +4636,6 @@ struct send_sms_test {
 	struct stk_frame_id frame_id;
 };
 
-/* 3GPP TS 31.124 Section 27.22.4.10.1.4.2 */
-static unsigned char send_sms_111[] = { 0xD0, 0x37, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x07, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x53, 0x4D, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x18, 0x01, 0x00, 0x09,
-						0x91, 0x10, 0x32, 0x54, 0x76,
-						0xF8, 0x40, 0xF4, 0x0C, 0x54,
-						0x65, 0x73, 0x74, 0x20, 0x4D,
-						0x65, 0x73, 0x73, 0x61, 0x67,
-						0x65 };
-
-static unsigned char send_sms_121[] = { 0xD0, 0x32, 0x81, 0x03, 0x01, 0x13,
-						0x01, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x07, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x53, 0x4D, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x13, 0x01, 0x00, 0x09,
-						0x91, 0x10, 0x32, 0x54, 0x76,
-						0xF8, 0x40, 0xF4, 0x07, 0x53,
-						0x65, 0x6E, 0x64, 0x20, 0x53,
-						0x4D };
-
-static unsigned char send_sms_131[] = { 0xD0, 0x3D, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0D, 0x53, 0x68, 0x6F,
-						0x72, 0x74, 0x20, 0x4D, 0x65,
-						0x73, 0x73, 0x61, 0x67, 0x65,
-						0x86, 0x09, 0x91, 0x11, 0x22,
-						0x33, 0x44, 0x55, 0x66, 0x77,
-						0xF8, 0x8B, 0x18, 0x01, 0x00,
-						0x09, 0x91, 0x10, 0x32, 0x54,
-						0x76, 0xF8, 0x40, 0xF0, 0x0D,
-						0x53, 0xF4, 0x5B, 0x4E, 0x07,
-						0x35, 0xCB, 0xF3, 0x79, 0xF8,
-						0x5C, 0x06 };
-
-static unsigned char send_sms_141[] = { 0xD0, 0x81, 0xFD, 0x81, 0x03, 0x01,
-						0x13, 0x01, 0x82, 0x02, 0x81,
-						0x83, 0x85, 0x38, 0x54, 0x68,
-						0x65, 0x20, 0x61, 0x64, 0x64,
-						0x72, 0x65, 0x73, 0x73, 0x20,
-						0x64, 0x61, 0x74, 0x61, 0x20,
-						0x6F, 0x62, 0x6A, 0x65, 0x63,
-						0x74, 0x20, 0x68, 0x6F, 0x6C,
-						0x64, 0x73, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x52, 0x50, 0x11,
-						0x44, 0x65, 0x73, 0x74, 0x69,
-						0x6E, 0x61, 0x74, 0x69, 0x6F,
-						0x6E, 0x11, 0x41, 0x64, 0x64,
-						0x72, 0x65, 0x73, 0x73, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x81, 0xAC, 0x01, 0x00,
-						0x09, 0x91, 0x10, 0x32, 0x54,
-						0x76, 0xF8, 0x40, 0xF4, 0xA0,
-						0x54, 0x77, 0x6F, 0x20, 0x74,
-						0x79, 0x70, 0x65, 0x73, 0x20,
-						0x61, 0x72, 0x65, 0x20, 0x64,
-						0x65, 0x66, 0x69, 0x6E, 0x65,
-						0x64, 0x3A, 0x20, 0x2D, 0x20,
-						0x41, 0x20, 0x73, 0x68, 0x6F,
-						0x72, 0x74, 0x20, 0x6D, 0x65,
-						0x73, 0x73, 0x61, 0x67, 0x65,
-						0x20, 0x74, 0x6F, 0x20, 0x62,
-						0x65, 0x20, 0x73, 0x65, 0x6E,
-						0x74, 0x20, 0x74, 0x6F, 0x20,
-						0x74, 0x68, 0x65, 0x20, 0x6E,
-						0x65, 0x74, 0x77, 0x6F, 0x72,
-						0x6B, 0x20, 0x69, 0x6E, 0x20,
-						0x61, 0x6E, 0x20, 0x53, 0x4D,
-						0x53, 0x2D, 0x53, 0x55, 0x42,
-						0x4D, 0x49, 0x54, 0x20, 0x6D,
-						0x65, 0x73, 0x73, 0x61, 0x67,
-						0x65, 0x2C, 0x20, 0x6F, 0x72,
-						0x20, 0x61, 0x6E, 0x20, 0x53,
-						0x4D, 0x53, 0x2D, 0x43, 0x4F,
-						0x4D, 0x4D, 0x41, 0x4E, 0x44,
-						0x20, 0x6D, 0x65, 0x73, 0x73,
-						0x61, 0x67, 0x65, 0x2C, 0x20,
-						0x77, 0x68, 0x65, 0x72, 0x65,
-						0x20, 0x74, 0x68, 0x65, 0x20,
-						0x75, 0x73, 0x65, 0x72, 0x20,
-						0x64, 0x61, 0x74, 0x61, 0x20,
-						0x63, 0x61, 0x6E, 0x20, 0x62,
-						0x65, 0x20, 0x70, 0x61, 0x73,
-						0x73, 0x65, 0x64, 0x20, 0x74,
-						0x72, 0x61, 0x6E, 0x73, 0x70 };
-
-static unsigned char send_sms_151[] = { 0xD0, 0x81, 0xE9, 0x81, 0x03, 0x01,
-						0x13, 0x00, 0x82, 0x02, 0x81,
-						0x83, 0x85, 0x38, 0x54, 0x68,
-						0x65, 0x20, 0x61, 0x64, 0x64,
-						0x72, 0x65, 0x73, 0x73, 0x20,
-						0x64, 0x61, 0x74, 0x61, 0x20,
-						0x6F, 0x62, 0x6A, 0x65, 0x63,
-						0x74, 0x20, 0x68, 0x6F, 0x6C,
-						0x64, 0x73, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x52, 0x50, 0x20,
-						0x44, 0x65, 0x73, 0x74, 0x69,
-						0x6E, 0x61, 0x74, 0x69, 0x6F,
-						0x6E, 0x20, 0x41, 0x64, 0x64,
-						0x72, 0x65, 0x73, 0x73, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x81, 0x98, 0x01, 0x00,
-						0x09, 0x91, 0x10, 0x32, 0x54,
-						0x76, 0xF8, 0x40, 0xF0, 0xA0,
-						0xD4, 0xFB, 0x1B, 0x44, 0xCF,
-						0xC3, 0xCB, 0x73, 0x50, 0x58,
-						0x5E, 0x06, 0x91, 0xCB, 0xE6,
-						0xB4, 0xBB, 0x4C, 0xD6, 0x81,
-						0x5A, 0xA0, 0x20, 0x68, 0x8E,
-						0x7E, 0xCB, 0xE9, 0xA0, 0x76,
-						0x79, 0x3E, 0x0F, 0x9F, 0xCB,
-						0x20, 0xFA, 0x1B, 0x24, 0x2E,
-						0x83, 0xE6, 0x65, 0x37, 0x1D,
-						0x44, 0x7F, 0x83, 0xE8, 0xE8,
-						0x32, 0xC8, 0x5D, 0xA6, 0xDF,
-						0xDF, 0xF2, 0x35, 0x28, 0xED,
-						0x06, 0x85, 0xDD, 0xA0, 0x69,
-						0x73, 0xDA, 0x9A, 0x56, 0x85,
-						0xCD, 0x24, 0x15, 0xD4, 0x2E,
-						0xCF, 0xE7, 0xE1, 0x73, 0x99,
-						0x05, 0x7A, 0xCB, 0x41, 0x61,
-						0x37, 0x68, 0xDA, 0x9C, 0xB6,
-						0x86, 0xCF, 0x66, 0x33, 0xE8,
-						0x24, 0x82, 0xDA, 0xE5, 0xF9,
-						0x3C, 0x7C, 0x2E, 0xB3, 0x40,
-						0x77, 0x74, 0x59, 0x5E, 0x06,
-						0xD1, 0xD1, 0x65, 0x50, 0x7D,
-						0x5E, 0x96, 0x83, 0xC8, 0x61,
-						0x7A, 0x18, 0x34, 0x0E, 0xBB,
-						0x41, 0xE2, 0x32, 0x08, 0x1E,
-						0x9E, 0xCF, 0xCB, 0x64, 0x10,
-						0x5D, 0x1E, 0x76, 0xCF, 0xE1 };
-
-static unsigned char send_sms_161[] = { 0xD0, 0x81, 0xFD, 0x81, 0x03, 0x01,
-						0x13, 0x00, 0x82, 0x02, 0x81,
-						0x83, 0x85, 0x81, 0xE6, 0x54,
-						0x77, 0x6F, 0x20, 0x74, 0x79,
-						0x70, 0x65, 0x73, 0x20, 0x61,
-						0x72, 0x65, 0x20, 0x64, 0x65,
-						0x66, 0x69, 0x6E, 0x65, 0x64,
-						0x3A, 0x20, 0x2D, 0x20, 0x41,
-						0x20, 0x73, 0x68, 0x6F, 0x72,
-						0x74, 0x20, 0x6D, 0x65, 0x73,
-						0x73, 0x61, 0x67, 0x65, 0x20,
-						0x74, 0x6F, 0x20, 0x62, 0x65,
-						0x20, 0x73, 0x65, 0x6E, 0x74,
-						0x20, 0x74, 0x6F, 0x20, 0x74,
-						0x68, 0x65, 0x20, 0x6E, 0x65,
-						0x74, 0x77, 0x6F, 0x72, 0x6B,
-						0x20, 0x69, 0x6E, 0x20, 0x61,
-						0x6E, 0x20, 0x53, 0x4D, 0x53,
-						0x2D, 0x53, 0x55, 0x42, 0x4D,
-						0x49, 0x54, 0x20, 0x6D, 0x65,
-						0x73, 0x73, 0x61, 0x67, 0x65,
-						0x2C, 0x20, 0x6F, 0x72, 0x20,
-						0x61, 0x6E, 0x20, 0x53, 0x4D,
-						0x53, 0x2D, 0x43, 0x4F, 0x4D,
-						0x4D, 0x41, 0x4E, 0x44, 0x20,
-						0x6D, 0x65, 0x73, 0x73, 0x61,
-						0x67, 0x65, 0x2C, 0x20, 0x77,
-						0x68, 0x65, 0x72, 0x65, 0x20,
-						0x74, 0x68, 0x65, 0x20, 0x75,
-						0x73, 0x65, 0x72, 0x20, 0x64,
-						0x61, 0x74, 0x61, 0x20, 0x63,
-						0x61, 0x6E, 0x20, 0x62, 0x65,
-						0x20, 0x70, 0x61, 0x73, 0x73,
-						0x65, 0x64, 0x20, 0x74, 0x72,
-						0x61, 0x6E, 0x73, 0x70, 0x61,
-						0x72, 0x65, 0x6E, 0x74, 0x6C,
-						0x79, 0x3B, 0x20, 0x2D, 0x20,
-						0x41, 0x20, 0x73, 0x68, 0x6F,
-						0x72, 0x74, 0x20, 0x6D, 0x65,
-						0x73, 0x73, 0x61, 0x67, 0x65,
-						0x20, 0x74, 0x6F, 0x20, 0x62,
-						0x65, 0x20, 0x73, 0x65, 0x6E,
-						0x74, 0x20, 0x74, 0x6F, 0x20,
-						0x74, 0x68, 0x65, 0x20, 0x6E,
-						0x65, 0x74, 0x77, 0x6F, 0x72,
-						0x6B, 0x20, 0x69, 0x6E, 0x20,
-						0x61, 0x6E, 0x20, 0x53, 0x4D,
-						0x53, 0x2D, 0x53, 0x55, 0x42,
-						0x4D, 0x49, 0x54, 0x20, 0x8B,
-						0x09, 0x01, 0x00, 0x02, 0x91,
-						0x10, 0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_171[] = { 0xD0, 0x30, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x00, 0x86, 0x09, 0x91,
-						0x11, 0x22, 0x33, 0x44, 0x55,
-						0x66, 0x77, 0xF8, 0x8B, 0x18,
-						0x01, 0x00, 0x09, 0x91, 0x10,
-						0x32, 0x54, 0x76, 0xF8, 0x40,
-						0xF4, 0x0C, 0x54, 0x65, 0x73,
-						0x74, 0x20, 0x4D, 0x65, 0x73,
-						0x73, 0x61, 0x67, 0x65 };
-
-static unsigned char send_sms_181[] = { 0xD0, 0x2E, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x86, 0x09, 0x91, 0x11, 0x22,
-						0x33, 0x44, 0x55, 0x66, 0x77,
-						0xF8, 0x8B, 0x18, 0x01, 0x00,
-						0x09, 0x91, 0x10, 0x32, 0x54,
-						0x76, 0xF8, 0x40, 0xF4, 0x0C,
-						0x54, 0x65, 0x73, 0x74, 0x20,
-						0x4D, 0x65, 0x73, 0x73, 0x61,
-						0x67, 0x65 };
-
-static unsigned char send_sms_211[] = { 0xD0, 0x55, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x86, 0x09, 0x91,
-						0x11, 0x22, 0x33, 0x44, 0x55,
-						0x66, 0x77, 0xF8, 0x8B, 0x24,
-						0x01, 0x00, 0x09, 0x91, 0x10,
-						0x32, 0x54, 0x76, 0xF8, 0x40,
-						0x08, 0x18, 0x04, 0x17, 0x04,
-						0x14, 0x04, 0x20, 0x04, 0x10,
-						0x04, 0x12, 0x04, 0x21, 0x04,
-						0x22, 0x04, 0x12, 0x04, 0x23,
-						0x04, 0x19, 0x04, 0x22, 0x04,
-						0x15 };
-
-static unsigned char send_sms_212[] = { 0xD0, 0x4B, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0F, 0x81, 0x0C, 0x08,
-						0x97, 0x94, 0xA0, 0x90, 0x92,
-						0xA1, 0xA2, 0x92, 0xA3, 0x99,
-						0xA2, 0x95, 0x86, 0x09, 0x91,
-						0x11, 0x22, 0x33, 0x44, 0x55,
-						0x66, 0x77, 0xF8, 0x8B, 0x24,
-						0x01, 0x00, 0x09, 0x91, 0x10,
-						0x32, 0x54, 0x76, 0xF8, 0x40,
-						0x08, 0x18, 0x04, 0x17, 0x04,
-						0x14, 0x04, 0x20, 0x04, 0x10,
-						0x04, 0x12, 0x04, 0x21, 0x04,
-						0x22, 0x04, 0x12, 0x04, 0x23,
-						0x04, 0x19, 0x04, 0x22, 0x04,
-						0x15 };
-
-static unsigned char send_sms_213[] = { 0xD0, 0x4C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x82, 0x0C, 0x04,
-						0x10, 0x87, 0x84, 0x90, 0x80,
-						0x82, 0x91, 0x92, 0x82, 0x93,
-						0x89, 0x92, 0x85, 0x86, 0x09,
-						0x91, 0x11, 0x22, 0x33, 0x44,
-						0x55, 0x66, 0x77, 0xF8, 0x8B,
-						0x24, 0x01, 0x00, 0x09, 0x91,
-						0x10, 0x32, 0x54, 0x76, 0xF8,
-						0x40, 0x08, 0x18, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15 };
-
-static unsigned char send_sms_311[] = { 0xD0, 0x3B, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x07, 0x4E, 0x4F, 0x20,
-						0x49, 0x43, 0x4F, 0x4E, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x18, 0x01, 0x00, 0x09,
-						0x91, 0x10, 0x32, 0x54, 0x76,
-						0xF8, 0x40, 0xF4, 0x0C, 0x54,
-						0x65, 0x73, 0x74, 0x20, 0x4D,
-						0x65, 0x73, 0x73, 0x61, 0x67,
-						0x65, 0x9E, 0x02, 0x00, 0x01 };
-
-static unsigned char send_sms_321[] = { 0xD0, 0x3B, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x07, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x53, 0x4D, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x18, 0x01, 0x00, 0x09,
-						0x91, 0x10, 0x32, 0x54, 0x76,
-						0xF8, 0x40, 0xF4, 0x0C, 0x54,
-						0x65, 0x73, 0x74, 0x20, 0x4D,
-						0x65, 0x73, 0x73, 0x61, 0x67,
-						0x65, 0x1E, 0x02, 0x01, 0x01 };
-
-static unsigned char send_sms_411[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_412[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_421[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x01, 0xB4 };
-
-static unsigned char send_sms_422[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_431[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x02, 0xB4 };
-
-static unsigned char send_sms_432[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_441[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x04, 0xB4 };
-
-static unsigned char send_sms_442[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_443[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_451[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x08, 0xB4 };
-
-static unsigned char send_sms_452[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_453[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_461[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x10, 0xB4 };
-
-static unsigned char send_sms_462[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_463[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_471[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x20, 0xB4 };
-
-static unsigned char send_sms_472[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_473[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_481[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x40, 0xB4 };
-
-static unsigned char send_sms_482[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_483[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_491[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x80, 0xB4 };
-
-static unsigned char send_sms_492[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_493[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_4101[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20, 0xD0,
-						0x04, 0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char send_sms_4102[] = { 0xD0, 0x26, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8B, 0x09,
-						0x01, 0x00, 0x02, 0x91, 0x10,
-						0x40, 0xF0, 0x01, 0x20 };
-
-static unsigned char send_sms_511[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x4E, 0x2D,
-						0x4E, 0x00, 0x86, 0x09, 0x91,
-						0x11, 0x22, 0x33, 0x44, 0x55,
-						0x66, 0x77, 0xF8, 0x8B, 0x10,
-						0x01, 0x00, 0x09, 0x91, 0x10,
-						0x32, 0x54, 0x76, 0xF8, 0x40,
-						0x08, 0x04, 0x4E, 0x2D, 0x4E,
-						0x00 };
-
-static unsigned char send_sms_512[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x81, 0x02, 0x9C,
-						0xAD, 0x80, 0x86, 0x09, 0x91,
-						0x11, 0x22, 0x33, 0x44, 0x55,
-						0x66, 0x77, 0xF8, 0x8B, 0x10,
-						0x01, 0x00, 0x09, 0x91, 0x10,
-						0x32, 0x54, 0x76, 0xF8, 0x40,
-						0x08, 0x04, 0x4E, 0x2D, 0x4E,
-						0x00 };
-
-static unsigned char send_sms_513[] = { 0xD0, 0x2E, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x06, 0x82, 0x02, 0x4E,
-						0x00, 0xAD, 0x80, 0x86, 0x09,
-						0x91, 0x11, 0x22, 0x33, 0x44,
-						0x55, 0x66, 0x77, 0xF8, 0x8B,
-						0x10, 0x01, 0x00, 0x09, 0x91,
-						0x10, 0x32, 0x54, 0x76, 0xF8,
-						0x40, 0x08, 0x04, 0x4E, 0x2D,
-						0x4E, 0x00 };
-
-static unsigned char send_sms_611[] = { 0xD0, 0x35, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x09, 0x80, 0x00, 0x38,
-						0x00, 0x30, 0x30, 0xEB, 0x00,
-						0x30, 0x86, 0x09, 0x91, 0x11,
-						0x22, 0x33, 0x44, 0x55, 0x66,
-						0x77, 0xF8, 0x8B, 0x14, 0x01,
-						0x00, 0x09, 0x91, 0x10, 0x32,
-						0x54, 0x76, 0xF8, 0x40, 0x08,
-						0x08, 0x00, 0x38, 0x00, 0x30,
-						0x30, 0xEB, 0x00, 0x31 };
-
-static unsigned char send_sms_612[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x07, 0x81, 0x04, 0x61,
-						0x38, 0x31, 0xEB, 0x31, 0x86,
-						0x09, 0x91, 0x11, 0x22, 0x33,
-						0x44, 0x55, 0x66, 0x77, 0xF8,
-						0x8B, 0x14, 0x01, 0x00, 0x09,
-						0x91, 0x10, 0x32, 0x54, 0x76,
-						0xF8, 0x40, 0x08, 0x08, 0x00,
-						0x38, 0x00, 0x30, 0x30, 0xEB,
-						0x00, 0x32 };
-
-static unsigned char send_sms_613[] = { 0xD0, 0x34, 0x81, 0x03, 0x01, 0x13,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x08, 0x82, 0x04, 0x30,
-						0xA0, 0x38, 0x32, 0xCB, 0x32,
-						0x86, 0x09, 0x91, 0x11, 0x22,
-						0x33, 0x44, 0x55, 0x66, 0x77,
-						0xF8, 0x8B, 0x14, 0x01, 0x00,
-						0x09, 0x91, 0x10, 0x32, 0x54,
-						0x76, 0xF8, 0x40, 0x08, 0x08,
-						0x00, 0x38, 0x00, 0x30, 0x30,
-						0xEB, 0x00, 0x33 };
-
 static struct send_sms_test send_sms_data_111 = {
 	.pdu = send_sms_111,
 	.pdu_len = sizeof(send_sms_111),
@@ -8090,453 +5838,6 @@ struct send_ss_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char send_ss_111[] = { 0xD0, 0x29, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0C, 0x43, 0x61, 0x6C,
-						0x6C, 0x20, 0x46, 0x6F, 0x72,
-						0x77, 0x61, 0x72, 0x64, 0x89,
-						0x10, 0x91, 0xAA, 0x12, 0x0A,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0x21, 0x43, 0x65, 0x87, 0xA9,
-						0x01, 0xFB };
-
-static unsigned char send_ss_141[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0C, 0x43, 0x61, 0x6C,
-						0x6C, 0x20, 0x46, 0x6F, 0x72,
-						0x77, 0x61, 0x72, 0x64, 0x89,
-						0x14, 0x91, 0xAA, 0x12, 0x0A,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0x21, 0x43, 0x65, 0xA7, 0x11,
-						0xFB };
-
-static unsigned char send_ss_151[] = { 0xD0, 0x81, 0xFD, 0x81, 0x03, 0x01,
-						0x11, 0x00, 0x82, 0x02, 0x81,
-						0x83, 0x85, 0x81, 0xEB, 0x45,
-						0x76, 0x65, 0x6E, 0x20, 0x69,
-						0x66, 0x20, 0x74, 0x68, 0x65,
-						0x20, 0x46, 0x69, 0x78, 0x65,
-						0x64, 0x20, 0x44, 0x69, 0x61,
-						0x6C, 0x6C, 0x69, 0x6E, 0x67,
-						0x20, 0x4E, 0x75, 0x6D, 0x62,
-						0x65, 0x72, 0x20, 0x73, 0x65,
-						0x72, 0x76, 0x69, 0x63, 0x65,
-						0x20, 0x69, 0x73, 0x20, 0x65,
-						0x6E, 0x61, 0x62, 0x6C, 0x65,
-						0x64, 0x2C, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x73, 0x75, 0x70,
-						0x70, 0x6C, 0x65, 0x6D, 0x65,
-						0x6E, 0x74, 0x61, 0x72, 0x79,
-						0x20, 0x73, 0x65, 0x72, 0x76,
-						0x69, 0x63, 0x65, 0x20, 0x63,
-						0x6F, 0x6E, 0x74, 0x72, 0x6F,
-						0x6C, 0x20, 0x73, 0x74, 0x72,
-						0x69, 0x6E, 0x67, 0x20, 0x69,
-						0x6E, 0x63, 0x6C, 0x75, 0x64,
-						0x65, 0x64, 0x20, 0x69, 0x6E,
-						0x20, 0x74, 0x68, 0x65, 0x20,
-						0x53, 0x45, 0x4E, 0x44, 0x20,
-						0x53, 0x53, 0x20, 0x70, 0x72,
-						0x6F, 0x61, 0x63, 0x74, 0x69,
-						0x76, 0x65, 0x20, 0x63, 0x6F,
-						0x6D, 0x6D, 0x61, 0x6E, 0x64,
-						0x20, 0x73, 0x68, 0x61, 0x6C,
-						0x6C, 0x20, 0x6E, 0x6F, 0x74,
-						0x20, 0x62, 0x65, 0x20, 0x63,
-						0x68, 0x65, 0x63, 0x6B, 0x65,
-						0x64, 0x20, 0x61, 0x67, 0x61,
-						0x69, 0x6E, 0x73, 0x74, 0x20,
-						0x74, 0x68, 0x6F, 0x73, 0x65,
-						0x20, 0x6F, 0x66, 0x20, 0x74,
-						0x68, 0x65, 0x20, 0x46, 0x44,
-						0x4E, 0x20, 0x6C, 0x69, 0x73,
-						0x74, 0x2E, 0x20, 0x55, 0x70,
-						0x6F, 0x6E, 0x20, 0x72, 0x65,
-						0x63, 0x65, 0x69, 0x76, 0x69,
-						0x6E, 0x67, 0x20, 0x74, 0x68,
-						0x69, 0x73, 0x20, 0x63, 0x6F,
-						0x6D, 0x6D, 0x61, 0x6E, 0x64,
-						0x2C, 0x20, 0x74, 0x68, 0x65,
-						0x20, 0x4D, 0x45, 0x20, 0x73,
-						0x68, 0x61, 0x6C, 0x6C, 0x20,
-						0x64, 0x65, 0x63, 0x69, 0x89,
-						0x04, 0xFF, 0xBA, 0x13, 0xFB };
-
-static unsigned char send_ss_161[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x00, 0x89, 0x10, 0x91,
-						0xAA, 0x12, 0x0A, 0x21, 0x43,
-						0x65, 0x87, 0x09, 0x21, 0x43,
-						0x65, 0x87, 0xA9, 0x01, 0xFB };
-
-static unsigned char send_ss_211[] = { 0xD0, 0x2B, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x42, 0x61, 0x73,
-						0x69, 0x63, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0x89, 0x10, 0x91,
-						0xAA, 0x12, 0x0A, 0x21, 0x43,
-						0x65, 0x87, 0x09, 0x21, 0x43,
-						0x65, 0x87, 0xA9, 0x01, 0xFB,
-						0x9E, 0x02, 0x00, 0x01 };
-
-static unsigned char send_ss_221[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x43, 0x6F, 0x6C,
-						0x6F, 0x75, 0x72, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0x9E, 0x02, 0x00, 0x02 };
-
-static unsigned char send_ss_231[] = { 0xD0, 0x2B, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x42, 0x61, 0x73,
-						0x69, 0x63, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0x89, 0x10, 0x91,
-						0xAA, 0x12, 0x0A, 0x21, 0x43,
-						0x65, 0x87, 0x09, 0x21, 0x43,
-						0x65, 0x87, 0xA9, 0x01, 0xFB,
-						0x9E, 0x02, 0x01, 0x01 };
-
-static unsigned char send_ss_241[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x89, 0x0E, 0x91, 0xAA, 0x12,
-						0x0A, 0x21, 0x43, 0x65, 0x87,
-						0x09, 0x21, 0x43, 0x65, 0x87,
-						0xB9, 0x9E, 0x02, 0x01, 0x01 };
-
-static unsigned char send_ss_311[] = { 0xD0, 0x36, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x89, 0x10, 0x91,
-						0xAA, 0x12, 0x0A, 0x21, 0x43,
-						0x65, 0x87, 0x09, 0x21, 0x43,
-						0x65, 0x87, 0xA9, 0x01, 0xFB };
-
-static unsigned char send_ss_411[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_412[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_421[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x01, 0xB4 };
-
-static unsigned char send_ss_422[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_431[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x02, 0xB4 };
-
-static unsigned char send_ss_432[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_441[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x04, 0xB4 };
-
-static unsigned char send_ss_442[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_443[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_451[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x08, 0xB4 };
-
-static unsigned char send_ss_452[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_453[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_461[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x10, 0xB4 };
-
-static unsigned char send_ss_462[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_463[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_471[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x20, 0xB4 };
-
-static unsigned char send_ss_472[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_473[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_481[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x40, 0xB4 };
-
-static unsigned char send_ss_482[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_483[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_491[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x80, 0xB4 };
-
-static unsigned char send_ss_492[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_493[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_4101[] = { 0xD0, 0x33, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char send_ss_4102[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x89, 0x10,
-						0x91, 0xAA, 0x12, 0x0A, 0x21,
-						0x43, 0x65, 0x87, 0x09, 0x21,
-						0x43, 0x65, 0x87, 0xA9, 0x01,
-						0xFB };
-
-static unsigned char send_ss_511[] = { 0xD0, 0x22, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x4F, 0x60,
-						0x59, 0x7D, 0x89, 0x10, 0x91,
-						0xAA, 0x12, 0x0A, 0x21, 0x43,
-						0x65, 0x87, 0x09, 0x21, 0x43,
-						0x65, 0x87, 0xA9, 0x01, 0xFB };
-
-static unsigned char send_ss_611[] = { 0xD0, 0x20, 0x81, 0x03, 0x01, 0x11,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x03, 0x80, 0x30, 0xEB,
-						0x89, 0x10, 0x91, 0xAA, 0x12,
-						0x0A, 0x21, 0x43, 0x65, 0x87,
-						0x09, 0x21, 0x43, 0x65, 0x87,
-						0xA9, 0x01, 0xFB };
-
 static struct send_ss_test send_ss_data_111 = {
 	.pdu = send_ss_111,
 	.pdu_len = sizeof(send_ss_111),
@@ -9063,771 +6364,6 @@ struct send_ussd_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char send_ussd_111[] = { 0xD0, 0x50, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x37, 0x2D, 0x62,
-						0x69, 0x74, 0x20, 0x55, 0x53,
-						0x53, 0x44, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60 };
-
-static unsigned char send_ussd_121[] = { 0xD0, 0x58, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x38, 0x2D, 0x62,
-						0x69, 0x74, 0x20, 0x55, 0x53,
-						0x53, 0x44, 0x8A, 0x41, 0x44,
-						0x41, 0x42, 0x43, 0x44, 0x45,
-						0x46, 0x47, 0x48, 0x49, 0x4A,
-						0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
-						0x50, 0x51, 0x52, 0x53, 0x54,
-						0x55, 0x56, 0x57, 0x58, 0x59,
-						0x5A, 0x2D, 0x61, 0x62, 0x63,
-						0x64, 0x65, 0x66, 0x67, 0x68,
-						0x69, 0x6A, 0x6B, 0x6C, 0x6D,
-						0x6E, 0x6F, 0x70, 0x71, 0x72,
-						0x73, 0x74, 0x75, 0x76, 0x77,
-						0x78, 0x79, 0x7A, 0x2D, 0x31,
-						0x32, 0x33, 0x34, 0x35, 0x36,
-						0x37, 0x38, 0x39, 0x30 };
-
-static unsigned char send_ussd_131[] = { 0xD0, 0x2F, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x09, 0x55, 0x43, 0x53,
-						0x32, 0x20, 0x55, 0x53, 0x53,
-						0x44, 0x8A, 0x19, 0x48, 0x04,
-						0x17, 0x04, 0x14, 0x04, 0x20,
-						0x04, 0x10, 0x04, 0x12, 0x04,
-						0x21, 0x04, 0x22, 0x04, 0x12,
-						0x04, 0x23, 0x04, 0x19, 0x04,
-						0x22, 0x04, 0x15 };
-
-static unsigned char send_ussd_161[] = { 0xD0, 0x81, 0xFD, 0x81, 0x03, 0x01,
-						0x12, 0x00, 0x82, 0x02, 0x81,
-						0x83, 0x85, 0x81, 0xB6, 0x6F,
-						0x6E, 0x63, 0x65, 0x20, 0x61,
-						0x20, 0x52, 0x45, 0x4C, 0x45,
-						0x41, 0x53, 0x45, 0x20, 0x43,
-						0x4F, 0x4D, 0x50, 0x4C, 0x45,
-						0x54, 0x45, 0x20, 0x6D, 0x65,
-						0x73, 0x73, 0x61, 0x67, 0x65,
-						0x20, 0x63, 0x6F, 0x6E, 0x74,
-						0x61, 0x69, 0x6E, 0x69, 0x6E,
-						0x67, 0x20, 0x74, 0x68, 0x65,
-						0x20, 0x55, 0x53, 0x53, 0x44,
-						0x20, 0x52, 0x65, 0x74, 0x75,
-						0x72, 0x6E, 0x20, 0x52, 0x65,
-						0x73, 0x75, 0x6C, 0x74, 0x20,
-						0x6D, 0x65, 0x73, 0x73, 0x61,
-						0x67, 0x65, 0x20, 0x6E, 0x6F,
-						0x74, 0x20, 0x63, 0x6F, 0x6E,
-						0x74, 0x61, 0x69, 0x6E, 0x69,
-						0x6E, 0x67, 0x20, 0x61, 0x6E,
-						0x20, 0x65, 0x72, 0x72, 0x6F,
-						0x72, 0x20, 0x68, 0x61, 0x73,
-						0x20, 0x62, 0x65, 0x65, 0x6E,
-						0x20, 0x72, 0x65, 0x63, 0x65,
-						0x69, 0x76, 0x65, 0x64, 0x20,
-						0x66, 0x72, 0x6F, 0x6D, 0x20,
-						0x74, 0x68, 0x65, 0x20, 0x6E,
-						0x65, 0x74, 0x77, 0x6F, 0x72,
-						0x6B, 0x2C, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x4D, 0x45, 0x20,
-						0x73, 0x68, 0x61, 0x6C, 0x6C,
-						0x20, 0x69, 0x6E, 0x66, 0x6F,
-						0x72, 0x6D, 0x20, 0x74, 0x68,
-						0x65, 0x20, 0x53, 0x49, 0x4D,
-						0x20, 0x74, 0x68, 0x61, 0x74,
-						0x20, 0x74, 0x68, 0x65, 0x20,
-						0x63, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x68, 0x61,
-						0x73, 0x8A, 0x39, 0xF0, 0x41,
-						0xE1, 0x90, 0x58, 0x34, 0x1E,
-						0x91, 0x49, 0xE5, 0x92, 0xD9,
-						0x74, 0x3E, 0xA1, 0x51, 0xE9,
-						0x94, 0x5A, 0xB5, 0x5E, 0xB1,
-						0x59, 0x6D, 0x2B, 0x2C, 0x1E,
-						0x93, 0xCB, 0xE6, 0x33, 0x3A,
-						0xAD, 0x5E, 0xB3, 0xDB, 0xEE,
-						0x37, 0x3C, 0x2E, 0x9F, 0xD3,
-						0xEB, 0xF6, 0x3B, 0x3E, 0xAF,
-						0x6F, 0xC5, 0x64, 0x33, 0x5A,
-						0xCD, 0x76, 0xC3, 0xE5, 0x60 };
-
-static unsigned char send_ussd_171[] = { 0xD0, 0x44, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x8A, 0x39, 0xF0, 0x41, 0xE1,
-						0x90, 0x58, 0x34, 0x1E, 0x91,
-						0x49, 0xE5, 0x92, 0xD9, 0x74,
-						0x3E, 0xA1, 0x51, 0xE9, 0x94,
-						0x5A, 0xB5, 0x5E, 0xB1, 0x59,
-						0x6D, 0x2B, 0x2C, 0x1E, 0x93,
-						0xCB, 0xE6, 0x33, 0x3A, 0xAD,
-						0x5E, 0xB3, 0xDB, 0xEE, 0x37,
-						0x3C, 0x2E, 0x9F, 0xD3, 0xEB,
-						0xF6, 0x3B, 0x3E, 0xAF, 0x6F,
-						0xC5, 0x64, 0x33, 0x5A, 0xCD,
-						0x76, 0xC3, 0xE5, 0x60 };
-
-static unsigned char send_ussd_181[] = { 0xD0, 0x46, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x00, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60 };
-
-static unsigned char send_ussd_211[] = { 0xD0, 0x54, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x42, 0x61, 0x73,
-						0x69, 0x63, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60, 0x9E, 0x02, 0x00, 0x01 };
-
-static unsigned char send_ussd_221[] = { 0xD0, 0x54, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x43, 0x6F, 0x6C,
-						0x6F, 0x72, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60, 0x9E, 0x02, 0x00, 0x02 };
-
-static unsigned char send_ussd_231[] = { 0xD0, 0x54, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x42, 0x61, 0x73,
-						0x69, 0x63, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60, 0x9E, 0x02, 0x01, 0x01 };
-
-static unsigned char send_ussd_241[] = { 0xD0, 0x48, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x8A, 0x39, 0xF0, 0x41, 0xE1,
-						0x90, 0x58, 0x34, 0x1E, 0x91,
-						0x49, 0xE5, 0x92, 0xD9, 0x74,
-						0x3E, 0xA1, 0x51, 0xE9, 0x94,
-						0x5A, 0xB5, 0x5E, 0xB1, 0x59,
-						0x6D, 0x2B, 0x2C, 0x1E, 0x93,
-						0xCB, 0xE6, 0x33, 0x3A, 0xAD,
-						0x5E, 0xB3, 0xDB, 0xEE, 0x37,
-						0x3C, 0x2E, 0x9F, 0xD3, 0xEB,
-						0xF6, 0x3B, 0x3E, 0xAF, 0x6F,
-						0xC5, 0x64, 0x33, 0x5A, 0xCD,
-						0x76, 0xC3, 0xE5, 0x60, 0x9E,
-						0x02, 0x01, 0x01 };
-
-static unsigned char send_ussd_311[] = { 0xD0, 0x5F, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60 };
-
-static unsigned char send_ussd_411[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_412[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_421[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x01, 0xB4 };
-
-static unsigned char send_ussd_422[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_431[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x02, 0xB4 };
-
-static unsigned char send_ussd_432[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_441[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x04, 0xB4 };
-
-static unsigned char send_ussd_442[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_443[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_451[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x08, 0xB4 };
-
-static unsigned char send_ussd_452[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_453[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_461[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x10, 0xB4 };
-
-static unsigned char send_ussd_462[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_463[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_471[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x20, 0xB4 };
-
-static unsigned char send_ussd_472[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_473[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_481[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x40, 0xB4 };
-
-static unsigned char send_ussd_482[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_483[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_491[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x80, 0xB4 };
-
-static unsigned char send_ussd_492[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_493[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x33, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_4101[] = { 0xD0, 0x5C, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x31, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60, 0xD0, 0x04, 0x00,
-						0x10, 0x00, 0xB4 };
-
-static unsigned char send_ussd_4102[] = { 0xD0, 0x56, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x10, 0x54, 0x65, 0x78,
-						0x74, 0x20, 0x41, 0x74, 0x74,
-						0x72, 0x69, 0x62, 0x75, 0x74,
-						0x65, 0x20, 0x32, 0x8A, 0x39,
-						0xF0, 0x41, 0xE1, 0x90, 0x58,
-						0x34, 0x1E, 0x91, 0x49, 0xE5,
-						0x92, 0xD9, 0x74, 0x3E, 0xA1,
-						0x51, 0xE9, 0x94, 0x5A, 0xB5,
-						0x5E, 0xB1, 0x59, 0x6D, 0x2B,
-						0x2C, 0x1E, 0x93, 0xCB, 0xE6,
-						0x33, 0x3A, 0xAD, 0x5E, 0xB3,
-						0xDB, 0xEE, 0x37, 0x3C, 0x2E,
-						0x9F, 0xD3, 0xEB, 0xF6, 0x3B,
-						0x3E, 0xAF, 0x6F, 0xC5, 0x64,
-						0x33, 0x5A, 0xCD, 0x76, 0xC3,
-						0xE5, 0x60 };
-
-static unsigned char send_ussd_511[] = { 0xD0, 0x4B, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x4F, 0x60,
-						0x59, 0x7D, 0x8A, 0x39, 0xF0,
-						0x41, 0xE1, 0x90, 0x58, 0x34,
-						0x1E, 0x91, 0x49, 0xE5, 0x92,
-						0xD9, 0x74, 0x3E, 0xA1, 0x51,
-						0xE9, 0x94, 0x5A, 0xB5, 0x5E,
-						0xB1, 0x59, 0x6D, 0x2B, 0x2C,
-						0x1E, 0x93, 0xCB, 0xE6, 0x33,
-						0x3A, 0xAD, 0x5E, 0xB3, 0xDB,
-						0xEE, 0x37, 0x3C, 0x2E, 0x9F,
-						0xD3, 0xEB, 0xF6, 0x3B, 0x3E,
-						0xAF, 0x6F, 0xC5, 0x64, 0x33,
-						0x5A, 0xCD, 0x76, 0xC3, 0xE5,
-						0x60 };
-
-static unsigned char send_ussd_611[] = { 0xD0, 0x49, 0x81, 0x03, 0x01, 0x12,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x03, 0x80, 0x30, 0xEB,
-						0x8A, 0x39, 0xF0, 0x41, 0xE1,
-						0x90, 0x58, 0x34, 0x1E, 0x91,
-						0x49, 0xE5, 0x92, 0xD9, 0x74,
-						0x3E, 0xA1, 0x51, 0xE9, 0x94,
-						0x5A, 0xB5, 0x5E, 0xB1, 0x59,
-						0x6D, 0x2B, 0x2C, 0x1E, 0x93,
-						0xCB, 0xE6, 0x33, 0x3A, 0xAD,
-						0x5E, 0xB3, 0xDB, 0xEE, 0x37,
-						0x3C, 0x2E, 0x9F, 0xD3, 0xEB,
-						0xF6, 0x3B, 0x3E, 0xAF, 0x6F,
-						0xC5, 0x64, 0x33, 0x5A, 0xCD,
-						0x76, 0xC3, 0xE5, 0x60 };
-
 static struct send_ussd_test send_ussd_data_111 = {
 	.pdu = send_ussd_111,
 	.pdu_len = sizeof(send_ussd_111),
@@ -10303,541 +6839,6 @@ struct setup_call_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char setup_call_111[] = { 0xD0, 0x1E, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x08, 0x4E, 0x6F, 0x74,
-						0x20, 0x62, 0x75, 0x73, 0x79,
-						0x86, 0x09, 0x91, 0x10, 0x32,
-						0x04, 0x21, 0x43, 0x65, 0x1C,
-						0x2C };
-
-static unsigned char setup_call_141[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x10,
-						0x02, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x07, 0x4F, 0x6E, 0x20,
-						0x68, 0x6F, 0x6C, 0x64, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C };
-
-static unsigned char setup_call_151[] = { 0xD0, 0x20, 0x81, 0x03, 0x01, 0x10,
-						0x04, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x44, 0x69, 0x73,
-						0x63, 0x6F, 0x6E, 0x6E, 0x65,
-						0x63, 0x74, 0x86, 0x09, 0x91,
-						0x10, 0x32, 0x04, 0x21, 0x43,
-						0x65, 0x1C, 0x2C };
-
-static unsigned char setup_call_181[] = { 0xD0, 0x2B, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x11, 0x43, 0x61, 0x70,
-						0x61, 0x62, 0x69, 0x6C, 0x69,
-						0x74, 0x79, 0x20, 0x63, 0x6F,
-						0x6E, 0x66, 0x69, 0x67, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x87, 0x02, 0x01, 0xA0 };
-
-static unsigned char setup_call_191[] = { 0xD0, 0x1C, 0x81, 0x03, 0x01, 0x10,
-						0x01, 0x82, 0x02, 0x81, 0x83,
-						0x86, 0x11, 0x91, 0x10, 0x32,
-						0x54, 0x76, 0x98, 0x10, 0x32,
-						0x54, 0x76, 0x98, 0x10, 0x32,
-						0x54, 0x76, 0x98, 0x10 };
-
-static unsigned char setup_call_1101[] = { 0xD0, 0x81, 0xFD, 0x81, 0x03, 0x01,
-						0x10, 0x01, 0x82, 0x02, 0x81,
-						0x83, 0x85, 0x81, 0xED, 0x54,
-						0x68, 0x72, 0x65, 0x65, 0x20,
-						0x74, 0x79, 0x70, 0x65, 0x73,
-						0x20, 0x61, 0x72, 0x65, 0x20,
-						0x64, 0x65, 0x66, 0x69, 0x6E,
-						0x65, 0x64, 0x3A, 0x20, 0x2D,
-						0x20, 0x73, 0x65, 0x74, 0x20,
-						0x75, 0x70, 0x20, 0x61, 0x20,
-						0x63, 0x61, 0x6C, 0x6C, 0x2C,
-						0x20, 0x62, 0x75, 0x74, 0x20,
-						0x6F, 0x6E, 0x6C, 0x79, 0x20,
-						0x69, 0x66, 0x20, 0x6E, 0x6F,
-						0x74, 0x20, 0x63, 0x75, 0x72,
-						0x72, 0x65, 0x6E, 0x74, 0x6C,
-						0x79, 0x20, 0x62, 0x75, 0x73,
-						0x79, 0x20, 0x6F, 0x6E, 0x20,
-						0x61, 0x6E, 0x6F, 0x74, 0x68,
-						0x65, 0x72, 0x20, 0x63, 0x61,
-						0x6C, 0x6C, 0x3B, 0x20, 0x2D,
-						0x20, 0x73, 0x65, 0x74, 0x20,
-						0x75, 0x70, 0x20, 0x61, 0x20,
-						0x63, 0x61, 0x6C, 0x6C, 0x2C,
-						0x20, 0x70, 0x75, 0x74, 0x74,
-						0x69, 0x6E, 0x67, 0x20, 0x61,
-						0x6C, 0x6C, 0x20, 0x6F, 0x74,
-						0x68, 0x65, 0x72, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x73, 0x20,
-						0x28, 0x69, 0x66, 0x20, 0x61,
-						0x6E, 0x79, 0x29, 0x20, 0x6F,
-						0x6E, 0x20, 0x68, 0x6F, 0x6C,
-						0x64, 0x3B, 0x20, 0x2D, 0x20,
-						0x73, 0x65, 0x74, 0x20, 0x75,
-						0x70, 0x20, 0x61, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x2C, 0x20,
-						0x64, 0x69, 0x73, 0x63, 0x6F,
-						0x6E, 0x6E, 0x65, 0x63, 0x74,
-						0x69, 0x6E, 0x67, 0x20, 0x61,
-						0x6C, 0x6C, 0x20, 0x6F, 0x74,
-						0x68, 0x65, 0x72, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x73, 0x20,
-						0x28, 0x69, 0x66, 0x20, 0x61,
-						0x6E, 0x79, 0x29, 0x20, 0x66,
-						0x69, 0x72, 0x73, 0x74, 0x2E,
-						0x20, 0x46, 0x6F, 0x72, 0x20,
-						0x65, 0x61, 0x63, 0x68, 0x20,
-						0x6F, 0x66, 0x20, 0x74, 0x68,
-						0x65, 0x73, 0x65, 0x20, 0x74,
-						0x79, 0x70, 0x65, 0x73, 0x2C,
-						0x20, 0x86, 0x02, 0x91, 0x10 };
-
-static unsigned char setup_call_1111[] = { 0xD0, 0x2B, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0C, 0x43, 0x61, 0x6C,
-						0x6C, 0x65, 0x64, 0x20, 0x70,
-						0x61, 0x72, 0x74, 0x79, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x88, 0x07, 0x80, 0x50, 0x95,
-						0x95, 0x95, 0x95, 0x95 };
-
-static unsigned char setup_call_1121[] = { 0xD0, 0x22, 0x81, 0x03, 0x01, 0x10,
-						0x01, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x08, 0x44, 0x75, 0x72,
-						0x61, 0x74, 0x69, 0x6F, 0x6E,
-						0x86, 0x09, 0x91, 0x10, 0x32,
-						0x04, 0x21, 0x43, 0x65, 0x1C,
-						0x2C, 0x84, 0x02, 0x01, 0x0A };
-
-static unsigned char setup_call_211[] = { 0xD0, 0x28, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0C, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x85, 0x04, 0x43, 0x41, 0x4C,
-						0x4C };
-
-static unsigned char setup_call_311[] = { 0xD0, 0x30, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x16, 0x53, 0x65, 0x74,
-						0x20, 0x75, 0x70, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0x20, 0x33,
-						0x2E, 0x31, 0x2E, 0x31, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x9E, 0x02, 0x01, 0x01 };
-
-static unsigned char setup_call_321[] = { 0xD0, 0x30, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x16, 0x53, 0x65, 0x74,
-						0x20, 0x75, 0x70, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0x20, 0x33,
-						0x2E, 0x32, 0x2E, 0x31, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x9E, 0x02, 0x00, 0x01 };
-
-static unsigned char setup_call_331[] = { 0xD0, 0x30, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x16, 0x53, 0x65, 0x74,
-						0x20, 0x75, 0x70, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0x20, 0x33,
-						0x2E, 0x33, 0x2E, 0x31, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x9E, 0x02, 0x01, 0x02 };
-
-static unsigned char setup_call_341[] = { 0xD0, 0x4C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x16, 0x53, 0x65, 0x74,
-						0x20, 0x75, 0x70, 0x20, 0x63,
-						0x61, 0x6C, 0x6C, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0x20, 0x33,
-						0x2E, 0x34, 0x2E, 0x31, 0x86,
-						0x09, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x1C, 0x2C,
-						0x9E, 0x02, 0x00, 0x01, 0x85,
-						0x16, 0x53, 0x65, 0x74, 0x20,
-						0x75, 0x70, 0x20, 0x63, 0x61,
-						0x6C, 0x6C, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0x20, 0x33, 0x2E,
-						0x34, 0x2E, 0x32, 0x9E, 0x02,
-						0x00, 0x01 };
-
-static unsigned char setup_call_411[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_412[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32 };
-
-static unsigned char setup_call_421[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x01,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x01, 0xB4 };
-
-static unsigned char setup_call_422[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32 };
-
-static unsigned char setup_call_431[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x02,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x02, 0xB4 };
-
-static unsigned char setup_call_432[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32 };
-
-static unsigned char setup_call_441[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x04,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x04, 0xB4 };
-
-static unsigned char setup_call_442[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_443[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x33, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x33 };
-
-static unsigned char setup_call_451[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x08,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x08, 0xB4 };
-
-static unsigned char setup_call_452[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_453[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x33, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x33 };
-
-static unsigned char setup_call_461[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x10,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x10, 0xB4 };
-
-static unsigned char setup_call_462[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_463[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x33, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x33 };
-
-static unsigned char setup_call_471[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x20,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x20, 0xB4 };
-
-static unsigned char setup_call_472[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_473[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x33, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x33 };
-
-static unsigned char setup_call_481[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x40,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x40, 0xB4 };
-
-static unsigned char setup_call_482[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_483[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x33, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x33 };
-
-static unsigned char setup_call_491[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x80,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x80, 0xB4 };
-
-static unsigned char setup_call_492[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0xB4 };
-
-static unsigned char setup_call_493[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x33, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x33 };
-
-static unsigned char setup_call_4101[] = { 0xD0, 0x38, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x31, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x31,
-						0xD0, 0x04, 0x00, 0x0E, 0x00,
-						0xB4, 0xD0, 0x04, 0x00, 0x06,
-						0x00, 0x4B };
-
-static unsigned char setup_call_4102[] = { 0xD0, 0x2C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0E, 0x43, 0x4F, 0x4E,
-						0x46, 0x49, 0x52, 0x4D, 0x41,
-						0x54, 0x49, 0x4F, 0x4E, 0x20,
-						0x32, 0x86, 0x09, 0x91, 0x10,
-						0x32, 0x04, 0x21, 0x43, 0x65,
-						0x1C, 0x2C, 0x85, 0x06, 0x43,
-						0x41, 0x4C, 0x4C, 0x20, 0x32 };
-
-static unsigned char setup_call_511[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x86, 0x07, 0x91,
-						0x10, 0x32, 0x04, 0x21, 0x43,
-						0x65 };
-
-static unsigned char setup_call_521[] = { 0xD0, 0x4C, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x1B, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0x00, 0x31, 0x86,
-						0x07, 0x91, 0x10, 0x32, 0x04,
-						0x21, 0x43, 0x65, 0x85, 0x1B,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15,
-						0x00, 0x32 };
-
-static unsigned char setup_call_611[] = { 0xD0, 0x19, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x4E, 0x0D,
-						0x5F, 0xD9, 0x86, 0x07, 0x91,
-						0x10, 0x32, 0x04, 0x21, 0x43,
-						0x65 };
-
-static unsigned char setup_call_621[] = { 0xD0, 0x22, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x78, 0x6E,
-						0x5B, 0x9A, 0x86, 0x07, 0x91,
-						0x10, 0x32, 0x04, 0x21, 0x43,
-						0x65, 0x85, 0x07, 0x80, 0x62,
-						0x53, 0x75, 0x35, 0x8B, 0xDD };
-
-static unsigned char setup_call_711[] = { 0xD0, 0x17, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x03, 0x80, 0x30, 0xEB,
-						0x86, 0x07, 0x91, 0x10, 0x32,
-						0x04, 0x21, 0x43, 0x65 };
-
-static unsigned char setup_call_721[] = { 0xD0, 0x20, 0x81, 0x03, 0x01, 0x10,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x30, 0xEB,
-						0x00, 0x31, 0x86, 0x07, 0x91,
-						0x10, 0x32, 0x04, 0x21, 0x43,
-						0x65, 0x85, 0x05, 0x80, 0x30,
-						0xEB, 0x00, 0x32 };
-
 static struct setup_call_test setup_call_data_111 = {
 	.pdu = setup_call_111,
 	.pdu_len = sizeof(setup_call_111),
@@ -11577,14 +7578,6 @@ struct refresh_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char refresh_121[] = { 0xD0, 0x10, 0x81, 0x03, 0x01, 0x01,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x92, 0x05, 0x01, 0x3F, 0x00,
-						0x2F, 0xE2 };
-
-static unsigned char refresh_151[] = { 0xD0, 0x09, 0x81, 0x03, 0x01, 0x01,
-						0x04, 0x82, 0x02, 0x81, 0x82 };
-
 static struct refresh_test refresh_data_121 = {
 	.pdu = refresh_121,
 	.pdu_len = sizeof(refresh_121),
@@ -11635,9 +7628,6 @@ struct polling_off_test {
 	unsigned char qualifier;
 };
 
-static unsigned char polling_off_112[] = { 0xD0, 0x09, 0x81, 0x03, 0x01, 0x04,
-						0x00, 0x82, 0x02, 0x81, 0x82 };
-
 static struct polling_off_test polling_off_data_112 = {
 	.pdu = polling_off_112,
 	.pdu_len = sizeof(polling_off_112),
@@ -11670,30 +7660,6 @@ struct provide_local_info_test {
 	unsigned char qualifier;
 };
 
-static unsigned char provide_local_info_121[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x26, 0x01, 0x82, 0x02, 0x81,
-						0x82 };
-
-static unsigned char provide_local_info_141[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x26, 0x03, 0x82, 0x02, 0x81,
-						0x82 };
-
-static unsigned char provide_local_info_151[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x26, 0x04, 0x82, 0x02, 0x81,
-						0x82 };
-
-static unsigned char provide_local_info_181[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x26, 0x07, 0x82, 0x02, 0x81,
-						0x82 };
-
-static unsigned char provide_local_info_191[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x26, 0x08, 0x82, 0x02, 0x81,
-						0x82 };
-
-static unsigned char provide_local_info_1111[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x26, 0x0A, 0x82, 0x02, 0x81,
-						0x82 };
-
 static struct provide_local_info_test provide_local_info_data_121 = {
 	.pdu = provide_local_info_121,
 	.pdu_len = sizeof(provide_local_info_121),
@@ -11757,30 +7723,6 @@ struct setup_event_list_test {
 	struct stk_event_list event_list;
 };
 
-static unsigned char setup_event_list_111[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01,
-						0x05, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x99, 0x01, 0x04 };
-
-static unsigned char setup_event_list_121[] = { 0xD0, 0x0D, 0x81, 0x03, 0x01,
-						0x05, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x99, 0x02, 0x05, 0x07 };
-
-static unsigned char setup_event_list_122[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01,
-						0x05, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x99, 0x01, 0x07 };
-
-static unsigned char setup_event_list_131[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01,
-						0x05, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x99, 0x01, 0x07 };
-
-static unsigned char setup_event_list_132[] = { 0xD0, 0x0B, 0x81, 0x03, 0x01,
-						0x05, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x99, 0x00 };
-
-static unsigned char setup_event_list_141[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01,
-						0x05, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x99, 0x01, 0x07 };
-
 static struct setup_event_list_test setup_event_list_data_111 = {
 	.pdu = setup_event_list_111,
 	.pdu_len = sizeof(setup_event_list_111),
@@ -11869,61 +7811,6 @@ struct perform_card_apdu_test {
 	struct stk_c_apdu c_apdu;
 };
 
-static unsigned char perform_card_apdu_111[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x07, 0xA0, 0xA4,
-						0x00, 0x00, 0x02, 0x3F, 0x00 };
-
-static unsigned char perform_card_apdu_112[] = { 0xD0, 0x10, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x05, 0xA0, 0xC0,
-						0x00, 0x00, 0x1B };
-
-static unsigned char perform_card_apdu_121[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x07, 0xA0, 0xA4,
-						0x00, 0x00, 0x02, 0x7F, 0x20 };
-
-static unsigned char perform_card_apdu_122[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x07, 0xA0, 0xA4,
-						0x00, 0x00, 0x02, 0x6F, 0x30 };
-
-static unsigned char perform_card_apdu_123[] = { 0xD0, 0x28, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x1D, 0xA0, 0xD6,
-						0x00, 0x00, 0x18, 0x00, 0x01,
-						0x02, 0x03, 0x04, 0x05, 0x06,
-						0x07, 0x08, 0x09, 0x0A, 0x0B,
-						0x0C, 0x0D, 0x0E, 0x0F, 0x10,
-						0x11, 0x12, 0x13, 0x14, 0x15,
-						0x16, 0x17 };
-
-static unsigned char perform_card_apdu_124[] = { 0xD0, 0x10, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x05, 0xA0, 0xB0,
-						0x00, 0x00, 0x18 };
-
-static unsigned char perform_card_apdu_125[] = { 0xD0, 0x28, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x1D, 0xA0, 0xD6,
-						0x00, 0x00, 0x18, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF };
-
-static unsigned char perform_card_apdu_151[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x17, 0xA2, 0x07, 0xA0, 0xA4,
-						0x00, 0x00, 0x02, 0x3F, 0x00 };
-
-static unsigned char perform_card_apdu_211[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x30, 0x00, 0x82, 0x02, 0x81,
-						0x11, 0xA2, 0x07, 0xA0, 0xA4,
-						0x00, 0x00, 0x02, 0x3F, 0x00 };
-
 static struct perform_card_apdu_test perform_card_apdu_data_111 = {
 	.pdu = perform_card_apdu_111,
 	.pdu_len = sizeof(perform_card_apdu_111),
@@ -12092,10 +7979,6 @@ struct get_reader_status_test {
 	unsigned char qualifier;
 };
 
-static unsigned char get_reader_status_111[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-						0x33, 0x00, 0x82, 0x02, 0x81,
-						0x82 };
-
 static struct get_reader_status_test get_reader_status_data_111 = {
 	.pdu = get_reader_status_111,
 	.pdu_len = sizeof(get_reader_status_111),
@@ -12137,174 +8020,6 @@ struct timer_mgmt_test {
 	struct stk_timer_value timer_value;
 };
 
-static unsigned char timer_mgmt_111[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01, 0xA5, 0x03,
-						0x00, 0x50, 0x00 };
-
-static unsigned char timer_mgmt_112[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01 };
-
-static unsigned char timer_mgmt_113[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01, 0xA5, 0x03,
-						0x00, 0x10, 0x03 };
-
-static unsigned char timer_mgmt_114[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01 };
-
-static unsigned char timer_mgmt_121[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02, 0xA5, 0x03,
-						0x32, 0x95, 0x95 };
-
-static unsigned char timer_mgmt_122[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02 };
-
-static unsigned char timer_mgmt_123[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02, 0xA5, 0x03,
-						0x00, 0x10, 0x01 };
-
-static unsigned char timer_mgmt_124[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02 };
-
-static unsigned char timer_mgmt_131[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08, 0xA5, 0x03,
-						0x00, 0x02, 0x00 };
-
-static unsigned char timer_mgmt_132[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08 };
-
-static unsigned char timer_mgmt_133[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08, 0xA5, 0x03,
-						0x10, 0x00, 0x00 };
-
-static unsigned char timer_mgmt_134[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08 };
-
-static unsigned char timer_mgmt_141[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01 };
-
-static unsigned char timer_mgmt_142[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02 };
-
-static unsigned char timer_mgmt_143[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x03 };
-
-static unsigned char timer_mgmt_144[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x04 };
-
-static unsigned char timer_mgmt_145[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x05 };
-
-static unsigned char timer_mgmt_146[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x06 };
-
-static unsigned char timer_mgmt_147[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x07 };
-
-static unsigned char timer_mgmt_148[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x02, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08 };
-
-static unsigned char timer_mgmt_151[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01 };
-
-static unsigned char timer_mgmt_152[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02 };
-
-static unsigned char timer_mgmt_153[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x03 };
-
-static unsigned char timer_mgmt_154[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x04 };
-
-static unsigned char timer_mgmt_155[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x05 };
-
-static unsigned char timer_mgmt_156[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x06 };
-
-static unsigned char timer_mgmt_157[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x07 };
-
-static unsigned char timer_mgmt_158[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x27,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08 };
-
-static unsigned char timer_mgmt_161[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_162[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x02, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_163[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x03, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_164[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x04, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_165[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x05, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_166[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x06, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_167[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x07, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_168[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x08, 0xA5, 0x03,
-						0x00, 0x00, 0x50 };
-
-static unsigned char timer_mgmt_211[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01, 0xA5, 0x03,
-						0x00, 0x00, 0x01 };
-
-static unsigned char timer_mgmt_221[] = { 0xD0, 0x11, 0x81, 0x03, 0x01, 0x27,
-						0x00, 0x82, 0x02, 0x81, 0x82,
-						0xA4, 0x01, 0x01, 0xA5, 0x03,
-						0x00, 0x00, 0x03 };
-
 static struct timer_mgmt_test timer_mgmt_data_111 = {
 	.pdu = timer_mgmt_111,
 	.pdu_len = sizeof(timer_mgmt_111),
@@ -12658,347 +8373,6 @@ struct setup_idle_mode_text_test {
 	enum stk_command_parse_result status;
 };
 
-static unsigned char setup_idle_mode_text_111[] = { 0xD0, 0x1A, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x0F, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74 };
-
-static unsigned char setup_idle_mode_text_121[] = { 0xD0, 0x18, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x0D, 0x04,
-						0x54, 0x6F, 0x6F, 0x6C, 0x6B,
-						0x69, 0x74, 0x20, 0x54, 0x65,
-						0x73, 0x74 };
-
-static unsigned char setup_idle_mode_text_131[] = { 0xD0, 0x0B, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x00 };
-
-static unsigned char setup_idle_mode_text_171[] = { 0xD0, 0x81, 0xFD, 0x81,
-						0x03, 0x01, 0x28, 0x00, 0x82,
-						0x02, 0x81, 0x82, 0x8D, 0x81,
-						0xF1, 0x00, 0x54, 0x74, 0x19,
-						0x34, 0x4D, 0x36, 0x41, 0x73,
-						0x74, 0x98, 0xCD, 0x06, 0xCD,
-						0xEB, 0x70, 0x38, 0x3B, 0x0F,
-						0x0A, 0x83, 0xE8, 0x65, 0x3C,
-						0x1D, 0x34, 0xA7, 0xCB, 0xD3,
-						0xEE, 0x33, 0x0B, 0x74, 0x47,
-						0xA7, 0xC7, 0x68, 0xD0, 0x1C,
-						0x1D, 0x66, 0xB3, 0x41, 0xE2,
-						0x32, 0x88, 0x9C, 0x9E, 0xC3,
-						0xD9, 0xE1, 0x7C, 0x99, 0x0C,
-						0x12, 0xE7, 0x41, 0x74, 0x74,
-						0x19, 0xD4, 0x2C, 0x82, 0xC2,
-						0x73, 0x50, 0xD8, 0x0D, 0x4A,
-						0x93, 0xD9, 0x65, 0x50, 0xFB,
-						0x4D, 0x2E, 0x83, 0xE8, 0x65,
-						0x3C, 0x1D, 0x94, 0x36, 0x83,
-						0xE8, 0xE8, 0x32, 0xA8, 0x59,
-						0x04, 0xA5, 0xE7, 0xA0, 0xB0,
-						0x98, 0x5D, 0x06, 0xD1, 0xDF,
-						0x20, 0xF2, 0x1B, 0x94, 0xA6,
-						0xBB, 0xA8, 0xE8, 0x32, 0x08,
-						0x2E, 0x2F, 0xCF, 0xCB, 0x6E,
-						0x7A, 0x98, 0x9E, 0x7E, 0xBB,
-						0x41, 0x73, 0x7A, 0x9E, 0x5D,
-						0x06, 0xA5, 0xE7, 0x20, 0x76,
-						0xD9, 0x4C, 0x07, 0x85, 0xE7,
-						0xA0, 0xB0, 0x1B, 0x94, 0x6E,
-						0xC3, 0xD9, 0xE5, 0x76, 0xD9,
-						0x4D, 0x0F, 0xD3, 0xD3, 0x6F,
-						0x37, 0x88, 0x5C, 0x1E, 0xA7,
-						0xE7, 0xE9, 0xB7, 0x1B, 0x44,
-						0x7F, 0x83, 0xE8, 0xE8, 0x32,
-						0xA8, 0x59, 0x04, 0xB5, 0xC3,
-						0xEE, 0xBA, 0x39, 0x3C, 0xA6,
-						0xD7, 0xE5, 0x65, 0xB9, 0x0B,
-						0x44, 0x45, 0x97, 0x41, 0x69,
-						0x32, 0xBB, 0x0C, 0x6A, 0xBF,
-						0xC9, 0x65, 0x10, 0xBD, 0x8C,
-						0xA7, 0x83, 0xE6, 0xE8, 0x30,
-						0x9B, 0x0D, 0x12, 0x97, 0x41,
-						0xE4, 0xF4, 0x1C, 0xCE, 0x0E,
-						0xE7, 0xCB, 0x64, 0x50, 0xDA,
-						0x0D, 0x0A, 0x83, 0xDA, 0x61,
-						0xB7, 0xBB, 0x2C, 0x07, 0xD1,
-						0xD1, 0x61, 0x3A, 0xA8, 0xEC,
-						0x9E, 0xD7, 0xE5, 0xE5, 0x39,
-						0x88, 0x8E, 0x0E, 0xD3, 0x41,
-						0xEE, 0x32 };
-
-static unsigned char setup_idle_mode_text_211[] = { 0xD0, 0x19, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x0A, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x74, 0x65, 0x78, 0x74, 0x9E,
-						0x02, 0x00, 0x01 };
-
-static unsigned char setup_idle_mode_text_221[] = { 0xD0, 0x19, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x0A, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x74, 0x65, 0x78, 0x74, 0x9E,
-						0x02, 0x01, 0x01 };
-
-static unsigned char setup_idle_mode_text_231[] = { 0xD0, 0x19, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x0A, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x74, 0x65, 0x78, 0x74, 0x9E,
-						0x02, 0x00, 0x02 };
-
-static unsigned char setup_idle_mode_text_241[] = { 0xD0, 0x0F, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x00, 0x9E,
-						0x02, 0x01, 0x01 };
-
-static unsigned char setup_idle_mode_text_311[] = { 0xD0, 0x24, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x19, 0x08,
-						0x04, 0x17, 0x04, 0x14, 0x04,
-						0x20, 0x04, 0x10, 0x04, 0x12,
-						0x04, 0x21, 0x04, 0x22, 0x04,
-						0x12, 0x04, 0x23, 0x04, 0x19,
-						0x04, 0x22, 0x04, 0x15 };
-
-static unsigned char setup_idle_mode_text_411[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_412[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32 };
-
-static unsigned char setup_idle_mode_text_421[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x01, 0xB4 };
-
-static unsigned char setup_idle_mode_text_422[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32 };
-
-static unsigned char setup_idle_mode_text_431[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x02, 0xB4 };
-
-static unsigned char setup_idle_mode_text_432[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32 };
-
-static unsigned char setup_idle_mode_text_441[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x04, 0xB4 };
-
-static unsigned char setup_idle_mode_text_442[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_443[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x33 };
-
-static unsigned char setup_idle_mode_text_451[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x08, 0xB4 };
-
-static unsigned char setup_idle_mode_text_452[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_453[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x33 };
-
-static unsigned char setup_idle_mode_text_461[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x10, 0xB4 };
-
-static unsigned char setup_idle_mode_text_462[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_463[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x33 };
-
-static unsigned char setup_idle_mode_text_471[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x20, 0xB4 };
-
-static unsigned char setup_idle_mode_text_472[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_473[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x33 };
-
-static unsigned char setup_idle_mode_text_481[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x40, 0xB4 };
-
-static unsigned char setup_idle_mode_text_482[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_483[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x33 };
-
-static unsigned char setup_idle_mode_text_491[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x80, 0xB4 };
-
-static unsigned char setup_idle_mode_text_492[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_493[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x33 };
-
-static unsigned char setup_idle_mode_text_4101[] = { 0xD0, 0x22, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x31, 0xD0, 0x04, 0x00, 0x10,
-						0x00, 0xB4 };
-
-static unsigned char setup_idle_mode_text_4102[] = { 0xD0, 0x1C, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x11, 0x04,
-						0x49, 0x64, 0x6C, 0x65, 0x20,
-						0x4D, 0x6F, 0x64, 0x65, 0x20,
-						0x54, 0x65, 0x78, 0x74, 0x20,
-						0x32 };
-
-static unsigned char setup_idle_mode_text_511[] = { 0xD0, 0x10, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x05, 0x08,
-						0x4F, 0x60, 0x59, 0x7D };
-
-static unsigned char setup_idle_mode_text_611[] = { 0xD0, 0x14, 0x81, 0x03,
-						0x01, 0x28, 0x00, 0x82, 0x02,
-						0x81, 0x82, 0x8D, 0x09, 0x08,
-						0x00, 0x38, 0x00, 0x30, 0x30,
-						0xEB, 0x00, 0x30 };
-
 static struct setup_idle_mode_text_test setup_idle_mode_text_data_111 = {
 	.pdu = setup_idle_mode_text_111,
 	.pdu_len = sizeof(setup_idle_mode_text_111),
@@ -13433,345 +8807,6 @@ struct run_at_command_test {
 	enum stk_command_parse_result status;
 };
 
-static unsigned char run_at_command_111[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0xA8, 0x07, 0x41, 0x54,
-						0x2B, 0x43, 0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_121[] = { 0xD0, 0x14, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x00, 0xA8, 0x07,
-						0x41, 0x54, 0x2B, 0x43, 0x47,
-						0x4D, 0x49 };
-
-static unsigned char run_at_command_131[] = { 0xD0, 0x22, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0E, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0xA8, 0x07, 0x41,
-						0x54, 0x2B, 0x43, 0x47, 0x4D,
-						0x49 };
-
-static unsigned char run_at_command_211[] = { 0xD0, 0x22, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x42, 0x61,
-						0x73, 0x69, 0x63, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0xA8, 0x07,
-						0x41, 0x54, 0x2B, 0x43, 0x47,
-						0x4D, 0x49, 0x9E, 0x02, 0x00,
-						0x01 };
-
-/* The 12th byte should be 0x85, instead of 0xA8 */
-static unsigned char run_at_command_221[] = { 0xD0, 0x23, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0B, 0x43, 0x6F,
-						0x6C, 0x6F, 0x75, 0x72, 0x20,
-						0x49, 0x63, 0x6F, 0x6E, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0x9E, 0x02,
-						0x00, 0x02 };
-
-static unsigned char run_at_command_231[] = { 0xD0, 0x22, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0A, 0x42, 0x61,
-						0x73, 0x69, 0x63, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0xA8, 0x07,
-						0x41, 0x54, 0x2B, 0x43, 0x47,
-						0x4D, 0x49, 0x9E, 0x02, 0x01,
-						0x01 };
-
-static unsigned char run_at_command_241[] = { 0xD0, 0x23, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x0B, 0x43, 0x6F,
-						0x6C, 0x6F, 0x75, 0x72, 0x20,
-						0x49, 0x63, 0x6F, 0x6E, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0x9E, 0x02,
-						0x01, 0x02 };
-
-static unsigned char run_at_command_251[] = { 0xD0, 0x16, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0xA8, 0x07, 0x41, 0x54,
-						0x2B, 0x43, 0x47, 0x4D, 0x49,
-						0x9E, 0x02, 0x01, 0x01 };
-
-static unsigned char run_at_command_311[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_312[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_321[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x01, 0xB4 };
-
-static unsigned char run_at_command_322[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_331[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x02, 0xB4 };
-
-static unsigned char run_at_command_332[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_341[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x04, 0xB4 };
-
-static unsigned char run_at_command_342[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_343[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x33, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_351[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x08, 0xB4 };
-
-static unsigned char run_at_command_352[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_353[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x33, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_361[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x10, 0xB4 };
-
-static unsigned char run_at_command_362[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_363[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x33, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_371[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x20, 0xB4 };
-
-static unsigned char run_at_command_372[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_373[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x33, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_381[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x40, 0xB4 };
-
-static unsigned char run_at_command_382[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_383[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x33, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_391[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x80, 0xB4 };
-
-static unsigned char run_at_command_392[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_393[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x33, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-static unsigned char run_at_command_3101[] = { 0xD0, 0x2A, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x31, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49, 0xD0, 0x04,
-						0x00, 0x10, 0x00, 0xB4 };
-
-static unsigned char run_at_command_3102[] = { 0xD0, 0x24, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x10, 0x52, 0x75,
-						0x6E, 0x20, 0x41, 0x54, 0x20,
-						0x43, 0x6F, 0x6D, 0x6D, 0x61,
-						0x6E, 0x64, 0x20, 0x32, 0xA8,
-						0x07, 0x41, 0x54, 0x2B, 0x43,
-						0x47, 0x4D, 0x49 };
-
-/* The 2nd byte (total size) should be 0x2D, instead of 0x21 */
-static unsigned char run_at_command_411[] = { 0xD0, 0x2D, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x19, 0x80, 0x04,
-						0x17, 0x04, 0x14, 0x04, 0x20,
-						0x04, 0x10, 0x04, 0x12, 0x04,
-						0x21, 0x04, 0x22, 0x04, 0x12,
-						0x04, 0x23, 0x04, 0x19, 0x04,
-						0x22, 0x04, 0x15, 0xA8, 0x07,
-						0x41, 0x54, 0x2B, 0x43, 0x47,
-						0x4D, 0x49 };
-
-static unsigned char run_at_command_511[] = { 0xD0, 0x19, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x05, 0x80, 0x4F,
-						0x60, 0x59, 0x7D, 0xA8, 0x07,
-						0x41, 0x54, 0x2B, 0x43, 0x47,
-						0x4D, 0x49 };
-
-static unsigned char run_at_command_611[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01,
-						0x34, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x85, 0x07, 0x80, 0x00,
-						0x38, 0x00, 0x30, 0x30, 0xEB,
-						0xA8, 0x07, 0x41, 0x54, 0x2B,
-						0x43, 0x47, 0x4D, 0x49 };
-
 static struct run_at_command_test run_at_command_data_111 = {
 	.pdu = run_at_command_111,
 	.pdu_len = sizeof(run_at_command_111),
@@ -14189,281 +9224,6 @@ struct send_dtmf_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char send_dtmf_111[] = { 0xD0, 0x0D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0xAC, 0x02, 0xC1, 0xF2 };
-
-static unsigned char send_dtmf_121[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x09, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0xAC, 0x05, 0x21, 0x43,
-						0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_131[] = { 0xD0, 0x13, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x00, 0xAC, 0x06, 0xC1,
-						0xCC, 0xCC, 0xCC, 0xCC, 0x2C };
-
-static unsigned char send_dtmf_211[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0A, 0x42, 0x61, 0x73,
-						0x69, 0x63, 0x20, 0x49, 0x63,
-						0x6F, 0x6E, 0xAC, 0x02, 0xC1,
-						0xF2, 0x9E, 0x02, 0x00, 0x01 };
-
-static unsigned char send_dtmf_221[] = { 0xD0, 0x1E, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x43, 0x6F, 0x6C,
-						0x6F, 0x75, 0x72, 0x20, 0x49,
-						0x63, 0x6F, 0x6E, 0xAC, 0x02,
-						0xC1, 0xF2, 0x9E, 0x02, 0x00,
-						0x02 };
-
-static unsigned char send_dtmf_231[] = { 0xD0, 0x1C, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x09, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0xAC, 0x02, 0xC1, 0xF2,
-						0x9E, 0x02, 0x01, 0x01 };
-
-static unsigned char send_dtmf_311[] = { 0xD0, 0x28, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x19, 0x80, 0x04, 0x17,
-						0x04, 0x14, 0x04, 0x20, 0x04,
-						0x10, 0x04, 0x12, 0x04, 0x21,
-						0x04, 0x22, 0x04, 0x12, 0x04,
-						0x23, 0x04, 0x19, 0x04, 0x22,
-						0x04, 0x15, 0xAC, 0x02, 0xC1,
-						0xF2 };
-
-static unsigned char send_dtmf_411[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_412[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_421[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x01,
-						0xB4 };
-
-static unsigned char send_dtmf_422[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_431[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0xB0, 0x02,
-						0xB4 };
-
-static unsigned char send_dtmf_432[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_441[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x04,
-						0xB4 };
-
-static unsigned char send_dtmf_442[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_443[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x33, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_451[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x08,
-						0xB4 };
-
-static unsigned char send_dtmf_452[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_453[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x33, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-/* The last 0x00 in spec should be removed. */
-static unsigned char send_dtmf_461[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x10,
-						0xB4 };
-
-static unsigned char send_dtmf_462[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_463[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x33, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_471[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x20,
-						0xB4 };
-
-static unsigned char send_dtmf_472[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_473[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x33, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_481[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x40,
-						0xB4 };
-
-static unsigned char send_dtmf_482[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_483[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x33, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-/* The second to the last should be 0x80 */
-static unsigned char send_dtmf_491[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x80,
-						0xB4 };
-
-static unsigned char send_dtmf_492[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_493[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x33, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_4101[] = { 0xD0, 0x23, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x31, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09,
-						0xD0, 0x04, 0x00, 0x0B, 0x00,
-						0xB4 };
-
-static unsigned char send_dtmf_4102[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x0B, 0x53, 0x65, 0x6E,
-						0x64, 0x20, 0x44, 0x54, 0x4D,
-						0x46, 0x20, 0x32, 0xAC, 0x05,
-						0x21, 0x43, 0x65, 0x87, 0x09 };
-
-static unsigned char send_dtmf_511[] = { 0xD0, 0x14, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x05, 0x80, 0x4F, 0x60,
-						0x59, 0x7D, 0xAC, 0x02, 0xC1,
-						0xF2 };
-
-static unsigned char send_dtmf_611[] = { 0xD0, 0x12, 0x81, 0x03, 0x01, 0x14,
-						0x00, 0x82, 0x02, 0x81, 0x83,
-						0x85, 0x03, 0x80, 0x30, 0xEB,
-						0xAC, 0x02, 0xC1, 0xF2 };
-
 static struct send_dtmf_test send_dtmf_data_111 = {
 	.pdu = send_dtmf_111,
 	.pdu_len = sizeof(send_dtmf_111),
@@ -14852,15 +9612,6 @@ struct language_notification_test {
 	char language[3];
 };
 
-static unsigned char language_notification_111[] = { 0xD0, 0x0D, 0x81, 0x03,
-						0x01, 0x35, 0x01, 0x82, 0x02,
-						0x81, 0x82, 0xAD, 0x02, 0x73,
-						0x65 };
-
-static unsigned char language_notification_121[] = { 0xD0, 0x09, 0x81, 0x03,
-						0x01, 0x35, 0x00, 0x82, 0x02,
-						0x81, 0x82 };
-
 static struct language_notification_test language_notification_data_111 = {
 	.pdu = language_notification_111,
 	.pdu_len = sizeof(language_notification_111),
@@ -14914,285 +9665,6 @@ struct launch_browser_test {
 	char *text_passwd;
 };
 
-static unsigned char launch_browser_111[] = { 0xD0, 0x18, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0B,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C };
-
-static unsigned char launch_browser_121[] = { 0xD0, 0x1F, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x12, 0x68, 0x74,
-						0x74, 0x70, 0x3A, 0x2F, 0x2F,
-						0x78, 0x78, 0x78, 0x2E, 0x79,
-						0x79, 0x79, 0x2E, 0x7A, 0x7A,
-						0x7A, 0x05, 0x00 };
-
-static unsigned char launch_browser_131[] = { 0xD0, 0x0E, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x30, 0x01, 0x00, 0x31,
-						0x00 };
-
-static unsigned char launch_browser_141[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x32, 0x01,
-						0x03, 0x0D, 0x10, 0x04, 0x61,
-						0x62, 0x63, 0x2E, 0x64, 0x65,
-						0x66, 0x2E, 0x67, 0x68, 0x69,
-						0x2E, 0x6A, 0x6B, 0x6C };
-
-static unsigned char launch_browser_211[] = { 0xD0, 0x18, 0x81, 0x03, 0x01,
-						0x15, 0x02, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0B,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C };
-
-static unsigned char launch_browser_221[] = { 0xD0, 0x18, 0x81, 0x03, 0x01,
-						0x15, 0x03, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0B,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C };
-
-static unsigned char launch_browser_231[] = { 0xD0, 0x0B, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00 };
-
-static unsigned char launch_browser_311[] = { 0xD0, 0x26, 0x81, 0x03, 0x01,
-						0x15, 0x02, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x19,
-						0x80, 0x04, 0x17, 0x04, 0x14,
-						0x04, 0x20, 0x04, 0x10, 0x04,
-						0x12, 0x04, 0x21, 0x04, 0x22,
-						0x04, 0x12, 0x04, 0x23, 0x04,
-						0x19, 0x04, 0x22, 0x04, 0x15 };
-
-static unsigned char launch_browser_411[] = { 0xD0, 0x21, 0x81, 0x03, 0x01,
-						0x15, 0x02, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x10,
-						0x4E, 0x6F, 0x74, 0x20, 0x73,
-						0x65, 0x6C, 0x66, 0x20, 0x65,
-						0x78, 0x70, 0x6C, 0x61, 0x6E,
-						0x2E, 0x1E, 0x02, 0x01, 0x01 };
-
-static unsigned char launch_browser_421[] = { 0xD0, 0x1D, 0x81, 0x03, 0x01,
-						0x15, 0x02, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0C,
-						0x53, 0x65, 0x6C, 0x66, 0x20,
-						0x65, 0x78, 0x70, 0x6C, 0x61,
-						0x6E, 0x2E, 0x1E, 0x02, 0x00,
-						0x01 };
-
-static unsigned char launch_browser_511[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_512[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32 };
-
-static unsigned char launch_browser_521[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x01, 0xB4 };
-
-static unsigned char launch_browser_522[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32 };
-
-static unsigned char launch_browser_531[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x02, 0xB4 };
-
-static unsigned char launch_browser_532[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32 };
-
-static unsigned char launch_browser_541[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x04, 0xB4 };
-
-static unsigned char launch_browser_542[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_543[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x33 };
-
-static unsigned char launch_browser_551[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x08, 0xB4 };
-
-static unsigned char launch_browser_552[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_553[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x33 };
-
-static unsigned char launch_browser_561[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x10, 0xB4 };
-
-static unsigned char launch_browser_562[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_563[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x33 };
-
-static unsigned char launch_browser_571[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x20, 0xB4 };
-
-static unsigned char launch_browser_572[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_573[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x33 };
-
-static unsigned char launch_browser_581[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x40, 0xB4 };
-
-static unsigned char launch_browser_582[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_583[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x33 };
-
-static unsigned char launch_browser_591[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x80, 0xB4 };
-
-static unsigned char launch_browser_592[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_593[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x33 };
-
-static unsigned char launch_browser_5101[] = { 0xD0, 0x20, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x31, 0xD0, 0x04,
-						0x00, 0x0D, 0x00, 0xB4 };
-
-static unsigned char launch_browser_5102[] = { 0xD0, 0x1A, 0x81, 0x03, 0x01,
-						0x15, 0x00, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x0D,
-						0x44, 0x65, 0x66, 0x61, 0x75,
-						0x6C, 0x74, 0x20, 0x55, 0x52,
-						0x4C, 0x20, 0x32 };
-
-static unsigned char launch_browser_611[] = { 0xD0, 0x12, 0x81, 0x03, 0x01,
-						0x15, 0x02, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x05,
-						0x80, 0x4F, 0x60, 0x59, 0x7D };
-
-static unsigned char launch_browser_711[] = { 0xD0, 0x10, 0x81, 0x03, 0x01,
-						0x15, 0x02, 0x82, 0x02, 0x81,
-						0x82, 0x31, 0x00, 0x05, 0x03,
-						0x80, 0x30, 0xEB };
-
 static struct launch_browser_test launch_browser_data_111 = {
 	.pdu = launch_browser_111,
 	.pdu_len = sizeof(launch_browser_111),
@@ -15586,83 +10058,6 @@ struct open_channel_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char open_channel_211[] = { 0xD0, 0x36, 0x81, 0x03, 0x01, 0x40,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x35, 0x07, 0x02, 0x03, 0x04,
-						0x03, 0x04, 0x1F, 0x02, 0x39,
-						0x02, 0x05, 0x78, 0x0D, 0x08,
-						0xF4, 0x55, 0x73, 0x65, 0x72,
-						0x4C, 0x6F, 0x67, 0x0D, 0x08,
-						0xF4, 0x55, 0x73, 0x65, 0x72,
-						0x50, 0x77, 0x64, 0x3C, 0x03,
-						0x01, 0xAD, 0x9C, 0x3E, 0x05,
-						0x21, 0x01, 0x01, 0x01, 0x01 };
-
-static unsigned char open_channel_221[] = { 0xD0, 0x42, 0x81, 0x03, 0x01, 0x40,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x35, 0x07, 0x02, 0x03, 0x04,
-						0x03, 0x04, 0x1F, 0x02, 0x39,
-						0x02, 0x05, 0x78, 0x47, 0x0A,
-						0x06, 0x54, 0x65, 0x73, 0x74,
-						0x47, 0x70, 0x02, 0x72, 0x73,
-						0x0D, 0x08, 0xF4, 0x55, 0x73,
-						0x65, 0x72, 0x4C, 0x6F, 0x67,
-						0x0D, 0x08, 0xF4, 0x55, 0x73,
-						0x65, 0x72, 0x50, 0x77, 0x64,
-						0x3C, 0x03, 0x01, 0xAD, 0x9C,
-						0x3E, 0x05, 0x21, 0x01, 0x01,
-						0x01, 0x01 };
-
-static unsigned char open_channel_231[] = { 0xD0, 0x4B, 0x81, 0x03, 0x01, 0x40,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x05, 0x07, 0x4F, 0x70, 0x65,
-						0x6E, 0x20, 0x49, 0x44, 0x35,
-						0x07, 0x02, 0x03, 0x04, 0x03,
-						0x04, 0x1F, 0x02, 0x39, 0x02,
-						0x05, 0x78, 0x47, 0x0A, 0x06,
-						0x54, 0x65, 0x73, 0x74, 0x47,
-						0x70, 0x02, 0x72, 0x73, 0x0D,
-						0x08, 0xF4, 0x55, 0x73, 0x65,
-						0x72, 0x4C, 0x6F, 0x67, 0x0D,
-						0x08, 0xF4, 0x55, 0x73, 0x65,
-						0x72, 0x50, 0x77, 0x64, 0x3C,
-						0x03, 0x01, 0xAD, 0x9C, 0x3E,
-						0x05, 0x21, 0x01, 0x01, 0x01,
-						0x01 };
-
-static unsigned char open_channel_241[] = { 0xD0, 0x44, 0x81, 0x03, 0x01, 0x40,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x05, 0x00, 0x35, 0x07, 0x02,
-						0x03, 0x04, 0x03, 0x04, 0x1F,
-						0x02, 0x39, 0x02, 0x05, 0x78,
-						0x47, 0x0A, 0x06, 0x54, 0x65,
-						0x73, 0x74, 0x47, 0x70, 0x02,
-						0x72, 0x73, 0x0D, 0x08, 0xF4,
-						0x55, 0x73, 0x65, 0x72, 0x4C,
-						0x6F, 0x67, 0x0D, 0x08, 0xF4,
-						0x55, 0x73, 0x65, 0x72, 0x50,
-						0x77, 0x64, 0x3C, 0x03, 0x01,
-						0xAD, 0x9C, 0x3E, 0x05, 0x21,
-						0x01, 0x01, 0x01, 0x01 };
-
-static unsigned char open_channel_511[] = { 0xD0, 0x53, 0x81, 0x03, 0x01, 0x40,
-						0x01, 0x82, 0x02, 0x81, 0x82,
-						0x05, 0x09, 0x4F, 0x70, 0x65,
-						0x6E, 0x20, 0x49, 0x44, 0x20,
-						0x31, 0x35, 0x07, 0x02, 0x03,
-						0x04, 0x03, 0x04, 0x1F, 0x02,
-						0x39, 0x02, 0x05, 0x78, 0x47,
-						0x0A, 0x06, 0x54, 0x65, 0x73,
-						0x74, 0x47, 0x70, 0x02, 0x72,
-						0x73, 0x0D, 0x08, 0xF4, 0x55,
-						0x73, 0x65, 0x72, 0x4C, 0x6F,
-						0x67, 0x0D, 0x08, 0xF4, 0x55,
-						0x73, 0x65, 0x72, 0x50, 0x77,
-						0x64, 0x3C, 0x03, 0x01, 0xAD,
-						0x9C, 0x3E, 0x05, 0x21, 0x01,
-						0x01, 0x01, 0x01, 0xD0, 0x04,
-						0x00, 0x09, 0x00, 0xB4 };
-
 static struct open_channel_test open_channel_data_211 = {
 	/*
 	 * OPEN CHANNEL, immediate link establishment, GPRS, no local address
@@ -15891,9 +10286,6 @@ struct close_channel_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char close_channel_111[] = { 0xD0, 0x09, 0x81, 0x03, 0x01, 0x41,
-						0x00, 0x82, 0x02, 0x81, 0x21 };
-
 static struct close_channel_test close_channel_data_111 = {
 	.pdu = close_channel_111,
 	.pdu_len = sizeof(close_channel_111),
@@ -15901,14 +10293,6 @@ static struct close_channel_test close_channel_data_111 = {
 	.dst = STK_DEVICE_IDENTITY_TYPE_CHANNEL_1,
 };
 
-static unsigned char close_channel_211[] = { 0xD0, 0x1B, 0x81, 0x03, 0x01, 0x41,
-						0x00, 0x82, 0x02, 0x81, 0x21,
-						0x85, 0x0A, 0x43, 0x6C, 0x6F,
-						0x73, 0x65, 0x20, 0x49, 0x44,
-						0x20, 0x31, 0xD0, 0x04, 0x00,
-						0x0A, 0x00, 0xB4,
- };
-
 static struct close_channel_test close_channel_data_211 = {
 	.pdu = close_channel_211,
 	.pdu_len = sizeof(close_channel_211),
@@ -15958,10 +10342,6 @@ struct receive_data_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char receive_data_111[] = { 0xD0, 0x0C, 0x81, 0x03, 0x01, 0x42,
-						0x00, 0x82, 0x02, 0x81, 0x21,
-						0xB7, 0x01, 0xC8 };
-
 static struct receive_data_test receive_data_data_111 = {
 	.pdu = receive_data_111,
 	.pdu_len = sizeof(receive_data_111),
@@ -15970,14 +10350,6 @@ static struct receive_data_test receive_data_data_111 = {
 	.data_len = 200,
 };
 
-static unsigned char receive_data_211[] = { 0xD0, 0x22, 0x81, 0x03, 0x01, 0x42,
-						0x00, 0x82, 0x02, 0x81, 0x21,
-						0x85, 0x0E, 0x52, 0x65, 0x63,
-						0x65, 0x69, 0x76, 0x65, 0x20,
-						0x44, 0x61, 0x74, 0x61, 0x20,
-						0x31, 0xB7, 0x01, 0xC8, 0xD0,
-						0x04, 0x00, 0x0E, 0x00, 0xB4 };
-
 static struct receive_data_test receive_data_data_211 = {
 	.pdu = receive_data_211,
 	.pdu_len = sizeof(receive_data_211),
@@ -16030,11 +10402,6 @@ struct send_data_test {
 	struct stk_frame_id frame_id;
 };
 
-static unsigned char send_data_111[] = { 0xD0, 0x13, 0x81, 0x03, 0x01, 0x43,
-						0x01, 0x82, 0x02, 0x81, 0x21,
-						0xB6, 0x08, 0x00, 0x01, 0x02,
-						0x03, 0x04, 0x05, 0x06, 0x07 };
-
 static struct send_data_test send_data_data_111 = {
 	.pdu = send_data_111,
 	.pdu_len = sizeof(send_data_111),
@@ -16048,35 +10415,6 @@ static struct send_data_test send_data_data_111 = {
 	},
 };
 
-static unsigned char send_data_121[] = {
-				0xD0, 0x81, 0xD4, 0x81, 0x03, 0x01, 0x43, 0x00,
-				0x82, 0x02, 0x81, 0x21, 0xB6, 0x81, 0xC8, 0x00,
-				0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-				0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
-				0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-				0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
-				0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-				0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
-				0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-				0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40,
-				0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
-				0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
-				0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
-				0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60,
-				0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-				0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
-				0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
-				0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80,
-				0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-				0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90,
-				0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
-				0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0,
-				0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8,
-				0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0,
-				0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8,
-				0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0,
-				0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7 };
-
 static struct send_data_test send_data_data_121 = {
 	.pdu = send_data_121,
 	.pdu_len = sizeof(send_data_121),
@@ -16113,14 +10451,6 @@ static struct send_data_test send_data_data_121 = {
 		.len = 200,
 	},
 };
-static unsigned char send_data_211[] = {
-				0xD0, 0x26, 0x81, 0x03, 0x01, 0x43, 0x01, 0x82,
-				0x02, 0x81, 0x21, 0x85, 0x0B, 0x53, 0x65, 0x6E,
-				0x64, 0x20, 0x44, 0x61, 0x74, 0x61, 0x20, 0x31,
-				0xB6, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-				0x06, 0x07, 0xD0, 0x04, 0x00, 0x0B, 0x00, 0xB4,
- };
-
 static struct send_data_test send_data_data_211 = {
 	.pdu = send_data_211,
 	.pdu_len = sizeof(send_data_211),
@@ -16171,10 +10501,6 @@ struct get_channel_status_test {
 	unsigned char qualifier;
 };
 
-static unsigned char get_channel_status_111[] = { 0xD0, 0x09, 0x81, 0x03, 0x01,
-							0x44, 0x00, 0x82, 0x02,
-							0x81, 0x82 };
-
 static struct get_channel_status_test get_channel_status_data_111 = {
 	.pdu = get_channel_status_111,
 	.pdu_len = sizeof(get_channel_status_111),
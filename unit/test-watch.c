@@ -0,0 +1,275 @@
+/*
+ *
+ *  oFono - Open Source Telephony
+ *
+ *  Copyright (C) 2008-2011  Intel Corporation. All rights reserved.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <glib.h>
+
+#include "ofono.h"
+
+struct test_watch {
+	struct ofono_watchlist *watchlist;
+	unsigned int ids[4];
+	int notified[4];
+	int destroyed[4];
+	unsigned int remove_id;
+	gboolean add;
+};
+
+typedef void (*test_notify_func)(struct test_watch *test, int index);
+
+static void test_destroy(void *data)
+{
+	int *destroyed = data;
+
+	(*destroyed)++;
+}
+
+static unsigned int test_add(struct test_watch *test, int index,
+						test_notify_func notify)
+{
+	struct ofono_watchlist_item *item;
+
+	item = g_new0(struct ofono_watchlist_item, 1);
+	item->notify = notify;
+	item->notify_data = &test->destroyed[index];
+	item->destroy = test_destroy;
+
+	test->ids[index] = __ofono_watchlist_add_item(test->watchlist, item);
+
+	return test->ids[index];
+}
+
+static void test_dispatch(struct test_watch *test)
+{
+	struct ofono_watchlist_item *item;
+	test_notify_func notify;
+	int index;
+
+	__ofono_watchlist_dispatch_begin(test->watchlist);
+
+	for (item = __ofono_watchlist_first(test->watchlist); item;
+					item = __ofono_watchlist_next(item)) {
+		notify = item->notify;
+		index = (int *) item->notify_data - test->destroyed;
+		notify(test, index);
+	}
+
+	__ofono_watchlist_dispatch_end(test->watchlist);
+}
+
+static void test_notify(struct test_watch *test, int index)
+{
+	test->notified[index]++;
+}
+
+static void test_notify_remove(struct test_watch *test, int index)
+{
+	test->notified[index]++;
+
+	g_assert(__ofono_watchlist_remove_item(test->watchlist,
+							test->remove_id));
+}
+
+static void test_notify_add(struct test_watch *test, int index)
+{
+	test->notified[index]++;
+
+	if (test->add) {
+		test->add = FALSE;
+		test_add(test, 3, test_notify);
+	}
+}
+
+static void test_notify_nested(struct test_watch *test, int index)
+{
+	test->notified[index]++;
+
+	if (test->notified[index] == 1) {
+		test_dispatch(test);
+		g_assert(__ofono_watchlist_remove_item(test->watchlist,
+							test->remove_id));
+	}
+}
+
+static void test_basic(void)
+{
+	struct test_watch test;
+
+	memset(&test, 0, sizeof(test));
+	test.watchlist = __ofono_watchlist_new(g_free);
+
+	g_assert(__ofono_watchlist_is_empty(test.watchlist));
+	g_assert(!__ofono_watchlist_first(test.watchlist));
+	g_assert(!__ofono_watchlist_remove_item(test.watchlist, 0));
+	g_assert(!__ofono_watchlist_remove_item(test.watchlist, 1));
+
+	g_assert(test_add(&test, 0, test_notify));
+	g_assert(test_add(&test, 1, test_notify));
+	g_assert(test_add(&test, 2, test_notify));
+	g_assert(test.ids[0] != test.ids[1]);
+	g_assert(test.ids[1] != test.ids[2]);
+	g_assert(!__ofono_watchlist_is_empty(test.watchlist));
+
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 1);
+	g_assert(test.notified[1] == 1);
+	g_assert(test.notified[2] == 1);
+
+	/* Remove from the middle, the head and the tail */
+	g_assert(__ofono_watchlist_remove_item(test.watchlist, test.ids[1]));
+	g_assert(test.destroyed[1] == 1);
+	g_assert(!__ofono_watchlist_remove_item(test.watchlist, test.ids[1]));
+
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 2);
+	g_assert(test.notified[1] == 1);
+	g_assert(test.notified[2] == 2);
+
+	g_assert(__ofono_watchlist_remove_item(test.watchlist, test.ids[2]));
+	g_assert(__ofono_watchlist_remove_item(test.watchlist, test.ids[0]));
+	g_assert(__ofono_watchlist_is_empty(test.watchlist));
+	g_assert(!__ofono_watchlist_first(test.watchlist));
+
+	/* Ids are not reused */
+	g_assert(test_add(&test, 0, test_notify) > test.ids[2]);
+	g_assert(test_add(&test, 1, test_notify));
+
+	__ofono_watchlist_free(test.watchlist);
+	g_assert(test.destroyed[0] == 2);
+	g_assert(test.destroyed[1] == 2);
+	g_assert(test.destroyed[2] == 1);
+}
+
+static void test_remove_self(void)
+{
+	struct test_watch test;
+
+	memset(&test, 0, sizeof(test));
+	test.watchlist = __ofono_watchlist_new(g_free);
+
+	test_add(&test, 0, test_notify);
+	test.remove_id = test_add(&test, 1, test_notify_remove);
+	test_add(&test, 2, test_notify);
+
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 1);
+	g_assert(test.notified[1] == 1);
+	g_assert(test.notified[2] == 1);
+	g_assert(test.destroyed[1] == 1);
+
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 2);
+	g_assert(test.notified[1] == 1);
+	g_assert(test.notified[2] == 2);
+
+	__ofono_watchlist_free(test.watchlist);
+	g_assert(test.destroyed[0] == 1);
+	g_assert(test.destroyed[1] == 1);
+	g_assert(test.destroyed[2] == 1);
+}
+
+static void test_remove_next(void)
+{
+	struct test_watch test;
+
+	memset(&test, 0, sizeof(test));
+	test.watchlist = __ofono_watchlist_new(g_free);
+
+	/* Items are notified most recently added first */
+	test.remove_id = test_add(&test, 0, test_notify);
+	test_add(&test, 1, test_notify_remove);
+
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 0);
+	g_assert(test.notified[1] == 1);
+	g_assert(test.destroyed[0] == 1);
+	g_assert(!__ofono_watchlist_remove_item(test.watchlist,
+							test.remove_id));
+
+	__ofono_watchlist_free(test.watchlist);
+	g_assert(test.destroyed[0] == 1);
+	g_assert(test.destroyed[1] == 1);
+}
+
+static void test_add_dispatch(void)
+{
+	struct test_watch test;
+
+	memset(&test, 0, sizeof(test));
+	test.watchlist = __ofono_watchlist_new(g_free);
+
+	test_add(&test, 0, test_notify_add);
+	test.add = TRUE;
+
+	/* Items added during dispatch are not notified right away */
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 1);
+	g_assert(test.notified[3] == 0);
+
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 2);
+	g_assert(test.notified[3] == 1);
+
+	__ofono_watchlist_free(test.watchlist);
+	g_assert(test.destroyed[0] == 1);
+	g_assert(test.destroyed[3] == 1);
+}
+
+static void test_nested(void)
+{
+	struct test_watch test;
+
+	memset(&test, 0, sizeof(test));
+	test.watchlist = __ofono_watchlist_new(g_free);
+
+	test.remove_id = test_add(&test, 0, test_notify);
+	test_add(&test, 1, test_notify_nested);
+
+	/* Removal from a nested dispatch is deferred to the outer one */
+	test_dispatch(&test);
+	g_assert(test.notified[0] == 1);
+	g_assert(test.notified[1] == 2);
+	g_assert(test.destroyed[0] == 1);
+	g_assert(__ofono_watchlist_first(test.watchlist));
+	g_assert(!__ofono_watchlist_next(
+				__ofono_watchlist_first(test.watchlist)));
+
+	__ofono_watchlist_free(test.watchlist);
+	g_assert(test.destroyed[0] == 1);
+	g_assert(test.destroyed[1] == 1);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, NULL);
+
+	g_test_add_func("/testwatch/Basic", test_basic);
+	g_test_add_func("/testwatch/RemoveSelf", test_remove_self);
+	g_test_add_func("/testwatch/RemoveNext", test_remove_next);
+	g_test_add_func("/testwatch/AddDispatch", test_add_dispatch);
+	g_test_add_func("/testwatch/Nested", test_nested);
+
+	return g_test_run();
+}